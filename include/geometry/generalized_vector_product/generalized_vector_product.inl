@@ -49,7 +49,7 @@ perpendicular_solution<T, D, sizeof...(TOS) + 1> perpendicular(const vector_type
 
     vector_type<T, K> constant_terms;
 
-    auto equation_system_solution = LINEAR_ALGEBRA::solve_equation_system(std::move(set_of_vectors), std::move(constant_terms));
+    auto equation_system_solution = solve_geometric_equation_system(set_of_vectors, constant_terms);
 
     if (equation_system_solution)
     {
@@ -107,6 +107,24 @@ public:
     std::error_code get_error_code() const;
 };
 
+///<summary>
+/// solves linear equations system of geometric calculation (e.g coordinates of intersection along creating vectors)
+/// <para>for fields with square root, absolute value and epsilon rank is decided by singular values (see solve_equation_system_svd),
+/// so creating vectors which are dependent up to rounding errors are classified as dependent, other fields are solved exactly</para>
+///</summary>
+template<class T, size_t N, size_t M>
+LINEAR_ALGEBRA::equation_system_solution<T, M> solve_geometric_equation_system(const LINEAR_ALGEBRA::matrix<T, N, M>& coefficents, const LINEAR_ALGEBRA::vector<T, N>& constant_terms)
+{
+    if constexpr (LINEAR_ALGEBRA::has_sqrt_implementation_v<T> && LINEAR_ALGEBRA::has_abs_implementation_v<T> && LINEAR_ALGEBRA::has_epsilon_implementation_v<T>)
+    {
+        return LINEAR_ALGEBRA::solve_equation_system_svd(coefficents, constant_terms);
+    }
+    else
+    {
+        return LINEAR_ALGEBRA::solve_equation_system(coefficents, constant_terms);
+    }
+}
+
 NAMESPACE_GEOMETRY_END
 
 namespace std
@@ -68,7 +68,7 @@ space_space_intersection_solution<T, D, SD1, SD2> intersection(const space<T, SD
         }
     }
 
-    auto equation_system_solution = LINEAR_ALGEBRA::solve_equation_system(std::move(equation_system), std::move(q1p1));
+    auto equation_system_solution = solve_geometric_equation_system(equation_system, q1p1);
     
     if (equation_system_solution)
     {
@@ -526,6 +526,9 @@ template<class T, size_t SD, size_t D>
 template<inclusion_mode mode>
 bool simplex<T, SD, D>::contains(const point_type<T, D>& p) const
 {
+    //all matrices and vectors below are temporaries
+    LINEAR_ALGEBRA::detail::scratch_temporaries scratch;
+
     auto v1p = p - _points[0];
 
     std::array<vector_type<T, D>, SD> simplex_vectors;
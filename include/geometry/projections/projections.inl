@@ -11,6 +11,9 @@ NAMESPACE_PROJECTIONS_BEGIN
 template<class T, size_t SD, size_t D>
 projection_solution<T, D> project(const space<T, SD, D>& s, const point_type<T, D>& p)
 {
+    //equation system and its factors are temporaries, projected point is allocated with resource of caller
+    LINEAR_ALGEBRA::detail::scratch_temporaries scratch;
+
     std::array<vector_type<T, D>, SD> simplex_vectors;
     
     std::transform(s.begin() + 1, s.end(), simplex_vectors.begin(), [&s](const point_type<T, D>& sp) {
@@ -42,21 +45,33 @@ projection_solution<T, D> project(const space<T, SD, D>& s, const point_type<T,
         return v1p * v;
     });
 
-    auto inverse = equation_system.inverted();
-    if(!inverse)
+    //gram matrix of linearly independent vectors is positive-definite, so system is solved by cholesky factorization
+    //(LDLT factorization for fields without square root), vectors are linearly dependent if factorization fails
+    auto equation_system_solution = [&]() {
+        if constexpr (LINEAR_ALGEBRA::has_sqrt_implementation_v<T>)
+        {
+            return LINEAR_ALGEBRA::cholesky_decomposition<T, SD>(std::move(equation_system)).solve(std::move(constant_terms));
+        }
+        else
+        {
+            return LINEAR_ALGEBRA::ldlt_decomposition<T, SD>(std::move(equation_system)).solve(std::move(constant_terms));
+        }
+    }();
+
+    if(!equation_system_solution)
     {
         return projection_solution<T, D>(geometry_calculation_error::linearly_dependent_vectors);
     }
     else
     {
-        auto equation_system_solution = *inverse * constant_terms;
+        LINEAR_ALGEBRA::storage_resource_scope projection_storage(scratch.outer_resource());
 
         return projection_solution<T, D>(
             projection_solution<T, D>::point_projection_result(
                 std::inner_product(
                     simplex_vectors.begin(),
                     simplex_vectors.end(),
-                    equation_system_solution.begin(),
+                    equation_system_solution->begin(),
                     s[0]
                 )
                 )
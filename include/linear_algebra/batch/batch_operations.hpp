@@ -0,0 +1,76 @@
+#pragma once
+
+#include "batch_span.hpp"
+#include "../matrix/matrix.hpp"
+#include "../vector/vector.hpp"
+#include "../kernels/batch.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+//operations on arrays of small matrices and vectors (e.g transformations of many points, inverses of many 3x3/4x4 matrices)
+//groups of matrices are processed at once (element of every matrix of group in separate simd lane),
+//big batches are split into chunks processed in parallel
+//all spans of single operation must have the same size, results must not overlap with arguments
+
+///<summary>
+/// result[i] = a[i] * b[i]
+///</summary>
+template<class T, size_t N, size_t M>
+void batch_multiply(batch_span<const matrix<T, N, M>> a, batch_span<const vector<T, M>> b, batch_span<vector<T, N>> result);
+
+///<summary>
+/// result[i] = a * b[i] (single transformation applied to every vector)
+///</summary>
+template<class T, size_t N, size_t M>
+void batch_multiply(const matrix<T, N, M>& a, batch_span<const vector<T, M>> b, batch_span<vector<T, N>> result);
+
+///<summary>
+/// result[i] = a[i] * b[i]
+///</summary>
+template<class T, size_t N, size_t M, size_t K>
+void batch_multiply(batch_span<const matrix<T, N, M>> a, batch_span<const matrix<T, M, K>> b, batch_span<matrix<T, N, K>> result);
+
+///<summary>
+/// result[i] = determinant of a[i]
+///</summary>
+template<class T, size_t N>
+void batch_determinant(batch_span<const matrix<T, N, N>> a, batch_span<T> result);
+
+///<summary>
+/// result[i] = inverse of a[i]
+///</summary>
+/// <returns> number of singular matrices (their results are not written) </returns>
+template<class T, size_t N>
+size_t batch_inverse(batch_span<const matrix<T, N, N>> a, batch_span<matrix<T, N, N>> result);
+
+///<summary>
+/// solves a[i] * x[i] = b[i]
+/// <para>systems with matrices up to 4x4 are solved by closed-form formulas, bigger ones by LU factorization</para>
+///</summary>
+/// <returns> number of singular matrices (their solutions are not written) </returns>
+template<class T, size_t N>
+size_t batch_solve(batch_span<const matrix<T, N, N>> a, batch_span<const vector<T, N>> b, batch_span<vector<T, N>> x);
+
+namespace detail
+{
+    //batches with as many elements as parallel element-wise operation are processed in parallel (see parallel_thresholds)
+    template<class E>
+    inline bool is_big_batch(size_t size)
+    {
+        return parallel_elementwise(size * sizeof(E) / sizeof(typename E::mathematical_field_type));
+    }
+
+    //elements of contiguous array of small matrices (vectors) are seen by kernels as one array,
+    //elements of i-th matrix start i * batch_stride_v<E> elements after elements of first one
+    template<class E>
+    constexpr size_t batch_stride_v = sizeof(E) / sizeof(typename E::mathematical_field_type);
+
+    template<class E>
+    inline auto batch_elements(batch_span<E> span)
+    {
+        static_assert(sizeof(E) % sizeof(typename E::mathematical_field_type) == 0, "Elements of batch must be stored contiguously!");
+        return span.empty() ? nullptr : span[0].data();
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "batch_operations.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t N, size_t M>
+void batch_multiply(batch_span<const matrix<T, N, M>> a, batch_span<const vector<T, M>> b, batch_span<vector<T, N>> result)
+{
+    static_assert(!matrix<T, N, M>::is_big_matrix, "Batched operations are available only for small matrices!");
+    assert(a.size() == b.size() && a.size() == result.size());
+
+    detail::batch_multiply<T, N, M, 1>(a.size(),
+        detail::batch_elements(a), detail::batch_stride_v<matrix<T, N, M>>,
+        detail::batch_elements(b), detail::batch_stride_v<vector<T, M>>,
+        detail::batch_elements(result), detail::batch_stride_v<vector<T, N>>,
+        detail::is_big_batch<matrix<T, N, M>>(a.size()));
+}
+
+template<class T, size_t N, size_t M>
+void batch_multiply(const matrix<T, N, M>& a, batch_span<const vector<T, M>> b, batch_span<vector<T, N>> result)
+{
+    static_assert(!matrix<T, N, M>::is_big_matrix, "Batched operations are available only for small matrices!");
+    assert(b.size() == result.size());
+
+    //stride 0 repeats the same matrix for every vector
+    detail::batch_multiply<T, N, M, 1>(b.size(),
+        a.data(), 0,
+        detail::batch_elements(b), detail::batch_stride_v<vector<T, M>>,
+        detail::batch_elements(result), detail::batch_stride_v<vector<T, N>>,
+        detail::is_big_batch<vector<T, M>>(b.size()));
+}
+
+template<class T, size_t N, size_t M, size_t K>
+void batch_multiply(batch_span<const matrix<T, N, M>> a, batch_span<const matrix<T, M, K>> b, batch_span<matrix<T, N, K>> result)
+{
+    static_assert(!matrix<T, N, M>::is_big_matrix && !matrix<T, M, K>::is_big_matrix, "Batched operations are available only for small matrices!");
+    assert(a.size() == b.size() && a.size() == result.size());
+
+    detail::batch_multiply<T, N, M, K>(a.size(),
+        detail::batch_elements(a), detail::batch_stride_v<matrix<T, N, M>>,
+        detail::batch_elements(b), detail::batch_stride_v<matrix<T, M, K>>,
+        detail::batch_elements(result), detail::batch_stride_v<matrix<T, N, K>>,
+        detail::is_big_batch<matrix<T, N, M>>(a.size()));
+}
+
+template<class T, size_t N>
+void batch_determinant(batch_span<const matrix<T, N, N>> a, batch_span<T> result)
+{
+    static_assert(!matrix<T, N, N>::is_big_matrix, "Batched operations are available only for small matrices!");
+    assert(a.size() == result.size());
+
+    detail::batch_determinant<T, N>(a.size(),
+        detail::batch_elements(a), detail::batch_stride_v<matrix<T, N, N>>,
+        result.data(),
+        detail::is_big_batch<matrix<T, N, N>>(a.size()));
+}
+
+template<class T, size_t N>
+size_t batch_inverse(batch_span<const matrix<T, N, N>> a, batch_span<matrix<T, N, N>> result)
+{
+    static_assert(!matrix<T, N, N>::is_big_matrix, "Batched operations are available only for small matrices!");
+    assert(a.size() == result.size());
+
+    return detail::batch_inverse<T, N>(a.size(),
+        detail::batch_elements(a), detail::batch_stride_v<matrix<T, N, N>>,
+        detail::batch_elements(result), detail::batch_stride_v<matrix<T, N, N>>,
+        detail::is_big_batch<matrix<T, N, N>>(a.size()));
+}
+
+template<class T, size_t N>
+size_t batch_solve(batch_span<const matrix<T, N, N>> a, batch_span<const vector<T, N>> b, batch_span<vector<T, N>> x)
+{
+    static_assert(!matrix<T, N, N>::is_big_matrix, "Batched operations are available only for small matrices!");
+    assert(a.size() == b.size() && a.size() == x.size());
+
+    return detail::batch_solve<T, N>(a.size(),
+        detail::batch_elements(a), detail::batch_stride_v<matrix<T, N, N>>,
+        detail::batch_elements(b), detail::batch_stride_v<vector<T, N>>,
+        detail::batch_elements(x), detail::batch_stride_v<vector<T, N>>,
+        detail::is_big_batch<matrix<T, N, N>>(a.size()));
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+
+#include <array>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// non-owning view of contiguous array of size elements (matrices or vectors of batched operations)
+/// <para>batch_span of const T is read-only, batch_span of T derives from it, so it can be passed wherever read-only span is expected</para>
+/// <para>spans of arrays, std::array and std::vector can be created without template arguments (e.g batch_span(matrices))</para>
+/// <para>span must not outlive memory it refers to</para>
+///</summary>
+template<class T>
+class batch_span : public batch_span<const T>
+{
+public:
+    using element_type = T;
+public:
+    batch_span() = default;
+
+    batch_span(T* data, size_t size) :
+        batch_span<const T>(data, size)
+    {
+    }
+
+    template<size_t S>
+    batch_span(T(&elements)[S]) :
+        batch_span<const T>(elements, S)
+    {
+    }
+
+    template<size_t S>
+    batch_span(std::array<T, S>& elements) :
+        batch_span<const T>(elements.data(), S)
+    {
+    }
+
+    template<class A>
+    batch_span(std::vector<T, A>& elements) :
+        batch_span<const T>(elements.data(), elements.size())
+    {
+    }
+public:
+    T* data() const
+    {
+        return const_cast<T*>(batch_span<const T>::data());
+    }
+
+    T& operator[](size_t index) const
+    {
+        return data()[index];
+    }
+
+    T* begin() const
+    {
+        return data();
+    }
+
+    T* end() const
+    {
+        return data() + batch_span<const T>::size();
+    }
+};
+
+template<class T>
+class batch_span<const T>
+{
+public:
+    using element_type = const T;
+private:
+    const T* _data = nullptr;
+    size_t _size = 0;
+public:
+    batch_span() = default;
+
+    batch_span(const T* data, size_t size) :
+        _data(data),
+        _size(size)
+    {
+    }
+
+    template<size_t S>
+    batch_span(const T(&elements)[S]) :
+        batch_span(elements, S)
+    {
+    }
+
+    template<size_t S>
+    batch_span(const std::array<T, S>& elements) :
+        batch_span(elements.data(), S)
+    {
+    }
+
+    template<class A>
+    batch_span(const std::vector<T, A>& elements) :
+        batch_span(elements.data(), elements.size())
+    {
+    }
+public:
+    const T* data() const
+    {
+        return _data;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    const T& operator[](size_t index) const
+    {
+        return _data[index];
+    }
+
+    const T* begin() const
+    {
+        return _data;
+    }
+
+    const T* end() const
+    {
+        return _data + _size;
+    }
+};
+
+//deduction guides (read-only span for const containers)
+
+template<class T>
+batch_span(T*, size_t) -> batch_span<T>;
+
+template<class T, size_t S>
+batch_span(T(&)[S]) -> batch_span<T>;
+
+template<class T, size_t S>
+batch_span(std::array<T, S>&) -> batch_span<T>;
+
+template<class T, size_t S>
+batch_span(const std::array<T, S>&) -> batch_span<const T>;
+
+template<class T, class A>
+batch_span(std::vector<T, A>&) -> batch_span<T>;
+
+template<class T, class A>
+batch_span(const std::vector<T, A>&) -> batch_span<const T>;
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../vector/vector.hpp"
+#include "../kernels/cholesky.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// Cholesky factorization (A = L * L^T) of symmetric positive-definite NxN matrix
+/// <para>costs half of LU factorization and needs no pivoting, only lower triangle of matrix is read</para>
+/// <para>(Gram matrices, normal equations of least squares problems and covariance matrices are positive-definite)</para>
+///</summary>
+template<class T, size_t N>
+class cholesky_decomposition
+{
+    static_assert(N != 0, "Matrix dimensions must be at least 1!");
+    static_assert(has_sqrt_implementation_v<T>, "Cholesky factorization requires square root of mathematical field!");
+private:
+    matrix<T, N, N> _l;
+    bool _positive_definite = true;
+private:
+    void factorize();
+public:
+    //constructors
+
+    cholesky_decomposition() = delete;
+
+    cholesky_decomposition(const cholesky_decomposition<T, N>& other) = default;
+
+    cholesky_decomposition(cholesky_decomposition<T, N>&& other) = default;
+
+    cholesky_decomposition<T, N>& operator=(const cholesky_decomposition<T, N>& other) = default;
+
+    cholesky_decomposition<T, N>& operator=(cholesky_decomposition<T, N>&& other) = default;
+
+    //factors copy of given matrix
+    cholesky_decomposition(const matrix<T, N, N>& m);
+
+    //factors given matrix in place (no copy of coefficents is made)
+    cholesky_decomposition(matrix<T, N, N>&& m);
+public:
+    //factorization info and accessors
+
+    //factorization fails (and every operation using factors returns nullopt or 0) if matrix is not positive-definite
+    bool is_positive_definite() const;
+
+    //packed factors: lower part contains L (including diagonal), upper part is not defined
+    const matrix<T, N, N>& factors() const;
+
+    matrix<T, N, N> lower() const;
+public:
+    //operations using factors
+
+    T determinant() const;
+
+    ///<summary>
+    /// solves A * x = b
+    /// <para>if matrix is not positive-definite returns nullopt</para>
+    ///</summary>
+    std::optional<vector<T, N>> solve(const vector<T, N>& b) const;
+    std::optional<vector<T, N>> solve(vector<T, N>&& b) const;
+
+    ///<summary>
+    /// solves A * X = B (every column of B is separate constant terms vector)
+    /// <para>if matrix is not positive-definite returns nullopt</para>
+    ///</summary>
+    template<size_t K>
+    std::optional<matrix<T, N, K>> solve(const matrix<T, N, K>& b) const;
+    template<size_t K>
+    std::optional<matrix<T, N, K>> solve(matrix<T, N, K>&& b) const;
+
+    std::optional<matrix<T, N, N>> inverse() const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "cholesky_decomposition.hpp"
+#include "../matrix/matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t N>
+void cholesky_decomposition<T, N>::factorize()
+{
+    _positive_definite = detail::cholesky_factorize<false>(N, _l.data(), N, detail::parallel_elimination(N, N));
+}
+
+template<class T, size_t N>
+cholesky_decomposition<T, N>::cholesky_decomposition(const matrix<T, N, N>& m) :
+    _l(m)
+{
+    factorize();
+}
+
+template<class T, size_t N>
+cholesky_decomposition<T, N>::cholesky_decomposition(matrix<T, N, N>&& m) :
+    _l(std::move(m))
+{
+    factorize();
+}
+
+template<class T, size_t N>
+bool cholesky_decomposition<T, N>::is_positive_definite() const
+{
+    return _positive_definite;
+}
+
+template<class T, size_t N>
+const matrix<T, N, N>& cholesky_decomposition<T, N>::factors() const
+{
+    return _l;
+}
+
+template<class T, size_t N>
+matrix<T, N, N> cholesky_decomposition<T, N>::lower() const
+{
+    matrix<T, N, N> result;
+
+    for (size_t row = 0; row < N; row++)
+    {
+        for (size_t column = 0; column <= row; column++)
+        {
+            result[row][column] = _l[row][column];
+        }
+    }
+
+    return result;
+}
+
+template<class T, size_t N>
+T cholesky_decomposition<T, N>::determinant() const
+{
+    if (!_positive_definite)
+    {
+        return get_additive_identity<T>();
+    }
+
+    //determinant of A is square of determinant of L (product of its diagonal elements)
+    T determinant_value = get_multiplicative_identity<T>();
+
+    for (size_t diagonal = 0; diagonal < N; diagonal++)
+    {
+        determinant_value *= _l[diagonal][diagonal];
+    }
+
+    return determinant_value * determinant_value;
+}
+
+template<class T, size_t N>
+std::optional<vector<T, N>> cholesky_decomposition<T, N>::solve(const vector<T, N>& b) const
+{
+    return solve(vector<T, N>(b));
+}
+
+template<class T, size_t N>
+std::optional<vector<T, N>> cholesky_decomposition<T, N>::solve(vector<T, N>&& b) const
+{
+    if (!_positive_definite)
+    {
+        return std::nullopt;
+    }
+
+    detail::cholesky_solve<false>(N, _l.data(), N, b.data(), static_cast<size_t>(1), static_cast<size_t>(1));
+
+    return std::optional<vector<T, N>>(std::move(b));
+}
+
+template<class T, size_t N>
+template<size_t K>
+std::optional<matrix<T, N, K>> cholesky_decomposition<T, N>::solve(const matrix<T, N, K>& b) const
+{
+    return solve(matrix<T, N, K>(b));
+}
+
+template<class T, size_t N>
+template<size_t K>
+std::optional<matrix<T, N, K>> cholesky_decomposition<T, N>::solve(matrix<T, N, K>&& b) const
+{
+    if (!_positive_definite)
+    {
+        return std::nullopt;
+    }
+
+    detail::cholesky_solve<false>(N, _l.data(), N, b.data(), K, K, detail::parallel_elimination(N * N, K));
+
+    return std::optional<matrix<T, N, K>>(std::move(b));
+}
+
+template<class T, size_t N>
+std::optional<matrix<T, N, N>> cholesky_decomposition<T, N>::inverse() const
+{
+    if (!_positive_definite)
+    {
+        return std::nullopt;
+    }
+
+    //inverse is solution of A * X = I
+    matrix<T, N, N> identity;
+
+    for (size_t diagonal = 0; diagonal < N; diagonal++)
+    {
+        identity[diagonal][diagonal] = get_multiplicative_identity<T>();
+    }
+
+    return solve(std::move(identity));
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
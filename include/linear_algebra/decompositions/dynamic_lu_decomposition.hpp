@@ -0,0 +1,78 @@
+#pragma once
+
+#include "../dynamic_matrix/dynamic_matrix.hpp"
+#include "../dynamic_vector/dynamic_vector.hpp"
+#include "../kernels/lu.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// LU factorization with partial pivoting (P * A = L * U) of square matrix with size given at runtime
+/// <para>uses the same kernels as lu_decomposition, factors are reused by determinant, inverse and every solve</para>
+///</summary>
+template<class T>
+class dynamic_lu_decomposition
+{
+private:
+    dynamic_matrix<T> _lu;
+    detail::storage_vector<size_t> _pivots;
+    bool _singular = false;
+private:
+    void factorize();
+public:
+    //constructors
+
+    dynamic_lu_decomposition() = delete;
+
+    dynamic_lu_decomposition(const dynamic_lu_decomposition<T>& other) = default;
+
+    dynamic_lu_decomposition(dynamic_lu_decomposition<T>&& other) = default;
+
+    dynamic_lu_decomposition<T>& operator=(const dynamic_lu_decomposition<T>& other) = default;
+
+    dynamic_lu_decomposition<T>& operator=(dynamic_lu_decomposition<T>&& other) = default;
+
+    //factors copy of given square matrix
+    dynamic_lu_decomposition(const dynamic_matrix<T>& m);
+
+    //factors given square matrix in place (no copy of coefficents is made)
+    dynamic_lu_decomposition(dynamic_matrix<T>&& m);
+public:
+    //factorization info and accessors
+
+    size_t size() const;
+
+    //matrix is singular if zero pivot was found (determinant is 0 and systems have no unique solution)
+    bool is_singular() const;
+
+    //packed factors: strictly lower part contains L (without its unit diagonal), upper part contains U
+    const dynamic_matrix<T>& factors() const;
+
+    //pivots[k] is row swapped with row k in k-th step of elimination
+    const size_t* pivots() const;
+
+    dynamic_matrix<T> lower() const;
+    dynamic_matrix<T> upper() const;
+public:
+    //operations using factors
+
+    T determinant() const;
+
+    ///<summary>
+    /// solves A * x = b (b must have size() coordinates)
+    /// <para>if matrix is singular returns nullopt</para>
+    ///</summary>
+    std::optional<dynamic_vector<T>> solve(const dynamic_vector<T>& b) const;
+    std::optional<dynamic_vector<T>> solve(dynamic_vector<T>&& b) const;
+
+    ///<summary>
+    /// solves A * X = B (every column of B is separate constant terms vector, B must have size() rows)
+    /// <para>if matrix is singular returns nullopt</para>
+    ///</summary>
+    std::optional<dynamic_matrix<T>> solve(const dynamic_matrix<T>& b) const;
+    std::optional<dynamic_matrix<T>> solve(dynamic_matrix<T>&& b) const;
+
+    std::optional<dynamic_matrix<T>> inverse() const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
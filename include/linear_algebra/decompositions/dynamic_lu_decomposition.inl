@@ -0,0 +1,168 @@
+#pragma once
+
+#include "dynamic_lu_decomposition.hpp"
+#include "../dynamic_matrix/dynamic_matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T>
+void dynamic_lu_decomposition<T>::factorize()
+{
+    assert(_lu.rows() == _lu.columns());
+
+    _pivots.resize(size());
+
+    _singular = !detail::lu_factorize(size(), _lu.data(), size(), _pivots.data(), detail::parallel_elimination(size(), size()));
+}
+
+template<class T>
+dynamic_lu_decomposition<T>::dynamic_lu_decomposition(const dynamic_matrix<T>& m) :
+    _lu(m)
+{
+    factorize();
+}
+
+template<class T>
+dynamic_lu_decomposition<T>::dynamic_lu_decomposition(dynamic_matrix<T>&& m) :
+    _lu(std::move(m))
+{
+    factorize();
+}
+
+template<class T>
+size_t dynamic_lu_decomposition<T>::size() const
+{
+    return _lu.rows();
+}
+
+template<class T>
+bool dynamic_lu_decomposition<T>::is_singular() const
+{
+    return _singular;
+}
+
+template<class T>
+const dynamic_matrix<T>& dynamic_lu_decomposition<T>::factors() const
+{
+    return _lu;
+}
+
+template<class T>
+const size_t* dynamic_lu_decomposition<T>::pivots() const
+{
+    return _pivots.data();
+}
+
+template<class T>
+dynamic_matrix<T> dynamic_lu_decomposition<T>::lower() const
+{
+    dynamic_matrix<T> result(size(), size());
+
+    for (size_t row = 0; row < size(); row++)
+    {
+        for (size_t column = 0; column < row; column++)
+        {
+            result[row][column] = _lu[row][column];
+        }
+        result[row][row] = get_multiplicative_identity<T>();
+    }
+
+    return result;
+}
+
+template<class T>
+dynamic_matrix<T> dynamic_lu_decomposition<T>::upper() const
+{
+    dynamic_matrix<T> result(size(), size());
+
+    for (size_t row = 0; row < size(); row++)
+    {
+        for (size_t column = row; column < size(); column++)
+        {
+            result[row][column] = _lu[row][column];
+        }
+    }
+
+    return result;
+}
+
+template<class T>
+T dynamic_lu_decomposition<T>::determinant() const
+{
+    if (_singular)
+    {
+        return get_additive_identity<T>();
+    }
+
+    //determinant of triangular matrix is product of its diagonal elements
+    //and every row swap changes its sign
+    T determinant_value = get_multiplicative_identity<T>();
+
+    for (size_t diagonal = 0; diagonal < size(); diagonal++)
+    {
+        determinant_value *= _lu[diagonal][diagonal];
+
+        if (_pivots[diagonal] != diagonal)
+        {
+            determinant_value = -determinant_value;
+        }
+    }
+
+    return determinant_value;
+}
+
+template<class T>
+std::optional<dynamic_vector<T>> dynamic_lu_decomposition<T>::solve(const dynamic_vector<T>& b) const
+{
+    return solve(dynamic_vector<T>(b));
+}
+
+template<class T>
+std::optional<dynamic_vector<T>> dynamic_lu_decomposition<T>::solve(dynamic_vector<T>&& b) const
+{
+    assert(b.size() == size());
+
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    detail::lu_solve(size(), _lu.data(), size(), _pivots.data(), b.data(), static_cast<size_t>(1), static_cast<size_t>(1));
+
+    return std::optional<dynamic_vector<T>>(std::move(b));
+}
+
+template<class T>
+std::optional<dynamic_matrix<T>> dynamic_lu_decomposition<T>::solve(const dynamic_matrix<T>& b) const
+{
+    return solve(dynamic_matrix<T>(b));
+}
+
+template<class T>
+std::optional<dynamic_matrix<T>> dynamic_lu_decomposition<T>::solve(dynamic_matrix<T>&& b) const
+{
+    assert(b.rows() == size());
+
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    detail::lu_solve(size(), _lu.data(), size(), _pivots.data(), b.data(), b.columns(), b.columns(), detail::parallel_elimination(size() * size(), b.columns()));
+
+    return std::optional<dynamic_matrix<T>>(std::move(b));
+}
+
+template<class T>
+std::optional<dynamic_matrix<T>> dynamic_lu_decomposition<T>::inverse() const
+{
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    //inverse is solution of A * X = I
+    return solve(dynamic_matrix<T>::identity(size()));
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
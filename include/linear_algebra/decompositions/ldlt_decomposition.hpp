@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../vector/vector.hpp"
+#include "../kernels/cholesky.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// LDLT factorization (A = L * D * L^T, L is unit lower triangular and D diagonal) of symmetric NxN matrix
+/// <para>same cost as Cholesky factorization, but needs no square roots, so it works for any mathematical field
+/// and for symmetric matrices which are not positive-definite (as long as no zero pivot is found, there is no pivoting)</para>
+///</summary>
+template<class T, size_t N>
+class ldlt_decomposition
+{
+    static_assert(N != 0, "Matrix dimensions must be at least 1!");
+private:
+    matrix<T, N, N> _ldl;
+    bool _singular = false;
+private:
+    void factorize();
+public:
+    //constructors
+
+    ldlt_decomposition() = delete;
+
+    ldlt_decomposition(const ldlt_decomposition<T, N>& other) = default;
+
+    ldlt_decomposition(ldlt_decomposition<T, N>&& other) = default;
+
+    ldlt_decomposition<T, N>& operator=(const ldlt_decomposition<T, N>& other) = default;
+
+    ldlt_decomposition<T, N>& operator=(ldlt_decomposition<T, N>&& other) = default;
+
+    //factors copy of given matrix
+    ldlt_decomposition(const matrix<T, N, N>& m);
+
+    //factors given matrix in place (no copy of coefficents is made)
+    ldlt_decomposition(matrix<T, N, N>&& m);
+public:
+    //factorization info and accessors
+
+    //factorization fails (and every operation using factors returns nullopt or 0) if zero pivot was found
+    bool is_singular() const;
+
+    //packed factors: strictly lower part contains L (without its unit diagonal), diagonal contains D, upper part is not defined
+    const matrix<T, N, N>& factors() const;
+
+    matrix<T, N, N> lower() const;
+    vector<T, N> diagonal() const;
+public:
+    //operations using factors
+
+    T determinant() const;
+
+    ///<summary>
+    /// solves A * x = b
+    /// <para>if zero pivot was found returns nullopt</para>
+    ///</summary>
+    std::optional<vector<T, N>> solve(const vector<T, N>& b) const;
+    std::optional<vector<T, N>> solve(vector<T, N>&& b) const;
+
+    ///<summary>
+    /// solves A * X = B (every column of B is separate constant terms vector)
+    /// <para>if zero pivot was found returns nullopt</para>
+    ///</summary>
+    template<size_t K>
+    std::optional<matrix<T, N, K>> solve(const matrix<T, N, K>& b) const;
+    template<size_t K>
+    std::optional<matrix<T, N, K>> solve(matrix<T, N, K>&& b) const;
+
+    std::optional<matrix<T, N, N>> inverse() const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "ldlt_decomposition.hpp"
+#include "../matrix/matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t N>
+void ldlt_decomposition<T, N>::factorize()
+{
+    _singular = !detail::cholesky_factorize<true>(N, _ldl.data(), N, detail::parallel_elimination(N, N));
+}
+
+template<class T, size_t N>
+ldlt_decomposition<T, N>::ldlt_decomposition(const matrix<T, N, N>& m) :
+    _ldl(m)
+{
+    factorize();
+}
+
+template<class T, size_t N>
+ldlt_decomposition<T, N>::ldlt_decomposition(matrix<T, N, N>&& m) :
+    _ldl(std::move(m))
+{
+    factorize();
+}
+
+template<class T, size_t N>
+bool ldlt_decomposition<T, N>::is_singular() const
+{
+    return _singular;
+}
+
+template<class T, size_t N>
+const matrix<T, N, N>& ldlt_decomposition<T, N>::factors() const
+{
+    return _ldl;
+}
+
+template<class T, size_t N>
+matrix<T, N, N> ldlt_decomposition<T, N>::lower() const
+{
+    matrix<T, N, N> result;
+
+    for (size_t row = 0; row < N; row++)
+    {
+        for (size_t column = 0; column < row; column++)
+        {
+            result[row][column] = _ldl[row][column];
+        }
+        result[row][row] = get_multiplicative_identity<T>();
+    }
+
+    return result;
+}
+
+template<class T, size_t N>
+vector<T, N> ldlt_decomposition<T, N>::diagonal() const
+{
+    vector<T, N> result;
+
+    for (size_t diagonal = 0; diagonal < N; diagonal++)
+    {
+        result[diagonal] = _ldl[diagonal][diagonal];
+    }
+
+    return result;
+}
+
+template<class T, size_t N>
+T ldlt_decomposition<T, N>::determinant() const
+{
+    if (_singular)
+    {
+        return get_additive_identity<T>();
+    }
+
+    //determinant of unit triangular matrix is 1, so determinant of A is product of elements of D
+    T determinant_value = get_multiplicative_identity<T>();
+
+    for (size_t diagonal = 0; diagonal < N; diagonal++)
+    {
+        determinant_value *= _ldl[diagonal][diagonal];
+    }
+
+    return determinant_value;
+}
+
+template<class T, size_t N>
+std::optional<vector<T, N>> ldlt_decomposition<T, N>::solve(const vector<T, N>& b) const
+{
+    return solve(vector<T, N>(b));
+}
+
+template<class T, size_t N>
+std::optional<vector<T, N>> ldlt_decomposition<T, N>::solve(vector<T, N>&& b) const
+{
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    detail::cholesky_solve<true>(N, _ldl.data(), N, b.data(), static_cast<size_t>(1), static_cast<size_t>(1));
+
+    return std::optional<vector<T, N>>(std::move(b));
+}
+
+template<class T, size_t N>
+template<size_t K>
+std::optional<matrix<T, N, K>> ldlt_decomposition<T, N>::solve(const matrix<T, N, K>& b) const
+{
+    return solve(matrix<T, N, K>(b));
+}
+
+template<class T, size_t N>
+template<size_t K>
+std::optional<matrix<T, N, K>> ldlt_decomposition<T, N>::solve(matrix<T, N, K>&& b) const
+{
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    detail::cholesky_solve<true>(N, _ldl.data(), N, b.data(), K, K, detail::parallel_elimination(N * N, K));
+
+    return std::optional<matrix<T, N, K>>(std::move(b));
+}
+
+template<class T, size_t N>
+std::optional<matrix<T, N, N>> ldlt_decomposition<T, N>::inverse() const
+{
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    //inverse is solution of A * X = I
+    matrix<T, N, N> identity;
+
+    for (size_t diagonal = 0; diagonal < N; diagonal++)
+    {
+        identity[diagonal][diagonal] = get_multiplicative_identity<T>();
+    }
+
+    return solve(std::move(identity));
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../vector/vector.hpp"
+#include "../kernels/lu.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// LU factorization with partial pivoting (P * A = L * U) of square NxN matrix
+/// <para>matrix is factored once, factors are then reused by determinant, inverse and every solve</para>
+/// <para>(solving system for another constant terms vector costs O(N^2) instead of O(N^3))</para>
+///</summary>
+template<class T, size_t N>
+class lu_decomposition
+{
+    static_assert(N != 0, "Matrix dimensions must be at least 1!");
+public:
+    static constexpr bool is_big_matrix = matrix<T, N, N>::is_big_matrix;
+private:
+    //pivots of big matrices are kept on heap together with factors
+    using pivots_type = std::conditional_t<is_big_matrix, detail::storage_vector<size_t>, std::array<size_t, N>>;
+
+    matrix<T, N, N> _lu;
+    pivots_type _pivots{};
+    bool _singular = false;
+private:
+    void factorize();
+public:
+    //constructors
+
+    lu_decomposition() = delete;
+
+    lu_decomposition(const lu_decomposition<T, N>& other) = default;
+
+    lu_decomposition(lu_decomposition<T, N>&& other) = default;
+
+    lu_decomposition<T, N>& operator=(const lu_decomposition<T, N>& other) = default;
+
+    lu_decomposition<T, N>& operator=(lu_decomposition<T, N>&& other) = default;
+
+    //factors copy of given matrix
+    lu_decomposition(const matrix<T, N, N>& m);
+
+    //factors given matrix in place (no copy of coefficents is made)
+    lu_decomposition(matrix<T, N, N>&& m);
+public:
+    //factorization info and accessors
+
+    //matrix is singular if zero pivot was found (determinant is 0 and systems have no unique solution)
+    bool is_singular() const;
+
+    //packed factors: strictly lower part contains L (without its unit diagonal), upper part contains U
+    const matrix<T, N, N>& factors() const;
+
+    //pivots[k] is row swapped with row k in k-th step of elimination
+    const size_t* pivots() const;
+
+    matrix<T, N, N> lower() const;
+    matrix<T, N, N> upper() const;
+public:
+    //operations using factors
+
+    T determinant() const;
+
+    ///<summary>
+    /// solves A * x = b
+    /// <para>if matrix is singular returns nullopt</para>
+    ///</summary>
+    std::optional<vector<T, N>> solve(const vector<T, N>& b) const;
+    std::optional<vector<T, N>> solve(vector<T, N>&& b) const;
+
+    ///<summary>
+    /// solves A * X = B (every column of B is separate constant terms vector)
+    /// <para>if matrix is singular returns nullopt</para>
+    ///</summary>
+    template<size_t K>
+    std::optional<matrix<T, N, K>> solve(const matrix<T, N, K>& b) const;
+    template<size_t K>
+    std::optional<matrix<T, N, K>> solve(matrix<T, N, K>&& b) const;
+
+    std::optional<matrix<T, N, N>> inverse() const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
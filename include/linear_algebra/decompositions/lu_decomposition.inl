@@ -0,0 +1,168 @@
+#pragma once
+
+#include "lu_decomposition.hpp"
+#include "../matrix/matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t N>
+void lu_decomposition<T, N>::factorize()
+{
+    if constexpr (is_big_matrix)
+    {
+        _pivots.resize(N);
+    }
+
+    _singular = !detail::lu_factorize(N, _lu.data(), N, _pivots.data(), detail::parallel_elimination(N, N));
+}
+
+template<class T, size_t N>
+lu_decomposition<T, N>::lu_decomposition(const matrix<T, N, N>& m) :
+    _lu(m)
+{
+    factorize();
+}
+
+template<class T, size_t N>
+lu_decomposition<T, N>::lu_decomposition(matrix<T, N, N>&& m) :
+    _lu(std::move(m))
+{
+    factorize();
+}
+
+template<class T, size_t N>
+bool lu_decomposition<T, N>::is_singular() const
+{
+    return _singular;
+}
+
+template<class T, size_t N>
+const matrix<T, N, N>& lu_decomposition<T, N>::factors() const
+{
+    return _lu;
+}
+
+template<class T, size_t N>
+const size_t* lu_decomposition<T, N>::pivots() const
+{
+    return _pivots.data();
+}
+
+template<class T, size_t N>
+matrix<T, N, N> lu_decomposition<T, N>::lower() const
+{
+    matrix<T, N, N> result;
+
+    for (size_t row = 0; row < N; row++)
+    {
+        for (size_t column = 0; column < row; column++)
+        {
+            result[row][column] = _lu[row][column];
+        }
+        result[row][row] = get_multiplicative_identity<T>();
+    }
+
+    return result;
+}
+
+template<class T, size_t N>
+matrix<T, N, N> lu_decomposition<T, N>::upper() const
+{
+    matrix<T, N, N> result;
+
+    for (size_t row = 0; row < N; row++)
+    {
+        for (size_t column = row; column < N; column++)
+        {
+            result[row][column] = _lu[row][column];
+        }
+    }
+
+    return result;
+}
+
+template<class T, size_t N>
+T lu_decomposition<T, N>::determinant() const
+{
+    if (_singular)
+    {
+        return get_additive_identity<T>();
+    }
+
+    //determinant of triangular matrix is product of its diagonal elements
+    //and every row swap changes its sign
+    T determinant_value = get_multiplicative_identity<T>();
+
+    for (size_t diagonal = 0; diagonal < N; diagonal++)
+    {
+        determinant_value *= _lu[diagonal][diagonal];
+
+        if (_pivots[diagonal] != diagonal)
+        {
+            determinant_value = -determinant_value;
+        }
+    }
+
+    return determinant_value;
+}
+
+template<class T, size_t N>
+std::optional<vector<T, N>> lu_decomposition<T, N>::solve(const vector<T, N>& b) const
+{
+    return solve(vector<T, N>(b));
+}
+
+template<class T, size_t N>
+std::optional<vector<T, N>> lu_decomposition<T, N>::solve(vector<T, N>&& b) const
+{
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    detail::lu_solve(N, _lu.data(), N, _pivots.data(), b.data(), static_cast<size_t>(1), static_cast<size_t>(1));
+
+    return std::optional<vector<T, N>>(std::move(b));
+}
+
+template<class T, size_t N>
+template<size_t K>
+std::optional<matrix<T, N, K>> lu_decomposition<T, N>::solve(const matrix<T, N, K>& b) const
+{
+    return solve(matrix<T, N, K>(b));
+}
+
+template<class T, size_t N>
+template<size_t K>
+std::optional<matrix<T, N, K>> lu_decomposition<T, N>::solve(matrix<T, N, K>&& b) const
+{
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    detail::lu_solve(N, _lu.data(), N, _pivots.data(), b.data(), K, K, detail::parallel_elimination(N * N, K));
+
+    return std::optional<matrix<T, N, K>>(std::move(b));
+}
+
+template<class T, size_t N>
+std::optional<matrix<T, N, N>> lu_decomposition<T, N>::inverse() const
+{
+    if (_singular)
+    {
+        return std::nullopt;
+    }
+
+    //inverse is solution of A * X = I
+    matrix<T, N, N> identity;
+
+    for (size_t diagonal = 0; diagonal < N; diagonal++)
+    {
+        identity[diagonal][diagonal] = get_multiplicative_identity<T>();
+    }
+
+    return solve(std::move(identity));
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
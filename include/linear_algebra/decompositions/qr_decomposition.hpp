@@ -0,0 +1,81 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../vector/vector.hpp"
+#include "../kernels/qr.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// householder QR factorization (A = Q * R) of NxM matrix with at least as many rows as columns (N >= M)
+/// <para>Q is NxM matrix with orthonormal columns (stored as householder reflectors), R is MxM upper triangular matrix</para>
+/// <para>solves overdetermined systems in least squares sense without forming normal equations (A^T * A),
+/// so accuracy depends on condition number of A instead of its square</para>
+///</summary>
+template<class T, size_t N, size_t M>
+class qr_decomposition
+{
+    static_assert(N != 0 && M != 0, "Matrix dimensions must be at least 1!");
+    static_assert(N >= M, "QR factorization requires at least as many rows as columns!");
+    static_assert(has_sqrt_implementation_v<T>, "QR factorization requires square root of mathematical field!");
+private:
+    matrix<T, N, M> _qr;
+    vector<T, M> _tau;
+    bool _rank_deficient = false;
+private:
+    void factorize();
+public:
+    //constructors
+
+    qr_decomposition() = delete;
+
+    qr_decomposition(const qr_decomposition<T, N, M>& other) = default;
+
+    qr_decomposition(qr_decomposition<T, N, M>&& other) = default;
+
+    qr_decomposition<T, N, M>& operator=(const qr_decomposition<T, N, M>& other) = default;
+
+    qr_decomposition<T, N, M>& operator=(qr_decomposition<T, N, M>&& other) = default;
+
+    //factors copy of given matrix
+    qr_decomposition(const matrix<T, N, M>& m);
+
+    //factors given matrix in place (no copy of coefficents is made)
+    qr_decomposition(matrix<T, N, M>&& m);
+public:
+    //factorization info and accessors
+
+    //matrix is rank deficient if R has zero (or rounding error of zero) on diagonal (columns are linearly dependent and least squares solution is not unique)
+    bool is_rank_deficient() const;
+
+    //packed factors: upper part contains R, strictly lower part contains householder vectors (without their unit first element)
+    const matrix<T, N, M>& factors() const;
+
+    //scalars of householder reflectors (H_k = I - tau[k] * v_k * v_k^T)
+    const vector<T, M>& tau() const;
+
+    //NxM matrix with orthonormal columns
+    matrix<T, N, M> q() const;
+
+    matrix<T, M, M> r() const;
+public:
+    //operations using factors
+
+    ///<summary>
+    /// finds x minimizing ||A * x - b|| (solution of A * x = b if system is consistent)
+    /// <para>if matrix is rank deficient returns nullopt</para>
+    ///</summary>
+    std::optional<vector<T, M>> solve(const vector<T, N>& b) const;
+    std::optional<vector<T, M>> solve(vector<T, N>&& b) const;
+
+    ///<summary>
+    /// finds X minimizing ||A * X - B|| (every column of B is separate constant terms vector)
+    /// <para>if matrix is rank deficient returns nullopt</para>
+    ///</summary>
+    template<size_t K>
+    std::optional<matrix<T, M, K>> solve(const matrix<T, N, K>& b) const;
+    template<size_t K>
+    std::optional<matrix<T, M, K>> solve(matrix<T, N, K>&& b) const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
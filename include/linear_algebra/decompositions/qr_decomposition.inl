@@ -0,0 +1,128 @@
+#pragma once
+
+#include "qr_decomposition.hpp"
+#include "../matrix/matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t N, size_t M>
+void qr_decomposition<T, N, M>::factorize()
+{
+    detail::qr_factorize(N, M, _qr.data(), M, _tau.data(), detail::parallel_elimination(N, M));
+    _rank_deficient = detail::qr_is_rank_deficient(N, M, _qr.data(), M);
+}
+
+template<class T, size_t N, size_t M>
+qr_decomposition<T, N, M>::qr_decomposition(const matrix<T, N, M>& m) :
+    _qr(m)
+{
+    factorize();
+}
+
+template<class T, size_t N, size_t M>
+qr_decomposition<T, N, M>::qr_decomposition(matrix<T, N, M>&& m) :
+    _qr(std::move(m))
+{
+    factorize();
+}
+
+template<class T, size_t N, size_t M>
+bool qr_decomposition<T, N, M>::is_rank_deficient() const
+{
+    return _rank_deficient;
+}
+
+template<class T, size_t N, size_t M>
+const matrix<T, N, M>& qr_decomposition<T, N, M>::factors() const
+{
+    return _qr;
+}
+
+template<class T, size_t N, size_t M>
+const vector<T, M>& qr_decomposition<T, N, M>::tau() const
+{
+    return _tau;
+}
+
+template<class T, size_t N, size_t M>
+matrix<T, N, M> qr_decomposition<T, N, M>::q() const
+{
+    //Q is product of reflectors applied to first M columns of identity
+    matrix<T, N, M> result;
+
+    for (size_t diagonal = 0; diagonal < M; diagonal++)
+    {
+        result[diagonal][diagonal] = get_multiplicative_identity<T>();
+    }
+
+    detail::qr_apply_q(N, M, _qr.data(), M, _tau.data(), result.data(), M, M, detail::parallel_elimination(N, M));
+
+    return result;
+}
+
+template<class T, size_t N, size_t M>
+matrix<T, M, M> qr_decomposition<T, N, M>::r() const
+{
+    matrix<T, M, M> result;
+
+    for (size_t row = 0; row < M; row++)
+    {
+        for (size_t column = row; column < M; column++)
+        {
+            result[row][column] = _qr[row][column];
+        }
+    }
+
+    return result;
+}
+
+template<class T, size_t N, size_t M>
+std::optional<vector<T, M>> qr_decomposition<T, N, M>::solve(const vector<T, N>& b) const
+{
+    return solve(vector<T, N>(b));
+}
+
+template<class T, size_t N, size_t M>
+std::optional<vector<T, M>> qr_decomposition<T, N, M>::solve(vector<T, N>&& b) const
+{
+    if (_rank_deficient)
+    {
+        return std::nullopt;
+    }
+
+    //R * x = (Q^T * b)[0:M], remaining coordinates of Q^T * b are residual
+    detail::qr_apply_qt(N, M, _qr.data(), M, _tau.data(), b.data(), static_cast<size_t>(1), static_cast<size_t>(1), detail::parallel_elimination(N, M));
+    detail::qr_back_substitution(M, _qr.data(), M, b.data(), static_cast<size_t>(1), static_cast<size_t>(1));
+
+    vector<T, M> result;
+    std::copy(b.data(), b.data() + M, result.data());
+
+    return std::optional<vector<T, M>>(std::move(result));
+}
+
+template<class T, size_t N, size_t M>
+template<size_t K>
+std::optional<matrix<T, M, K>> qr_decomposition<T, N, M>::solve(const matrix<T, N, K>& b) const
+{
+    return solve(matrix<T, N, K>(b));
+}
+
+template<class T, size_t N, size_t M>
+template<size_t K>
+std::optional<matrix<T, M, K>> qr_decomposition<T, N, M>::solve(matrix<T, N, K>&& b) const
+{
+    if (_rank_deficient)
+    {
+        return std::nullopt;
+    }
+
+    detail::qr_apply_qt(N, M, _qr.data(), M, _tau.data(), b.data(), K, K, detail::parallel_elimination(N * M, K));
+    detail::qr_back_substitution(M, _qr.data(), M, b.data(), K, K);
+
+    matrix<T, M, K> result;
+    std::copy(b.data(), b.data() + M * K, result.data());
+
+    return std::optional<matrix<T, M, K>>(std::move(result));
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
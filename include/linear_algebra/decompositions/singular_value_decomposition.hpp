@@ -0,0 +1,94 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../vector/vector.hpp"
+#include "../kernels/svd.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// singular value decomposition (A = U * diag(singular_values) * V^T) of NxM matrix, K = min(N, M)
+/// <para>U is NxK and V is MxK matrix with orthonormal columns, singular values are non-negative and sorted in descending order</para>
+/// <para>matrices with up to 16 columns (rows for wide matrices) are orthogonalized by one-sided jacobi rotations,
+/// bigger ones are reduced to bidiagonal form and diagonalized by implicit QR iterations</para>
+/// <para>numerical rank, pseudo-inverse and condition number derived from singular values do not depend on exact zeros,
+/// so they are reliable for noisy (e.g measured or rounded) coefficents</para>
+///</summary>
+template<class T, size_t N, size_t M>
+class singular_value_decomposition
+{
+    static_assert(N != 0 && M != 0, "Matrix dimensions must be at least 1!");
+    static_assert(has_sqrt_implementation_v<T> && has_abs_implementation_v<T> && has_epsilon_implementation_v<T>,
+        "Singular value decomposition requires square root, absolute value and epsilon of mathematical field!");
+public:
+    static constexpr size_t K = N < M ? N : M;
+private:
+    vector<T, K> _singular_values;
+    std::optional<matrix<T, N, K>> _u;
+    std::optional<matrix<T, M, K>> _v;
+private:
+    void decompose(matrix<T, N, M>& m);
+public:
+    //constructors
+
+    singular_value_decomposition() = delete;
+
+    singular_value_decomposition(const singular_value_decomposition<T, N, M>& other) = default;
+
+    singular_value_decomposition(singular_value_decomposition<T, N, M>&& other) = default;
+
+    singular_value_decomposition<T, N, M>& operator=(const singular_value_decomposition<T, N, M>& other) = default;
+
+    singular_value_decomposition<T, N, M>& operator=(singular_value_decomposition<T, N, M>&& other) = default;
+
+    //decomposes copy of given matrix (singular vectors are computed only if compute_singular_vectors is set)
+    singular_value_decomposition(const matrix<T, N, M>& m, bool compute_singular_vectors = true);
+
+    //decomposes given matrix in place (no copy of coefficents is made)
+    singular_value_decomposition(matrix<T, N, M>&& m, bool compute_singular_vectors = true);
+public:
+    //decomposition accessors
+
+    //singular values in descending order
+    const vector<T, K>& singular_values() const;
+
+    bool has_singular_vectors() const;
+
+    //left singular vectors (column i belongs to singular_values()[i]), available only if they were computed
+    const matrix<T, N, K>& u() const;
+
+    //right singular vectors (column i belongs to singular_values()[i]), available only if they were computed
+    const matrix<T, M, K>& v() const;
+public:
+    //operations using singular values
+
+    //max(N, M) * epsilon * largest singular value (singular values not larger than this are rounding errors of zeros)
+    T default_tolerance() const;
+
+    //number of singular values larger than default_tolerance()
+    size_t rank() const;
+
+    //number of singular values larger than tolerance (singular values up to expected error of coefficents should be treated as zeros)
+    size_t rank(const T& tolerance) const;
+
+    //ratio of largest and smallest singular value (infinity if smallest one is zero), relative errors of solutions are up to this many times bigger than relative errors of coefficents
+    T condition_number() const;
+
+    ///<summary>
+    /// MxN moore-penrose pseudo-inverse V * diag(1 / singular_values) * U^T, where singular values not larger than tolerance
+    /// (default_tolerance() if not given) are treated as zeros (requires singular vectors)
+    /// <para>pseudo-inverse of matrix with full rank is (A^T * A)^-1 * A^T for tall matrices, A^-1 for square ones
+    /// and A^T * (A * A^T)^-1 for wide ones</para>
+    ///</summary>
+    matrix<T, M, N> pseudo_inverse() const;
+    matrix<T, M, N> pseudo_inverse(const T& tolerance) const;
+
+    ///<summary>
+    /// finds x with smallest norm among vectors minimizing ||A * x - b|| (pseudo_inverse() * b computed without forming pseudo-inverse),
+    /// singular values not larger than tolerance (default_tolerance() if not given) are treated as zeros (requires singular vectors)
+    ///</summary>
+    vector<T, M> solve(const vector<T, N>& b) const;
+    vector<T, M> solve(const vector<T, N>& b, const T& tolerance) const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
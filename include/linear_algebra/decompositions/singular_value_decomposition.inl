@@ -0,0 +1,190 @@
+#pragma once
+
+#include "singular_value_decomposition.hpp"
+#include "../matrix/matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t N, size_t M>
+void singular_value_decomposition<T, N, M>::decompose(matrix<T, N, M>& m)
+{
+    T* u = _u ? _u->data() : nullptr;
+    T* v = _v ? _v->data() : nullptr;
+    detail::svd_solve(N, M, m.data(), M, _singular_values.data(), u, K, v, K, detail::parallel_elimination(N, M));
+}
+
+template<class T, size_t N, size_t M>
+singular_value_decomposition<T, N, M>::singular_value_decomposition(const matrix<T, N, M>& m, bool compute_singular_vectors)
+{
+    if (compute_singular_vectors)
+    {
+        _u.emplace();
+        _v.emplace();
+    }
+
+    //copy of coefficents is temporary (it is destroyed by reduction to bidiagonal form)
+    detail::scratch_temporaries scratch;
+    matrix<T, N, M> copy(m);
+    decompose(copy);
+}
+
+template<class T, size_t N, size_t M>
+singular_value_decomposition<T, N, M>::singular_value_decomposition(matrix<T, N, M>&& m, bool compute_singular_vectors)
+{
+    if (compute_singular_vectors)
+    {
+        _u.emplace();
+        _v.emplace();
+    }
+
+    decompose(m);
+}
+
+template<class T, size_t N, size_t M>
+const vector<T, singular_value_decomposition<T, N, M>::K>& singular_value_decomposition<T, N, M>::singular_values() const
+{
+    return _singular_values;
+}
+
+template<class T, size_t N, size_t M>
+bool singular_value_decomposition<T, N, M>::has_singular_vectors() const
+{
+    return _u.has_value();
+}
+
+template<class T, size_t N, size_t M>
+const matrix<T, N, singular_value_decomposition<T, N, M>::K>& singular_value_decomposition<T, N, M>::u() const
+{
+    assert(_u.has_value());
+    return *_u;
+}
+
+template<class T, size_t N, size_t M>
+const matrix<T, M, singular_value_decomposition<T, N, M>::K>& singular_value_decomposition<T, N, M>::v() const
+{
+    assert(_v.has_value());
+    return *_v;
+}
+
+template<class T, size_t N, size_t M>
+T singular_value_decomposition<T, N, M>::default_tolerance() const
+{
+    return static_cast<T>(std::max(N, M)) * functions_implementation<T>::epsilon() * _singular_values[0];
+}
+
+template<class T, size_t N, size_t M>
+size_t singular_value_decomposition<T, N, M>::rank() const
+{
+    return rank(default_tolerance());
+}
+
+template<class T, size_t N, size_t M>
+size_t singular_value_decomposition<T, N, M>::rank(const T& tolerance) const
+{
+    //singular values are sorted, so rank is index of first negligible one
+    size_t rank = 0;
+    while (rank < K && _singular_values[rank] > tolerance)
+    {
+        rank++;
+    }
+
+    return rank;
+}
+
+template<class T, size_t N, size_t M>
+T singular_value_decomposition<T, N, M>::condition_number() const
+{
+    if (equal(_singular_values[K - 1], get_additive_identity<T>()))
+    {
+        return std::numeric_limits<T>::infinity();
+    }
+
+    return _singular_values[0] / _singular_values[K - 1];
+}
+
+template<class T, size_t N, size_t M>
+matrix<T, M, N> singular_value_decomposition<T, N, M>::pseudo_inverse() const
+{
+    return pseudo_inverse(default_tolerance());
+}
+
+template<class T, size_t N, size_t M>
+matrix<T, M, N> singular_value_decomposition<T, N, M>::pseudo_inverse(const T& tolerance) const
+{
+    assert(_v.has_value());
+
+    //result is allocated before scratch scope, scaled right singular vectors are temporary
+    matrix<T, M, N> result;
+
+    detail::scratch_temporaries scratch;
+
+    //V * diag(1 / singular_values), columns of negligible singular values are zeroed
+    matrix<T, M, K> scaled(*_v);
+    const size_t r = rank(tolerance);
+
+    for (size_t row = 0; row < M; row++)
+    {
+        for (size_t column = 0; column < K; column++)
+        {
+            scaled[row][column] = column < r ? scaled[row][column] / _singular_values[column] : get_additive_identity<T>();
+        }
+    }
+
+    //result = scaled * U^T
+    detail::multiply_add(
+        M, N, K,
+        get_multiplicative_identity<T>(),
+        scaled.data(), K, static_cast<size_t>(1),
+        _u->data(), static_cast<size_t>(1), K,
+        get_additive_identity<T>(),
+        result.data(), N, static_cast<size_t>(1),
+        matrix<T, M, N>::is_big_matrix
+    );
+
+    return result;
+}
+
+template<class T, size_t N, size_t M>
+vector<T, M> singular_value_decomposition<T, N, M>::solve(const vector<T, N>& b) const
+{
+    return solve(b, default_tolerance());
+}
+
+template<class T, size_t N, size_t M>
+vector<T, M> singular_value_decomposition<T, N, M>::solve(const vector<T, N>& b, const T& tolerance) const
+{
+    assert(_u.has_value());
+
+    vector<T, M> result;
+
+    detail::scratch_temporaries scratch;
+
+    //y = diag(1 / singular_values) * U^T * b (only first rank coordinates are not zero), x = V * y
+    const size_t r = rank(tolerance);
+    vector<T, K> y;
+
+    for (size_t row = 0; row < N; row++)
+    {
+        for (size_t column = 0; column < r; column++)
+        {
+            y[column] += (*_u)[row][column] * b[row];
+        }
+    }
+
+    for (size_t column = 0; column < r; column++)
+    {
+        y[column] /= _singular_values[column];
+    }
+
+    for (size_t row = 0; row < M; row++)
+    {
+        for (size_t column = 0; column < r; column++)
+        {
+            result[row] += (*_v)[row][column] * y[column];
+        }
+    }
+
+    return result;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../vector/vector.hpp"
+#include "../kernels/symmetric_eigen.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// eigenvalue decomposition (A = V * diag(eigenvalues) * V^T, V is orthogonal) of symmetric NxN matrix
+/// <para>only lower triangle of matrix is read, eigenvalues are sorted in ascending order and eigenvectors are columns of V
+/// (e.g principal axes of covariance matrix are eigenvectors, variances along them are eigenvalues)</para>
+/// <para>3x3 matrices are diagonalized by jacobi rotations (eigenvalues are the same whether eigenvectors are computed or not),
+/// bigger ones are reduced to tridiagonal form and solved by QL iterations (eigenvalues only) or by divide and conquer</para>
+///</summary>
+template<class T, size_t N>
+class symmetric_eigen
+{
+    static_assert(N != 0, "Matrix dimensions must be at least 1!");
+    static_assert(has_sqrt_implementation_v<T> && has_abs_implementation_v<T> && has_epsilon_implementation_v<T>,
+        "Eigenvalue decomposition requires square root, absolute value and epsilon of mathematical field!");
+private:
+    vector<T, N> _eigenvalues;
+    std::optional<matrix<T, N, N>> _eigenvectors;
+private:
+    void decompose(matrix<T, N, N>& m);
+public:
+    //constructors
+
+    symmetric_eigen() = delete;
+
+    symmetric_eigen(const symmetric_eigen<T, N>& other) = default;
+
+    symmetric_eigen(symmetric_eigen<T, N>&& other) = default;
+
+    symmetric_eigen<T, N>& operator=(const symmetric_eigen<T, N>& other) = default;
+
+    symmetric_eigen<T, N>& operator=(symmetric_eigen<T, N>&& other) = default;
+
+    //decomposes copy of given matrix (eigenvectors are computed only if compute_eigenvectors is set)
+    symmetric_eigen(const matrix<T, N, N>& m, bool compute_eigenvectors = true);
+
+    //decomposes given matrix in place (no copy of coefficents is made)
+    symmetric_eigen(matrix<T, N, N>&& m, bool compute_eigenvectors = true);
+public:
+    //decomposition accessors
+
+    //eigenvalues in ascending order
+    const vector<T, N>& eigenvalues() const;
+
+    bool has_eigenvectors() const;
+
+    //orthonormal eigenvectors (column i belongs to eigenvalues()[i]), available only if they were computed
+    const matrix<T, N, N>& eigenvectors() const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
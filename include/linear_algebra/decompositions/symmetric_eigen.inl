@@ -0,0 +1,59 @@
+#pragma once
+
+#include "symmetric_eigen.hpp"
+#include "../matrix/matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t N>
+void symmetric_eigen<T, N>::decompose(matrix<T, N, N>& m)
+{
+    T* vectors = _eigenvectors ? _eigenvectors->data() : nullptr;
+    detail::symmetric_eigen_solve(N, m.data(), N, _eigenvalues.data(), vectors, N, detail::parallel_elimination(N, N));
+}
+
+template<class T, size_t N>
+symmetric_eigen<T, N>::symmetric_eigen(const matrix<T, N, N>& m, bool compute_eigenvectors)
+{
+    if (compute_eigenvectors)
+    {
+        _eigenvectors.emplace();
+    }
+
+    //copy of coefficents is temporary (it is destroyed by reduction to tridiagonal form)
+    detail::scratch_temporaries scratch;
+    matrix<T, N, N> copy(m);
+    decompose(copy);
+}
+
+template<class T, size_t N>
+symmetric_eigen<T, N>::symmetric_eigen(matrix<T, N, N>&& m, bool compute_eigenvectors)
+{
+    if (compute_eigenvectors)
+    {
+        _eigenvectors.emplace();
+    }
+
+    decompose(m);
+}
+
+template<class T, size_t N>
+const vector<T, N>& symmetric_eigen<T, N>::eigenvalues() const
+{
+    return _eigenvalues;
+}
+
+template<class T, size_t N>
+bool symmetric_eigen<T, N>::has_eigenvectors() const
+{
+    return _eigenvectors.has_value();
+}
+
+template<class T, size_t N>
+const matrix<T, N, N>& symmetric_eigen<T, N>::eigenvectors() const
+{
+    assert(_eigenvectors.has_value());
+    return *_eigenvectors;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+#include "../matrix/matrix.hpp"
+#include "../dynamic_vector/dynamic_vector.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
+
+template<class TO>
+std::ostream& operator<<(std::ostream& os, const dynamic_matrix<TO>& m);
+
+NAMESPACE_LINEAR_ALGEBRA_IO_END
+
+///<summary>
+/// matrix with dimensions given at runtime (data is ordered row by row, as in matrix)
+/// <para>uses the same GEMM, LU and element-wise kernels as matrix, only one class is instantiated for every size,
+/// so problems of different sizes do not require new template instantiations</para>
+/// <para>element-wise operations on matrices of different dimensions behave as for matrix (result has smaller dimensions),
+/// matrix product requires number of columns of left matrix to be equal to number of rows of right one</para>
+///</summary>
+template<class T>
+class dynamic_matrix
+{
+    static_assert(is_valid_mathematical_field_v<T>, "Matrix element type must satisfy valid_mathematical_field concept!");
+
+    template<class TO>
+    friend class dynamic_matrix;
+private:
+    size_t _rows = 0;
+    size_t _columns = 0;
+    detail::storage_vector<T> _mat;
+public:
+    using mathematical_field_type = T;
+public:
+    //default constructor (matrix of size 0x0)
+
+    dynamic_matrix() = default;
+
+    //copy, move constructors and operators
+
+    dynamic_matrix(const dynamic_matrix<T>& other) = default;
+
+    dynamic_matrix(dynamic_matrix<T>&& other) = default;
+
+    dynamic_matrix<T>& operator=(const dynamic_matrix<T>& other) = default;
+
+    dynamic_matrix<T>& operator=(dynamic_matrix<T>&& other) = default;
+
+    //different type
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix(const dynamic_matrix<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix<T>& operator=(const dynamic_matrix<TO>& other);
+
+    //from matrix with dimensions known at compile time
+
+    template<class TO, size_t N, size_t M, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix(const matrix<TO, N, M>& other);
+
+    template<class TO, size_t N, size_t M, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix<T>& operator=(const matrix<TO, N, M>& other);
+
+    //copies elements of view (e.g to pass block of matrix to decompositions)
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<std::remove_const_t<TO>, T>>>
+    dynamic_matrix(const matrix_view<TO>& other);
+
+    //regular constructors
+
+    //all elements are 0
+    dynamic_matrix(size_t rows, size_t columns);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix(size_t rows, size_t columns, const TO& v);
+
+    //every row must have the same number of elements
+    dynamic_matrix(std::initializer_list<std::initializer_list<T>> vs);
+public:
+    //matrix-matrix operators
+
+    template<class TO, typename = typename std::enable_if_t<can_be_added_v<T, TO>>>
+    dynamic_matrix<addition_result_t<T, TO>> operator+(const dynamic_matrix<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_subtracted_v<T, TO>>>
+    dynamic_matrix<subtraction_result_t<T, TO>> operator-(const dynamic_matrix<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<T, TO>>>
+    dynamic_matrix<inner_product_result_t<T, TO>> operator*(const dynamic_matrix<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix<T>& operator+=(const dynamic_matrix<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix<T>& operator-=(const dynamic_matrix<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<T, TO> && std::is_convertible_v<inner_product_result_t<T, TO>, T>>>
+    dynamic_matrix<T>& operator*=(const dynamic_matrix<TO>& other);
+
+    //result = alpha * a * b + beta * result (single GEMM call, result must have a.rows() x b.columns() size and must not be a or b)
+    template<class TA, class TB, class TS>
+    static void multiply_add(const TS& alpha, const dynamic_matrix<TA>& a, const dynamic_matrix<TB>& b, const TS& beta, dynamic_matrix<T>& result);
+
+    //matrix-scalar operators
+
+    dynamic_matrix<T> operator-() const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+    dynamic_matrix<multiplication_result_t<T, TO>> operator*(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_divided_v<T, TO> && std::is_convertible_v<TO, T>>>
+    dynamic_matrix<division_result_t<T, TO>> operator/(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix<T>& operator*=(const TO& v);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_matrix<T>& operator/=(const TO& v);
+
+    //matrix-vector operators
+
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<T, TO>>>
+    dynamic_vector<inner_product_result_t<T, TO>> operator*(const dynamic_vector<TO>& vec) const;
+public:
+    //matrix info and accessors
+
+    size_t rows() const;
+    size_t columns() const;
+
+    //big matrices are multiplied by packed kernels (same rule as for matrix storage)
+    bool is_big_matrix() const;
+
+    T* operator[](size_t x);
+    const T* operator[](size_t x) const;
+
+    //matrix data is ordered row by row (i.e row|row|row|...|row)
+    //same rule applies for iterators
+
+    T* data();
+    const T* data() const;
+
+    T* begin();
+    const T* begin() const;
+
+    T* end();
+    const T* end() const;
+
+    //views of matrix memory (no elements are copied, views must not outlive matrix)
+
+    matrix_view<T> view();
+    matrix_view<const T> view() const;
+
+    matrix_view<T> block(size_t row, size_t column, size_t rows, size_t columns);
+    matrix_view<const T> block(size_t row, size_t column, size_t rows, size_t columns) const;
+
+    template<size_t R, size_t C>
+    matrix_view<T> block(size_t row, size_t column);
+
+    template<size_t R, size_t C>
+    matrix_view<const T> block(size_t row, size_t column) const;
+
+    vector_view<T> row(size_t row);
+    vector_view<const T> row(size_t row) const;
+
+    vector_view<T> column(size_t column);
+    vector_view<const T> column(size_t column) const;
+
+    vector_view<T> diagonal();
+    vector_view<const T> diagonal() const;
+
+    //copies top left min(N, rows()) x min(M, columns()) part to matrix with dimensions known at compile time
+    template<size_t N, size_t M>
+    matrix<T, N, M> to_matrix() const;
+public:
+    //comparison operators
+
+    //matrices are equal only if they have the same dimensions and all elements are equal
+
+    template<class TO, typename = typename std::enable_if_t<use_high_quality_equality_comparison ? high_quality_equality_comparable_v<T, TO> || equality_comparable_v<T, TO> : equality_comparable_v<T, TO>>>
+    bool operator==(const dynamic_matrix<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<use_high_quality_equality_comparison ? high_quality_inequality_comparable_v<T, TO> || inequality_comparable_v<T, TO> : inequality_comparable_v<T, TO>>>
+    bool operator!=(const dynamic_matrix<TO>& other) const;
+public:
+    //matrix operations
+
+    //square matrices only
+    T determinant() const;
+
+    //square matrices only
+    std::optional<dynamic_matrix<T>> inverted() const;
+
+    size_t rank() const;
+
+    dynamic_matrix<T> transposed() const;
+
+    dynamic_matrix<T>& transpose();
+public:
+    static dynamic_matrix<T> identity(size_t n);
+public:
+    template<class TO>
+    friend std::ostream& LINEAR_ALGEBRA_IO::operator<<(std::ostream& os, const dynamic_matrix<TO>& m);
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
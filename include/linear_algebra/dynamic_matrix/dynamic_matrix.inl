@@ -0,0 +1,631 @@
+#pragma once
+
+#include "dynamic_matrix.hpp"
+#include "../matrix/matrix.inl"
+#include "../dynamic_vector/dynamic_vector.hpp"
+#include "../dynamic_vector/dynamic_vector.inl"
+#include "../kernels/elementwise.hpp"
+#include "../kernels/gemm.hpp"
+#include "../kernels/strassen.hpp"
+#include "../kernels/transpose.hpp"
+#include "../memory/scratch_arena.hpp"
+#include "../views/vector_view.hpp"
+#include "../views/matrix_view.hpp"
+#include "../decompositions/dynamic_lu_decomposition.hpp"
+#include "../decompositions/dynamic_lu_decomposition.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //applies element-wise kernel (n, x, y, out, parallel) on top left rows x columns part of row-major arrays
+    //if rows of all arrays are contiguous, kernel is applied once on whole data
+    template<class T, class TO, class TR, class F>
+    inline void dynamic_matrix_elementwise(size_t rows, size_t columns, const T* x, size_t ldx, const TO* y, size_t ldy, TR* out, size_t ldout, bool parallel, F&& kernel)
+    {
+        if (ldx == columns && ldy == columns && ldout == columns)
+        {
+            kernel(rows * columns, x, y, out, parallel);
+            return;
+        }
+
+        for (size_t row = 0; row < rows; row++)
+        {
+            kernel(columns, x + row * ldx, y + row * ldy, out + row * ldout, false);
+        }
+    }
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>::dynamic_matrix(const dynamic_matrix<TO>& other) :
+    _rows(other._rows),
+    _columns(other._columns),
+    _mat(other._mat.begin(), other._mat.end())
+{
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>& dynamic_matrix<T>::operator=(const dynamic_matrix<TO>& other)
+{
+    _rows = other._rows;
+    _columns = other._columns;
+    _mat.assign(other._mat.begin(), other._mat.end());
+    return *this;
+}
+
+template<class T>
+template<class TO, size_t N, size_t M, typename>
+dynamic_matrix<T>::dynamic_matrix(const matrix<TO, N, M>& other) :
+    _rows(N),
+    _columns(M),
+    _mat(other.begin(), other.end())
+{
+}
+
+template<class T>
+template<class TO, size_t N, size_t M, typename>
+dynamic_matrix<T>& dynamic_matrix<T>::operator=(const matrix<TO, N, M>& other)
+{
+    _rows = N;
+    _columns = M;
+    _mat.assign(other.begin(), other.end());
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>::dynamic_matrix(const matrix_view<TO>& other) :
+    _rows(other.rows()),
+    _columns(other.columns()),
+    _mat(other.rows() * other.columns())
+{
+    for (size_t row = 0; row < _rows; row++)
+    {
+        for (size_t column = 0; column < _columns; column++)
+        {
+            _mat[row * _columns + column] = static_cast<T>(other(row, column));
+        }
+    }
+}
+
+template<class T>
+dynamic_matrix<T>::dynamic_matrix(size_t rows, size_t columns) :
+    _rows(rows),
+    _columns(columns),
+    _mat(rows * columns, get_additive_identity<T>())
+{
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>::dynamic_matrix(size_t rows, size_t columns, const TO& v) :
+    _rows(rows),
+    _columns(columns),
+    _mat(rows * columns, static_cast<T>(v))
+{
+}
+
+template<class T>
+dynamic_matrix<T>::dynamic_matrix(std::initializer_list<std::initializer_list<T>> vs) :
+    _rows(vs.size()),
+    _columns(vs.size() != 0 ? vs.begin()->size() : 0)
+{
+    _mat.reserve(_rows * _columns);
+
+    for (const auto& row : vs)
+    {
+        assert(row.size() == _columns);
+        _mat.insert(_mat.end(), row.begin(), row.end());
+    }
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<addition_result_t<T, TO>> dynamic_matrix<T>::operator+(const dynamic_matrix<TO>& other) const
+{
+    dynamic_matrix<addition_result_t<T, TO>> result(std::min(_rows, other._rows), std::min(_columns, other._columns));
+
+    detail::dynamic_matrix_elementwise(result._rows, result._columns, data(), _columns, other.data(), other._columns, result.data(), result._columns, detail::parallel_elementwise(result._mat.size()),
+        [](size_t n, const auto* x, const auto* y, auto* out, bool parallel) { detail::elementwise_add(n, x, y, out, parallel); });
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<subtraction_result_t<T, TO>> dynamic_matrix<T>::operator-(const dynamic_matrix<TO>& other) const
+{
+    dynamic_matrix<subtraction_result_t<T, TO>> result(std::min(_rows, other._rows), std::min(_columns, other._columns));
+
+    detail::dynamic_matrix_elementwise(result._rows, result._columns, data(), _columns, other.data(), other._columns, result.data(), result._columns, detail::parallel_elementwise(result._mat.size()),
+        [](size_t n, const auto* x, const auto* y, auto* out, bool parallel) { detail::elementwise_subtract(n, x, y, out, parallel); });
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<inner_product_result_t<T, TO>> dynamic_matrix<T>::operator*(const dynamic_matrix<TO>& other) const
+{
+    dynamic_matrix<inner_product_result_t<T, TO>> result(_rows, other._columns);
+
+    dynamic_matrix<inner_product_result_t<T, TO>>::multiply_add(
+        get_multiplicative_identity<inner_product_result_t<T, TO>>(), *this, other,
+        get_additive_identity<inner_product_result_t<T, TO>>(), result
+    );
+
+    return result;
+}
+
+template<class T>
+template<class TA, class TB, class TS>
+void dynamic_matrix<T>::multiply_add(const TS& alpha, const dynamic_matrix<TA>& a, const dynamic_matrix<TB>& b, const TS& beta, dynamic_matrix<T>& result)
+{
+    assert(a._columns == b._rows && result._rows == a._rows && result._columns == b._columns);
+
+    if constexpr (detail::use_strassen_v<TA, TB, T>)
+    {
+        const strassen_settings settings = get_strassen_settings();
+        if (detail::use_strassen(settings, a._rows, b._columns, a._columns))
+        {
+            detail::strassen_multiply_add<T>(a._rows, b._columns, a._columns, static_cast<T>(alpha), a.data(), a._columns, b.data(), b._columns, static_cast<T>(beta), result.data(), result._columns, detail::parallel_gemm(a._rows, b._columns, a._columns), settings.crossover);
+            return;
+        }
+    }
+
+    detail::multiply_add(a._rows, b._columns, a._columns, alpha, a.data(), a._columns, 1, b.data(), b._columns, 1, beta, result.data(), result._columns, 1, a.is_big_matrix() || b.is_big_matrix());
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>& dynamic_matrix<T>::operator+=(const dynamic_matrix<TO>& other)
+{
+    detail::dynamic_matrix_elementwise(std::min(_rows, other._rows), std::min(_columns, other._columns), data(), _columns, other.data(), other._columns, data(), _columns, detail::parallel_elementwise(_mat.size()),
+        [](size_t n, const auto* x, const auto* y, auto* out, bool parallel) { detail::elementwise_add(n, x, y, out, parallel); });
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>& dynamic_matrix<T>::operator-=(const dynamic_matrix<TO>& other)
+{
+    detail::dynamic_matrix_elementwise(std::min(_rows, other._rows), std::min(_columns, other._columns), data(), _columns, other.data(), other._columns, data(), _columns, detail::parallel_elementwise(_mat.size()),
+        [](size_t n, const auto* x, const auto* y, auto* out, bool parallel) { detail::elementwise_subtract(n, x, y, out, parallel); });
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>& dynamic_matrix<T>::operator*=(const dynamic_matrix<TO>& other)
+{
+    *this = *this * other;
+    return *this;
+}
+
+template<class T>
+dynamic_matrix<T> dynamic_matrix<T>::operator-() const
+{
+    dynamic_matrix<T> result(_rows, _columns);
+
+    detail::elementwise_negate(_mat.size(), data(), result.data(), detail::parallel_elementwise(_mat.size()));
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<multiplication_result_t<T, TO>> dynamic_matrix<T>::operator*(const TO& v) const
+{
+    dynamic_matrix<multiplication_result_t<T, TO>> result(_rows, _columns);
+
+    detail::elementwise_scale(_mat.size(), data(), v, result.data(), detail::parallel_elementwise(_mat.size()));
+
+    return result;
+}
+
+template<class T, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+dynamic_matrix<multiplication_result_t<T, TO>> operator*(const TO& v, const dynamic_matrix<T>& matrix)
+{
+    return matrix * v;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<division_result_t<T, TO>> dynamic_matrix<T>::operator/(const TO& v) const
+{
+    dynamic_matrix<division_result_t<T, TO>> result(_rows, _columns);
+
+    detail::elementwise_divide(_mat.size(), data(), v, result.data(), detail::parallel_elementwise(_mat.size()));
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>& dynamic_matrix<T>::operator*=(const TO& v)
+{
+    detail::elementwise_scale(_mat.size(), data(), v, data(), detail::parallel_elementwise(_mat.size()));
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<T>& dynamic_matrix<T>::operator/=(const TO& v)
+{
+    detail::elementwise_divide(_mat.size(), data(), v, data(), detail::parallel_elementwise(_mat.size()));
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<inner_product_result_t<T, TO>> dynamic_matrix<T>::operator*(const dynamic_vector<TO>& vec) const
+{
+    assert(vec.size() == _columns);
+
+    using result_type = inner_product_result_t<T, TO>;
+
+    dynamic_vector<result_type> result(_rows);
+
+    //vector is treated as single column matrix
+    detail::multiply_add(_rows, 1, _columns, get_multiplicative_identity<result_type>(), data(), _columns, 1, vec.data(), 1, 1, get_additive_identity<result_type>(), result.data(), 1, 1, is_big_matrix());
+
+    return result;
+}
+
+template<class T>
+size_t dynamic_matrix<T>::rows() const
+{
+    return _rows;
+}
+
+template<class T>
+size_t dynamic_matrix<T>::columns() const
+{
+    return _columns;
+}
+
+template<class T>
+bool dynamic_matrix<T>::is_big_matrix() const
+{
+    return _mat.size() * sizeof(T) >= static_storage_max_size;
+}
+
+template<class T>
+T* dynamic_matrix<T>::operator[](size_t x)
+{
+    return _mat.data() + x * _columns;
+}
+
+template<class T>
+const T* dynamic_matrix<T>::operator[](size_t x) const
+{
+    return _mat.data() + x * _columns;
+}
+
+template<class T>
+T* dynamic_matrix<T>::data()
+{
+    return _mat.data();
+}
+
+template<class T>
+const T* dynamic_matrix<T>::data() const
+{
+    return _mat.data();
+}
+
+template<class T>
+T* dynamic_matrix<T>::begin()
+{
+    return _mat.data();
+}
+
+template<class T>
+const T* dynamic_matrix<T>::begin() const
+{
+    return _mat.data();
+}
+
+template<class T>
+T* dynamic_matrix<T>::end()
+{
+    return _mat.data() + _mat.size();
+}
+
+template<class T>
+const T* dynamic_matrix<T>::end() const
+{
+    return _mat.data() + _mat.size();
+}
+
+template<class T>
+matrix_view<T> dynamic_matrix<T>::view()
+{
+    return matrix_view<T>(*this);
+}
+
+template<class T>
+matrix_view<const T> dynamic_matrix<T>::view() const
+{
+    return matrix_view<const T>(*this);
+}
+
+template<class T>
+matrix_view<T> dynamic_matrix<T>::block(size_t row, size_t column, size_t rows, size_t columns)
+{
+    return view().block(row, column, rows, columns);
+}
+
+template<class T>
+matrix_view<const T> dynamic_matrix<T>::block(size_t row, size_t column, size_t rows, size_t columns) const
+{
+    return view().block(row, column, rows, columns);
+}
+
+template<class T>
+template<size_t R, size_t C>
+matrix_view<T> dynamic_matrix<T>::block(size_t row, size_t column)
+{
+    return view().template block<R, C>(row, column);
+}
+
+template<class T>
+template<size_t R, size_t C>
+matrix_view<const T> dynamic_matrix<T>::block(size_t row, size_t column) const
+{
+    return view().template block<R, C>(row, column);
+}
+
+template<class T>
+vector_view<T> dynamic_matrix<T>::row(size_t row)
+{
+    return view().row(row);
+}
+
+template<class T>
+vector_view<const T> dynamic_matrix<T>::row(size_t row) const
+{
+    return view().row(row);
+}
+
+template<class T>
+vector_view<T> dynamic_matrix<T>::column(size_t column)
+{
+    return view().column(column);
+}
+
+template<class T>
+vector_view<const T> dynamic_matrix<T>::column(size_t column) const
+{
+    return view().column(column);
+}
+
+template<class T>
+vector_view<T> dynamic_matrix<T>::diagonal()
+{
+    return view().diagonal();
+}
+
+template<class T>
+vector_view<const T> dynamic_matrix<T>::diagonal() const
+{
+    return view().diagonal();
+}
+
+template<class T>
+template<size_t N, size_t M>
+matrix<T, N, M> dynamic_matrix<T>::to_matrix() const
+{
+    matrix<T, N, M> result;
+
+    for (size_t row = 0; row < std::min(N, _rows); row++)
+    {
+        std::copy((*this)[row], (*this)[row] + std::min(M, _columns), result[row]);
+    }
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+bool dynamic_matrix<T>::operator==(const dynamic_matrix<TO>& other) const
+{
+    if (_rows != other._rows || _columns != other._columns)
+    {
+        return false;
+    }
+
+    for (size_t index = 0; index < _mat.size(); index++)
+    {
+        if (!equal(other._mat[index], _mat[index]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<class T>
+template<class TO, typename>
+bool dynamic_matrix<T>::operator!=(const dynamic_matrix<TO>& other) const
+{
+    if (_rows != other._rows || _columns != other._columns)
+    {
+        return true;
+    }
+
+    for (size_t index = 0; index < _mat.size(); index++)
+    {
+        if (inequal(other._mat[index], _mat[index]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<class T>
+T dynamic_matrix<T>::determinant() const
+{
+    detail::scratch_temporaries scratch;
+    return dynamic_lu_decomposition<T>(*this).determinant();
+}
+
+template<class T>
+std::optional<dynamic_matrix<T>> dynamic_matrix<T>::inverted() const
+{
+    //identity (result) is allocated before scratch scope, factors are temporaries
+    auto identity = dynamic_matrix<T>::identity(_rows);
+
+    detail::scratch_temporaries scratch;
+    return dynamic_lu_decomposition<T>(*this).solve(std::move(identity));
+}
+
+template<class T>
+size_t dynamic_matrix<T>::rank() const
+{
+    //gaussian elimination to row echelon form, rank is number of non-zero pivots
+    detail::scratch_temporaries scratch;
+    auto copy = *this;
+
+    //elements smaller than rounding error of elimination are treated as 0
+    auto is_zero = [&, tolerance = get_additive_identity<T>()](const T& value) mutable {
+        if constexpr (has_abs_implementation_v<T> && has_epsilon_implementation_v<T>)
+        {
+            if (tolerance == get_additive_identity<T>())
+            {
+                for (const T& element : _mat)
+                {
+                    tolerance = std::max(tolerance, functions_implementation<T>::abs(element));
+                }
+                tolerance *= functions_implementation<T>::epsilon() * static_cast<T>(std::max(_rows, _columns));
+            }
+
+            return functions_implementation<T>::abs(value) <= tolerance;
+        }
+        else
+        {
+            return equal(value, get_additive_identity<T>());
+        }
+    };
+
+    size_t rank = 0;
+
+    for (size_t column = 0; column < _columns && rank < _rows; column++)
+    {
+        //finding pivot in current column (largest one if absolute value is available)
+        size_t pivot_row = _rows;
+
+        for (size_t row = rank; row < _rows; row++)
+        {
+            if (is_zero(copy[row][column]))
+            {
+                continue;
+            }
+
+            if constexpr (has_abs_implementation_v<T>)
+            {
+                if (pivot_row == _rows || functions_implementation<T>::abs(copy[row][column]) > functions_implementation<T>::abs(copy[pivot_row][column]))
+                {
+                    pivot_row = row;
+                }
+            }
+            else
+            {
+                pivot_row = row;
+                break;
+            }
+        }
+
+        if (pivot_row == _rows)
+        {
+            //there is no non-zero element in this column
+            continue;
+        }
+
+        std::swap_ranges(copy[rank] + column, copy[rank] + _columns, copy[pivot_row] + column);
+
+        for (size_t row = rank + 1; row < _rows; row++)
+        {
+            const T factor = copy[row][column] / copy[rank][column];
+
+            for (size_t c = column; c < _columns; c++)
+            {
+                copy[row][c] -= copy[rank][c] * factor;
+            }
+        }
+
+        rank++;
+    }
+
+    return rank;
+}
+
+template<class T>
+dynamic_matrix<T> dynamic_matrix<T>::transposed() const
+{
+    dynamic_matrix<T> result(_columns, _rows);
+
+    detail::transpose_matrix(_rows, _columns, data(), _columns, result.data(), _rows, detail::parallel_copy(_mat.size() * sizeof(T)));
+
+    return result;
+}
+
+template<class T>
+dynamic_matrix<T>& dynamic_matrix<T>::transpose()
+{
+    if (_rows == _columns)
+    {
+        detail::transpose_in_place(_rows, data(), _columns, detail::parallel_copy(_mat.size() * sizeof(T)));
+    }
+    else
+    {
+        *this = transposed();
+    }
+
+    return *this;
+}
+
+template<class T>
+dynamic_matrix<T> dynamic_matrix<T>::identity(size_t n)
+{
+    dynamic_matrix<T> result(n, n);
+
+    for (size_t diagonal = 0; diagonal < n; diagonal++)
+    {
+        result[diagonal][diagonal] = get_multiplicative_identity<T>();
+    }
+
+    return result;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
+
+template<class TO>
+std::ostream& operator<<(std::ostream& os, const dynamic_matrix<TO>& m)
+{
+    for (size_t row = 0; row < m._rows; row++)
+    {
+        for (size_t column = 0; column < m._columns; column++)
+        {
+            os << m[row][column] << (column + 1 < m._columns ? ",\t" : "");
+        }
+
+        if (row + 1 < m._rows)
+        {
+            os << std::endl;
+        }
+    }
+
+    return os;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_IO_END
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+#include "../vector/vector.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
+
+template<class TO>
+std::ostream& operator<<(std::ostream& os, const dynamic_vector<TO>& v);
+
+NAMESPACE_LINEAR_ALGEBRA_IO_END
+
+///<summary>
+/// vector with dimension given at runtime
+/// <para>uses the same element-wise kernels as vector, only one class is instantiated for every dimension</para>
+/// <para>binary operations on vectors of different dimensions behave as for vector (result has smaller dimension)</para>
+///</summary>
+template<class T>
+class dynamic_vector
+{
+    static_assert(is_valid_mathematical_field_v<T>, "Vector element type must satisfy valid_mathematical_field concept!");
+
+    template<class TO>
+    friend class dynamic_vector;
+    template<class TO>
+    friend class dynamic_matrix;
+private:
+    detail::storage_vector<T> _coords;
+public:
+    using mathematical_field_type = T;
+public:
+    //default constructor (vector of dimension 0)
+
+    dynamic_vector() = default;
+
+    //copy, move constructors and operators
+
+    dynamic_vector(const dynamic_vector<T>& other) = default;
+
+    dynamic_vector(dynamic_vector<T>&& other) = default;
+
+    dynamic_vector<T>& operator=(const dynamic_vector<T>& other) = default;
+
+    dynamic_vector<T>& operator=(dynamic_vector<T>&& other) = default;
+
+    //different type
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector(const dynamic_vector<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector<T>& operator=(const dynamic_vector<TO>& other);
+
+    //from vector with dimension known at compile time
+
+    template<class TO, size_t D, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector(const vector<TO, D>& other);
+
+    template<class TO, size_t D, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector<T>& operator=(const vector<TO, D>& other);
+
+    //copies coordinates of view (e.g to pass row or column of matrix to decompositions)
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<std::remove_const_t<TO>, T>>>
+    dynamic_vector(const vector_view<TO>& other);
+
+    //regular constructors
+
+    //all coordinates are 0
+    explicit dynamic_vector(size_t dimension);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector(size_t dimension, const TO& v);
+
+    dynamic_vector(std::initializer_list<T> init_list);
+public:
+    //vector-vector operators
+
+    template<class TO, typename = typename std::enable_if_t<can_be_added_v<T, TO>>>
+    dynamic_vector<addition_result_t<T, TO>> operator+(const dynamic_vector<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_subtracted_v<T, TO>>>
+    dynamic_vector<subtraction_result_t<T, TO>> operator-(const dynamic_vector<TO>& other) const;
+
+    //shortcut for inner product
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<T, TO>>>
+    inner_product_result_t<T, TO> operator*(const dynamic_vector<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector<T>& operator+=(const dynamic_vector<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector<T>& operator-=(const dynamic_vector<TO>& other);
+
+    //vector-scalar operators
+
+    dynamic_vector<T> operator-() const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+    dynamic_vector<multiplication_result_t<T, TO>> operator*(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_divided_v<T, TO> && std::is_convertible_v<TO, T>>>
+    dynamic_vector<division_result_t<T, TO>> operator/(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector<T>& operator*=(const TO& v);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    dynamic_vector<T>& operator/=(const TO& v);
+public:
+    //vector info and accessors
+
+    size_t size() const;
+    size_t dimension() const;
+
+    //new coordinates are 0
+    void resize(size_t dimension);
+
+    //big vectors use same storage rule as vector (parallelization is decided by parallel_thresholds)
+    bool is_big_vector() const;
+
+    T& operator[](size_t d);
+    const T& operator[](size_t d) const;
+
+    T* data();
+    const T* data() const;
+
+    T* begin();
+    const T* begin() const;
+
+    T* end();
+    const T* end() const;
+
+    //view of vector memory (no coordinates are copied, view must not outlive vector)
+
+    vector_view<T> view();
+    vector_view<const T> view() const;
+
+    //copies first min(D, dimension()) coordinates to vector with dimension known at compile time
+    template<size_t D>
+    vector<T, D> to_vector() const;
+public:
+    //comparison operators
+
+    //vectors are equal only if they have the same dimension and all coordinates are equal
+
+    template<class TO, typename = typename std::enable_if_t<use_high_quality_equality_comparison ? high_quality_equality_comparable_v<T, TO> || equality_comparable_v<T, TO> : equality_comparable_v<T, TO>>>
+    bool operator==(const dynamic_vector<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<use_high_quality_equality_comparison ? high_quality_inequality_comparable_v<T, TO> || inequality_comparable_v<T, TO> : inequality_comparable_v<T, TO>>>
+    bool operator!=(const dynamic_vector<TO>& other) const;
+public:
+    template<typename = typename std::enable_if_t<has_sqrt_implementation_v<T>>>
+    T magnitude() const;
+    template<typename = typename std::enable_if_t<has_sqrt_implementation_v<T>>>
+    T length() const;
+
+    T magnitude_sqr() const;
+    T length_sqr() const;
+
+    template<typename = typename std::enable_if_t<has_sqrt_implementation_v<T>>>
+    dynamic_vector<T> normalized() const;
+    template<typename = typename std::enable_if_t<has_sqrt_implementation_v<T>>>
+    dynamic_vector<T>& normalize();
+
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<T, TO>>>
+    inner_product_result_t<T, TO> inner_product(const dynamic_vector<TO>& other) const;
+public:
+    template<class TO>
+    friend std::ostream& LINEAR_ALGEBRA_IO::operator<<(std::ostream& os, const dynamic_vector<TO>& v);
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
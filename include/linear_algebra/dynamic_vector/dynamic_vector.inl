@@ -0,0 +1,368 @@
+#pragma once
+
+#include "dynamic_vector.hpp"
+#include "../vector/vector.inl"
+#include "../kernels/elementwise.hpp"
+#include "../views/vector_view.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<T>::dynamic_vector(const dynamic_vector<TO>& other) :
+    _coords(other._coords.begin(), other._coords.end())
+{
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<T>& dynamic_vector<T>::operator=(const dynamic_vector<TO>& other)
+{
+    _coords.assign(other._coords.begin(), other._coords.end());
+    return *this;
+}
+
+template<class T>
+template<class TO, size_t D, typename>
+dynamic_vector<T>::dynamic_vector(const vector<TO, D>& other) :
+    _coords(other.begin(), other.end())
+{
+}
+
+template<class T>
+template<class TO, size_t D, typename>
+dynamic_vector<T>& dynamic_vector<T>::operator=(const vector<TO, D>& other)
+{
+    _coords.assign(other.begin(), other.end());
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<T>::dynamic_vector(const vector_view<TO>& other) :
+    _coords(other.size())
+{
+    for (size_t d = 0; d < other.size(); d++)
+    {
+        _coords[d] = static_cast<T>(other[d]);
+    }
+}
+
+template<class T>
+dynamic_vector<T>::dynamic_vector(size_t dimension) :
+    _coords(dimension, get_additive_identity<T>())
+{
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<T>::dynamic_vector(size_t dimension, const TO& v) :
+    _coords(dimension, static_cast<T>(v))
+{
+}
+
+template<class T>
+dynamic_vector<T>::dynamic_vector(std::initializer_list<T> init_list) :
+    _coords(init_list)
+{
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<addition_result_t<T, TO>> dynamic_vector<T>::operator+(const dynamic_vector<TO>& other) const
+{
+    dynamic_vector<addition_result_t<T, TO>> result(std::min(size(), other.size()));
+
+    detail::elementwise_add(result.size(), data(), other.data(), result.data(), detail::parallel_elementwise(result.size()));
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<subtraction_result_t<T, TO>> dynamic_vector<T>::operator-(const dynamic_vector<TO>& other) const
+{
+    dynamic_vector<subtraction_result_t<T, TO>> result(std::min(size(), other.size()));
+
+    detail::elementwise_subtract(result.size(), data(), other.data(), result.data(), detail::parallel_elementwise(result.size()));
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+inner_product_result_t<T, TO> dynamic_vector<T>::operator*(const dynamic_vector<TO>& other) const
+{
+    return inner_product(other);
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<T>& dynamic_vector<T>::operator+=(const dynamic_vector<TO>& other)
+{
+    detail::elementwise_add(std::min(size(), other.size()), data(), other.data(), data(), detail::parallel_elementwise(size()));
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<T>& dynamic_vector<T>::operator-=(const dynamic_vector<TO>& other)
+{
+    detail::elementwise_subtract(std::min(size(), other.size()), data(), other.data(), data(), detail::parallel_elementwise(size()));
+    return *this;
+}
+
+template<class T>
+dynamic_vector<T> dynamic_vector<T>::operator-() const
+{
+    dynamic_vector<T> result(size());
+
+    detail::elementwise_negate(size(), data(), result.data(), detail::parallel_elementwise(size()));
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<multiplication_result_t<T, TO>> dynamic_vector<T>::operator*(const TO& v) const
+{
+    dynamic_vector<multiplication_result_t<T, TO>> result(size());
+
+    detail::elementwise_scale(size(), data(), v, result.data(), detail::parallel_elementwise(size()));
+
+    return result;
+}
+
+template<class T, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+dynamic_vector<multiplication_result_t<T, TO>> operator*(const TO& v, const dynamic_vector<T>& vector)
+{
+    return vector * v;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<division_result_t<T, TO>> dynamic_vector<T>::operator/(const TO& v) const
+{
+    dynamic_vector<division_result_t<T, TO>> result(size());
+
+    detail::elementwise_divide(size(), data(), v, result.data(), detail::parallel_elementwise(size()));
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<T>& dynamic_vector<T>::operator*=(const TO& v)
+{
+    detail::elementwise_scale(size(), data(), v, data(), detail::parallel_elementwise(size()));
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<T>& dynamic_vector<T>::operator/=(const TO& v)
+{
+    detail::elementwise_divide(size(), data(), v, data(), detail::parallel_elementwise(size()));
+    return *this;
+}
+
+template<class T>
+size_t dynamic_vector<T>::size() const
+{
+    return _coords.size();
+}
+
+template<class T>
+size_t dynamic_vector<T>::dimension() const
+{
+    return _coords.size();
+}
+
+template<class T>
+void dynamic_vector<T>::resize(size_t dimension)
+{
+    _coords.resize(dimension, get_additive_identity<T>());
+}
+
+template<class T>
+bool dynamic_vector<T>::is_big_vector() const
+{
+    return size() * sizeof(T) >= static_storage_max_size;
+}
+
+template<class T>
+T& dynamic_vector<T>::operator[](size_t d)
+{
+    return _coords[d];
+}
+
+template<class T>
+const T& dynamic_vector<T>::operator[](size_t d) const
+{
+    return _coords[d];
+}
+
+template<class T>
+T* dynamic_vector<T>::data()
+{
+    return _coords.data();
+}
+
+template<class T>
+const T* dynamic_vector<T>::data() const
+{
+    return _coords.data();
+}
+
+template<class T>
+T* dynamic_vector<T>::begin()
+{
+    return _coords.data();
+}
+
+template<class T>
+const T* dynamic_vector<T>::begin() const
+{
+    return _coords.data();
+}
+
+template<class T>
+T* dynamic_vector<T>::end()
+{
+    return _coords.data() + _coords.size();
+}
+
+template<class T>
+const T* dynamic_vector<T>::end() const
+{
+    return _coords.data() + _coords.size();
+}
+
+template<class T>
+vector_view<T> dynamic_vector<T>::view()
+{
+    return vector_view<T>(*this);
+}
+
+template<class T>
+vector_view<const T> dynamic_vector<T>::view() const
+{
+    return vector_view<const T>(*this);
+}
+
+template<class T>
+template<size_t D>
+vector<T, D> dynamic_vector<T>::to_vector() const
+{
+    vector<T, D> result;
+
+    std::copy(begin(), begin() + std::min(D, size()), result.begin());
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+bool dynamic_vector<T>::operator==(const dynamic_vector<TO>& other) const
+{
+    if (size() != other.size())
+    {
+        return false;
+    }
+
+    for (size_t d = 0; d < size(); d++)
+    {
+        if (!equal(other._coords[d], _coords[d]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<class T>
+template<class TO, typename>
+bool dynamic_vector<T>::operator!=(const dynamic_vector<TO>& other) const
+{
+    if (size() != other.size())
+    {
+        return true;
+    }
+
+    for (size_t d = 0; d < size(); d++)
+    {
+        if (inequal(other._coords[d], _coords[d]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template<class T>
+template<typename>
+T dynamic_vector<T>::magnitude() const
+{
+    return functions_implementation<T>::sqrt(magnitude_sqr());
+}
+
+template<class T>
+template<typename>
+T dynamic_vector<T>::length() const
+{
+    return magnitude();
+}
+
+template<class T>
+T dynamic_vector<T>::magnitude_sqr() const
+{
+    return detail::elementwise_dot(size(), data(), data());
+}
+
+template<class T>
+T dynamic_vector<T>::length_sqr() const
+{
+    return magnitude_sqr();
+}
+
+template<class T>
+template<typename>
+dynamic_vector<T> dynamic_vector<T>::normalized() const
+{
+    return *this / length();
+}
+
+template<class T>
+template<typename>
+dynamic_vector<T>& dynamic_vector<T>::normalize()
+{
+    *this /= length();
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+inner_product_result_t<T, TO> dynamic_vector<T>::inner_product(const dynamic_vector<TO>& other) const
+{
+    return detail::elementwise_dot(std::min(size(), other.size()), data(), other.data());
+}
+
+NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
+
+template<class TO>
+std::ostream& operator<<(std::ostream& os, const dynamic_vector<TO>& v)
+{
+    os << "(";
+    for (size_t d = 0; d < v.size(); d++)
+    {
+        os << v._coords[d] << (d + 1 < v.size() ? ", " : "");
+    }
+    os << ")";
+    return os;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_IO_END
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -4,6 +4,11 @@
 #include "../matrix/matrix.inl"
 #include "../vector/vector.hpp"
 #include "../vector/vector.inl"
+#include "../decompositions/lu_decomposition.hpp"
+#include "../decompositions/lu_decomposition.inl"
+#include "../decompositions/singular_value_decomposition.hpp"
+#include "../decompositions/singular_value_decomposition.inl"
+#include "../memory/scratch_arena.hpp"
 
 NAMESPACE_LINEAR_ALGEBRA_BEGIN
 
@@ -228,12 +233,28 @@ public:
 /// <para>if equation system is contradictory returns nullopt</para>
 /// <para>if equation system is indeterminate returns constant shift vector and set of vectors creating infinite solution set</para>
 /// <para>if equation system is determinate returns solution</para>
+/// <para>(overdetermined systems which are not exactly consistent are contradictory, see least_squares)</para>
 ///</summary>
 /// <param name="coefficents"> linear equation system coefficents represented in NxM matrix </param>
 /// <param name="constant_terms"> linear equation system constant terms </param>
 template<class T, size_t N, size_t M>
 equation_system_solution<T, M> solve_equation_system(const matrix<T, N, M>& coefficents, const vector<T, N>& constant_terms)
 {
+    //copies of coefficents and factors are temporaries, solution vectors are allocated with resource of caller
+    detail::scratch_temporaries scratch;
+
+    if constexpr (N == M)
+    {
+        //square system with non-singular coefficents matrix has unique solution which can be obtained from LU factors,
+        //elimination below is needed only to classify singular systems
+        lu_decomposition<T, N> lu(coefficents);
+        if (!lu.is_singular())
+        {
+            storage_resource_scope solution_storage(scratch.outer_resource());
+            return equation_system_solution<T, M>(std::move(*lu.solve(constant_terms)));
+        }
+    }
+
     auto copy = coefficents;
     auto copy_terms = constant_terms;
 
@@ -245,6 +266,10 @@ equation_system_solution<T, M> solve_equation_system(const matrix<T, N, M>& coef
     size_t column_shift = 0;
     for (size_t diag = 0; diag < D; diag++)
     {
+        //pivot columns of previous rows may already reach last column (remaining rows are zero)
+        if (diag + column_shift >= M)
+            break;
+
         bool no_non_zero = false;
 
         while (equal(copy[diag][diag + column_shift], static_cast<T>(0)))
@@ -283,82 +308,16 @@ equation_system_solution<T, M> solve_equation_system(const matrix<T, N, M>& coef
 
         T factor = copy[diag][diag + column_shift];
 
-#if USE_OPENMP
-        if (copy.is_big_matrix)
-        {
-            for (size_t column = diag + column_shift; column < M; column++)
-            {
-                copy[diag][column] /= factor;
-            }
-            copy_terms[diag] /= factor;
-
-#pragma omp parallel for
-            for (int reduced_row = 0; reduced_row < static_cast<int>(diag); reduced_row++)
-            {
-                T factor = copy._mat[reduced_row][diag + column_shift] / copy._mat[diag][diag + column_shift];
-                for (size_t column = diag + column_shift; column < M; column++)
-                {
-                    copy._mat[reduced_row][column] -= copy._mat[diag][column] * factor;
-                }
-
-                copy_terms[reduced_row] -= copy_terms[diag] * factor;
-            }
-
-#pragma omp parallel for
-            for (int reduced_row = static_cast<int>(diag + 1); reduced_row < static_cast<int>(N); reduced_row++)
-            {
-
-                T factor = copy._mat[reduced_row][diag + column_shift] / copy._mat[diag][diag + column_shift];
-
-                for (size_t column = diag + column_shift; column < M; column++)
-                {
-                    copy._mat[reduced_row][column] -= copy._mat[diag][column] * factor;
-                }
-
-                copy_terms[reduced_row] -= copy_terms[diag] * factor;
-            }
-        }
-        else
-        {
-            for (size_t column = diag + column_shift; column < M; column++)
-            {
-                copy[diag][column] /= factor;
-            }
-            copy_terms[diag] /= factor;
-
-            for (size_t reduced_row = 0; reduced_row < diag; reduced_row++)
-            {
-                T factor = copy._mat[reduced_row][diag + column_shift] / copy._mat[diag][diag + column_shift];
-                for (size_t column = diag + column_shift; column < M; column++)
-                {
-                    copy._mat[reduced_row][column] -= copy._mat[diag][column] * factor;
-                }
-
-                copy_terms[reduced_row] -= copy_terms[diag] * factor;
-            }
-
-            for (size_t reduced_row = diag + 1; reduced_row < N; reduced_row++)
-            {
-
-                T factor = copy._mat[reduced_row][diag + column_shift] / copy._mat[diag][diag + column_shift];
-
-                for (size_t column = diag + column_shift; column < M; column++)
-                {
-                    copy._mat[reduced_row][column] -= copy._mat[diag][column] * factor;
-                }
-
-                copy_terms[reduced_row] -= copy_terms[diag] * factor;
-            }
-        }
-#else
         for (size_t column = diag + column_shift; column < M; column++)
         {
             copy[diag][column] /= factor;
         }
         copy_terms[diag] /= factor;
 
-        for (size_t reduced_row = 0; reduced_row < diag; reduced_row++)
-        {
+        //every row except of diagonal one is reduced
+        const bool parallel = detail::parallel_elimination(N - 1, M - diag - column_shift);
+
+        detail::parallel_for(diag, parallel, [&](size_t reduced_row) {
             T factor = copy._mat[reduced_row][diag + column_shift] / copy._mat[diag][diag + column_shift];
             for (size_t column = diag + column_shift; column < M; column++)
             {
@@ -366,11 +325,9 @@ equation_system_solution<T, M> solve_equation_system(const matrix<T, N, M>& coef
             }
 
             copy_terms[reduced_row] -= copy_terms[diag] * factor;
-        }
-
-        for (size_t reduced_row = diag + 1; reduced_row < N; reduced_row++)
-        {
+        });
 
+        detail::parallel_for(diag + 1, N, parallel, [&](size_t reduced_row) {
             T factor = copy._mat[reduced_row][diag + column_shift] / copy._mat[diag][diag + column_shift];
 
             for (size_t column = diag + column_shift; column < M; column++)
@@ -379,10 +336,11 @@ equation_system_solution<T, M> solve_equation_system(const matrix<T, N, M>& coef
             }
 
             copy_terms[reduced_row] -= copy_terms[diag] * factor;
-        }
-#endif
+        });
     }
 
+    storage_resource_scope solution_storage(scratch.outer_resource());
+
     vector<T, M> constant_solution_vector;
 
     //there can be at max D finite solutions to equation system i.e if N >= M there is only M variables but
@@ -455,7 +413,7 @@ equation_system_solution<T, M> solve_equation_system(const matrix<T, N, M>& coef
     else
     {
         //system is indeterminate
-        return equation_system_solution<T, M>(std::move(constant_solution_vector), std::move(infinite_solution_vectors));
+        return equation_system_solution<T, M>(typename equation_system_solution<T, M>::indeterminate_solution(std::move(constant_solution_vector), std::move(infinite_solution_vectors)));
     }
 }
 
@@ -465,12 +423,28 @@ equation_system_solution<T, M> solve_equation_system(const matrix<T, N, M>& coef
 /// <para>if equation system is contradictory returns nullopt</para>
 /// <para>if equation system is indeterminate returns constant shift vector and set of vectors creating infinite solution set</para>
 /// <para>if equation system is determinate returns solution</para>
+/// <para>(overdetermined systems which are not exactly consistent are contradictory, see least_squares)</para>
 ///</summary>
 /// <param name="coefficents"> linear equation system coefficents represented in NxM matrix </param>
 /// <param name="constant_terms"> linear equation system constant terms </param>
 template<class T, size_t N, size_t M>
 equation_system_solution<T, M> solve_equation_system(matrix<T, N, M>&& coefficents, vector<T, N>&& constant_terms)
 {
+    //factors are temporaries, solution vectors are allocated with resource of caller
+    detail::scratch_temporaries scratch;
+
+    if constexpr (N == M)
+    {
+        //square system with non-singular coefficents matrix has unique solution which can be obtained from LU factors,
+        //elimination below is needed only to classify singular systems
+        lu_decomposition<T, N> lu(coefficents);
+        if (!lu.is_singular())
+        {
+            storage_resource_scope solution_storage(scratch.outer_resource());
+            return equation_system_solution<T, M>(std::move(*lu.solve(std::move(constant_terms))));
+        }
+    }
+
     constexpr size_t D = N > M ? M : N;
 
     //using gaussian elimination to obtain matrix in row
@@ -479,6 +453,10 @@ equation_system_solution<T, M> solve_equation_system(matrix<T, N, M>&& coefficen
     size_t column_shift = 0;
     for (size_t diag = 0; diag < D; diag++)
     {
+        //pivot columns of previous rows may already reach last column (remaining rows are zero)
+        if (diag + column_shift >= M)
+            break;
+
         bool no_non_zero = false;
 
         while (equal(coefficents[diag][diag + column_shift], static_cast<T>(0)))
@@ -517,82 +495,16 @@ equation_system_solution<T, M> solve_equation_system(matrix<T, N, M>&& coefficen
 
         T factor = coefficents[diag][diag + column_shift];
 
-#if USE_OPENMP
-        if (coefficents.is_big_matrix)
-        {
-            for (size_t column = diag + column_shift; column < M; column++)
-            {
-                coefficents[diag][column] /= factor;
-            }
-            constant_terms[diag] /= factor;
-
-#pragma omp parallel for
-            for (int reduced_row = 0; reduced_row < static_cast<int>(diag); reduced_row++)
-            {
-                T factor = coefficents._mat[reduced_row][diag + column_shift] / coefficents._mat[diag][diag + column_shift];
-                for (size_t column = diag + column_shift; column < M; column++)
-                {
-                    coefficents._mat[reduced_row][column] -= coefficents._mat[diag][column] * factor;
-                }
-
-                constant_terms[reduced_row] -= constant_terms[diag] * factor;
-            }
-
-#pragma omp parallel for
-            for (int reduced_row = static_cast<int>(diag + 1); reduced_row < static_cast<int>(N); reduced_row++)
-            {
-
-                T factor = coefficents._mat[reduced_row][diag + column_shift] / coefficents._mat[diag][diag + column_shift];
-
-                for (size_t column = diag + column_shift; column < M; column++)
-                {
-                    coefficents._mat[reduced_row][column] -= coefficents._mat[diag][column] * factor;
-                }
-
-                constant_terms[reduced_row] -= constant_terms[diag] * factor;
-            }
-        }
-        else
-        {
-            for (size_t column = diag + column_shift; column < M; column++)
-            {
-                coefficents[diag][column] /= factor;
-            }
-            constant_terms[diag] /= factor;
-
-            for (size_t reduced_row = 0; reduced_row < diag; reduced_row++)
-            {
-                T factor = coefficents._mat[reduced_row][diag + column_shift] / coefficents._mat[diag][diag + column_shift];
-                for (size_t column = diag + column_shift; column < M; column++)
-                {
-                    coefficents._mat[reduced_row][column] -= coefficents._mat[diag][column] * factor;
-                }
-
-                constant_terms[reduced_row] -= constant_terms[diag] * factor;
-            }
-
-            for (size_t reduced_row = diag + 1; reduced_row < N; reduced_row++)
-            {
-
-                T factor = coefficents._mat[reduced_row][diag + column_shift] / coefficents._mat[diag][diag + column_shift];
-
-                for (size_t column = diag + column_shift; column < M; column++)
-                {
-                    coefficents._mat[reduced_row][column] -= coefficents._mat[diag][column] * factor;
-                }
-
-                constant_terms[reduced_row] -= constant_terms[diag] * factor;
-            }
-        }
-#else
         for (size_t column = diag + column_shift; column < M; column++)
         {
             coefficents[diag][column] /= factor;
         }
         constant_terms[diag] /= factor;
 
-        for (size_t reduced_row = 0; reduced_row < diag; reduced_row++)
-        {
+        //every row except of diagonal one is reduced
+        const bool parallel = detail::parallel_elimination(N - 1, M - diag - column_shift);
+
+        detail::parallel_for(diag, parallel, [&](size_t reduced_row) {
             T factor = coefficents._mat[reduced_row][diag + column_shift] / coefficents._mat[diag][diag + column_shift];
             for (size_t column = diag + column_shift; column < M; column++)
             {
@@ -600,11 +512,9 @@ equation_system_solution<T, M> solve_equation_system(matrix<T, N, M>&& coefficen
             }
 
             constant_terms[reduced_row] -= constant_terms[diag] * factor;
-        }
-
-        for (size_t reduced_row = diag + 1; reduced_row < N; reduced_row++)
-        {
+        });
 
+        detail::parallel_for(diag + 1, N, parallel, [&](size_t reduced_row) {
             T factor = coefficents._mat[reduced_row][diag + column_shift] / coefficents._mat[diag][diag + column_shift];
 
             for (size_t column = diag + column_shift; column < M; column++)
@@ -613,10 +523,11 @@ equation_system_solution<T, M> solve_equation_system(matrix<T, N, M>&& coefficen
             }
 
             constant_terms[reduced_row] -= constant_terms[diag] * factor;
-        }
-#endif
+        });
     }
 
+    storage_resource_scope solution_storage(scratch.outer_resource());
+
     vector<T, M> constant_solution_vector;
 
     //there can be at max D finite solutions to equation system i.e if N >= M there is only M variables but
@@ -684,13 +595,133 @@ equation_system_solution<T, M> solve_equation_system(matrix<T, N, M>&& coefficen
     if (infinite_solution_vectors.empty())
     {
         //system is determinate
-        return equation_system_solution<T, M>(equation_system_solution<T, M>::determinate_solution(std::move(constant_solution_vector)));
+        return equation_system_solution<T, M>(typename equation_system_solution<T, M>::determinate_solution(std::move(constant_solution_vector)));
     }
     else
     {
         //system is indeterminate
-        return equation_system_solution<T, M>(equation_system_solution<T, M>::indeterminate_solution(std::move(constant_solution_vector), std::move(infinite_solution_vectors)));
+        return equation_system_solution<T, M>(typename equation_system_solution<T, M>::indeterminate_solution(std::move(constant_solution_vector), std::move(infinite_solution_vectors)));
     }
 }
 
+namespace detail
+{
+    //see solve_equation_system_svd, tolerance of singular values is default one of decomposition if it is not given
+    template<class T, size_t N, size_t M>
+    equation_system_solution<T, M> solve_equation_system_svd(const matrix<T, N, M>& coefficents, const vector<T, N>& constant_terms, const std::optional<T>& tolerance)
+    {
+        //decomposition is temporary, solution vectors are allocated with resource of caller
+        scratch_temporaries scratch;
+
+        //systems with less equations than variables are padded with zero equations,
+        //so right singular vectors span whole space of variables (vectors of negligible singular values span null space)
+        constexpr size_t P = N > M ? N : M;
+
+        matrix<T, P, M> padded;
+        vector<T, P> padded_terms;
+
+        for (size_t row = 0; row < N; row++)
+        {
+            for (size_t column = 0; column < M; column++)
+            {
+                padded[row][column] = coefficents[row][column];
+            }
+            padded_terms[row] = constant_terms[row];
+        }
+
+        const singular_value_decomposition<T, P, M> svd(std::move(padded));
+        const T singular_tolerance = tolerance ? *tolerance : svd.default_tolerance();
+        const size_t rank = svd.rank(singular_tolerance);
+
+        //minimum norm least squares solution, system is consistent if its residual is explained by
+        //neglected singular values and rounding errors of constant terms
+        const vector<T, M> least_squares_solution = svd.solve(padded_terms, singular_tolerance);
+
+        T residual_squared = get_additive_identity<T>();
+        T terms_squared = get_additive_identity<T>();
+        T solution_squared = get_additive_identity<T>();
+
+        for (size_t row = 0; row < N; row++)
+        {
+            T residual = -constant_terms[row];
+            for (size_t column = 0; column < M; column++)
+            {
+                residual += coefficents[row][column] * least_squares_solution[column];
+            }
+
+            residual_squared += residual * residual;
+            terms_squared += constant_terms[row] * constant_terms[row];
+        }
+
+        for (size_t column = 0; column < M; column++)
+        {
+            solution_squared += least_squares_solution[column] * least_squares_solution[column];
+        }
+
+        const T allowed_residual =
+            singular_tolerance * functions_implementation<T>::sqrt(solution_squared) +
+            static_cast<T>(P) * functions_implementation<T>::epsilon() * functions_implementation<T>::sqrt(terms_squared);
+
+        if (functions_implementation<T>::sqrt(residual_squared) > allowed_residual)
+        {
+            //system is contradictory
+            return equation_system_solution<T, M>();
+        }
+
+        storage_resource_scope solution_storage(scratch.outer_resource());
+
+        vector<T, M> constant_solution_vector(least_squares_solution);
+
+        if (rank == M)
+        {
+            //system is determinate
+            return equation_system_solution<T, M>(std::move(constant_solution_vector));
+        }
+
+        //system is indeterminate, every parameter moves solution along one of orthonormal vectors of null space
+        std::vector<vector<T, M>> infinite_solution_vectors(M - rank);
+
+        for (size_t parameter = 0; parameter < M - rank; parameter++)
+        {
+            for (size_t row = 0; row < M; row++)
+            {
+                infinite_solution_vectors[parameter][row] = svd.v()[row][rank + parameter];
+            }
+        }
+
+        return equation_system_solution<T, M>(typename equation_system_solution<T, M>::indeterminate_solution(std::move(constant_solution_vector), std::move(infinite_solution_vectors)));
+    }
+}
+
+///<summary>
+/// solves linear equations system (N equations, M variables) deciding its rank by singular values of coefficents
+/// <para>unlike solve_equation_system (which compares eliminated coefficents with exact zeros), rounding errors of dependent equations
+/// do not make them independent and rounding errors of consistent system do not make it contradictory</para>
+/// <para>singular values not larger than max(N, M) * epsilon * largest singular value are treated as zeros</para>
+/// <para>*** RESULTS ***</para>
+/// <para>if residual of least squares solution is larger than rounding errors of neglected singular values and constant terms, system is contradictory</para>
+/// <para>if equation system is indeterminate returns least squares solution with smallest norm and orthonormal vectors creating infinite solution set</para>
+/// <para>if equation system is determinate returns solution</para>
+///</summary>
+/// <param name="coefficents"> linear equation system coefficents represented in NxM matrix </param>
+/// <param name="constant_terms"> linear equation system constant terms </param>
+template<class T, size_t N, size_t M>
+equation_system_solution<T, M> solve_equation_system_svd(const matrix<T, N, M>& coefficents, const vector<T, N>& constant_terms)
+{
+    return detail::solve_equation_system_svd(coefficents, constant_terms, std::optional<T>());
+}
+
+///<summary>
+/// solves linear equations system (N equations, M variables) deciding its rank by singular values of coefficents
+/// (see solve_equation_system_svd), singular values not larger than tolerance (e.g expected error of coefficents) are treated as zeros
+///</summary>
+/// <param name="coefficents"> linear equation system coefficents represented in NxM matrix </param>
+/// <param name="constant_terms"> linear equation system constant terms </param>
+/// <param name="tolerance"> largest singular value treated as zero </param>
+template<class T, size_t N, size_t M>
+equation_system_solution<T, M> solve_equation_system_svd(const matrix<T, N, M>& coefficents, const vector<T, N>& constant_terms, const T& tolerance)
+{
+    return detail::solve_equation_system_svd(coefficents, constant_terms, std::optional<T>(tolerance));
+}
+
 NAMESPACE_LINEAR_ALGEBRA_END
\ No newline at end of file
@@ -0,0 +1,520 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../matrix/matrix.inl"
+#include "../dynamic_vector/dynamic_vector.hpp"
+#include "../dynamic_vector/dynamic_vector.inl"
+#include "../dynamic_matrix/dynamic_matrix.hpp"
+#include "../dynamic_matrix/dynamic_matrix.inl"
+#include "../sparse_matrix/sparse_matrix.hpp"
+#include "../sparse_matrix/sparse_matrix.inl"
+#include "preconditioners.hpp"
+#include "preconditioners.inl"
+#include "../kernels/gemm.hpp"
+#include "../kernels/krylov.hpp"
+
+#include <functional>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+/*
+    iterative (Krylov subspace) solvers of square linear equation systems A * x = b
+    A is linear operator: matrix<T, N, N>, dynamic_matrix<T>, sparse_matrix<T, L> or callable op(x, y) computing y = A * x
+    (matrix-free mode, operator is never materialized, y already has dimension of b)
+    every iteration costs one or two products with operator and few passes over vectors, so large sparse systems are solved
+    in O(iterations * non_zeros) instead of O(n^3) of direct elimination
+    preconditioners are objects with apply(r, z) computing z = M^-1 * r (see preconditioners.hpp) or callables p(r, z)
+*/
+
+///<summary>
+/// stopping criteria and options of iterative solvers
+///</summary>
+template<class T>
+struct iterative_solver_settings
+{
+    //solver stops when relative residual ||b - A * x|| / ||b|| is not larger than tolerance
+    T tolerance = functions_implementation<T>::sqrt(functions_implementation<T>::epsilon());
+    //solver stops after given number of iterations even if it has not converged
+    size_t max_iterations = 1000;
+    //dimension of Krylov subspace built by gmres before it is restarted (memory of gmres is (restart + 1) vectors)
+    size_t restart = 30;
+    //starting point of iterations (zero vector if empty)
+    dynamic_vector<T> initial_guess;
+    //called with iteration number and relative residual after every iteration (iteration 0 is initial guess), returning false stops solver
+    std::function<bool(size_t, const T&)> monitor;
+};
+
+///<summary>
+/// result of iterative solver
+///</summary>
+template<class T>
+struct iterative_solver_result
+{
+    //last iterate (approximate solution even if solver has not converged)
+    dynamic_vector<T> solution;
+    //true if relative residual of solution is not larger than tolerance
+    bool converged = false;
+    size_t iterations = 0;
+    //relative residual ||b - A * x|| / ||b|| of solution (as updated by solver)
+    T residual = get_additive_identity<T>();
+    //relative residual of initial guess followed by relative residual after every iteration
+    std::vector<T> residual_history;
+};
+
+namespace detail
+{
+    //y = A * x for operators accepted by iterative solvers
+
+    template<class T, class L>
+    inline void apply_linear_operator(const sparse_matrix<T, L>& a, const dynamic_vector<T>& x, dynamic_vector<T>& y)
+    {
+        a.multiply_add(get_multiplicative_identity<T>(), x, get_additive_identity<T>(), y);
+    }
+
+    template<class T>
+    inline void apply_linear_operator(const dynamic_matrix<T>& a, const dynamic_vector<T>& x, dynamic_vector<T>& y)
+    {
+        assert(a.columns() == x.size() && a.rows() == y.size());
+
+        multiply_add(a.rows(), 1, a.columns(), get_multiplicative_identity<T>(), a.data(), a.columns(), 1, x.data(), 1, 1, get_additive_identity<T>(), y.data(), 1, 1, a.is_big_matrix());
+    }
+
+    template<class T, size_t N>
+    inline void apply_linear_operator(const matrix<T, N, N>& a, const dynamic_vector<T>& x, dynamic_vector<T>& y)
+    {
+        assert(x.size() == N && y.size() == N);
+
+        multiply_add(N, 1, N, get_multiplicative_identity<T>(), a.data(), N, 1, x.data(), 1, 1, get_additive_identity<T>(), y.data(), 1, 1, matrix<T, N, N>::is_big_matrix);
+    }
+
+    template<class T, class F>
+    inline void apply_linear_operator(const F& a, const dynamic_vector<T>& x, dynamic_vector<T>& y)
+    {
+        static_assert(std::is_invocable_v<const F&, const dynamic_vector<T>&, dynamic_vector<T>&>, "Linear operator must be matrix, sparse_matrix or callable computing y = A * x from (x, y)!");
+
+        a(x, y);
+    }
+
+    template<class P, class T, class = void>
+    struct has_preconditioner_apply : std::false_type {};
+
+    template<class P, class T>
+    struct has_preconditioner_apply<P, T, std::void_t<decltype(std::declval<const P&>().apply(std::declval<const dynamic_vector<T>&>(), std::declval<dynamic_vector<T>&>()))>> : std::true_type {};
+
+    //z = M^-1 * r
+    template<class T, class P>
+    inline void apply_preconditioner(const P& p, const dynamic_vector<T>& r, dynamic_vector<T>& z)
+    {
+        if constexpr (has_preconditioner_apply<P, T>::value)
+        {
+            p.apply(r, z);
+        }
+        else
+        {
+            static_assert(std::is_invocable_v<const P&, const dynamic_vector<T>&, dynamic_vector<T>&>, "Preconditioner must have apply(r, z) or be callable computing z = M^-1 * r from (r, z)!");
+
+            p(r, z);
+        }
+    }
+
+    //state shared by iterative solvers: iterate, residual history and stopping criteria
+    template<class T>
+    class krylov_iteration
+    {
+    private:
+        const iterative_solver_settings<T>& _settings;
+        T _scale;
+        bool _stop_requested = false;
+    public:
+        iterative_solver_result<T> result;
+        const size_t n;
+        const bool parallel;
+    public:
+        //solution starts at initial guess, relative residuals are divided by ||b|| (absolute residuals are used if b is 0)
+        krylov_iteration(const dynamic_vector<T>& b, const iterative_solver_settings<T>& settings) :
+            _settings(settings),
+            n(b.size()),
+            parallel(parallel_elementwise(b.size()))
+        {
+            assert(settings.initial_guess.size() == 0 || settings.initial_guess.size() == n);
+
+            result.solution = settings.initial_guess.size() == 0 ? dynamic_vector<T>(n) : settings.initial_guess;
+
+            const T b_norm = norm(b);
+            _scale = equal(b_norm, get_additive_identity<T>()) ? get_multiplicative_identity<T>() : b_norm;
+        }
+
+        T dot(const dynamic_vector<T>& x, const dynamic_vector<T>& y) const
+        {
+            return krylov_dot(n, x.data(), y.data(), parallel);
+        }
+
+        T norm(const dynamic_vector<T>& x) const
+        {
+            return functions_implementation<T>::sqrt(krylov_dot(n, x.data(), x.data(), parallel));
+        }
+
+        //r = b - A * x (product is skipped for zero initial guess)
+        template<class A>
+        void residual(const A& op, const dynamic_vector<T>& b, dynamic_vector<T>& r, dynamic_vector<T>& work) const
+        {
+            if (_settings.initial_guess.size() == 0 && result.iterations == 0)
+            {
+                r = b;
+                return;
+            }
+
+            apply_linear_operator(op, result.solution, work);
+            krylov_subtract(n, b.data(), work.data(), r.data(), parallel);
+        }
+
+        //records residual norm after given iteration, returns false if solver should stop
+        bool report(size_t iteration, const T& residual_norm)
+        {
+            const T relative_residual = residual_norm / _scale;
+
+            result.iterations = iteration;
+            result.residual = relative_residual;
+            result.residual_history.push_back(relative_residual);
+            result.converged = relative_residual <= _settings.tolerance;
+
+            _stop_requested = _settings.monitor && !_settings.monitor(iteration, relative_residual);
+
+            return !result.converged && !_stop_requested && iteration < _settings.max_iterations;
+        }
+
+        //replaces residual norm recorded by last report (e.g by recomputed residual), returns false if solver should stop
+        //(monitor is not called again, but its request to stop made in last report is kept)
+        bool update(const T& residual_norm)
+        {
+            const T relative_residual = residual_norm / _scale;
+
+            result.residual = relative_residual;
+            result.residual_history.back() = relative_residual;
+            result.converged = relative_residual <= _settings.tolerance;
+
+            return !result.converged && !_stop_requested && result.iterations < _settings.max_iterations;
+        }
+
+        //true if residual norm satisfies tolerance (without recording it)
+        bool satisfies_tolerance(const T& residual_norm) const
+        {
+            return residual_norm / _scale <= _settings.tolerance;
+        }
+    };
+}
+
+///<summary>
+/// solves A * x = b for symmetric positive-definite operator by preconditioned conjugate gradient method
+/// <para>every iteration costs one product with operator and one application of preconditioner (which also must be symmetric positive-definite,
+/// e.g jacobi_preconditioner or ic0_preconditioner), in exact arithmetic solution is found in at most n iterations</para>
+/// <para>if operator turns out not to be positive-definite, iterations stop and result is not converged</para>
+///</summary>
+/// <param name="op"> symmetric positive-definite linear operator </param>
+/// <param name="b"> constant terms </param>
+/// <param name="preconditioner"> approximation M of A applied as z = M^-1 * r </param>
+/// <param name="settings"> stopping criteria, initial guess and convergence monitor </param>
+template<class A, class T, class P>
+iterative_solver_result<T> conjugate_gradient(const A& op, const dynamic_vector<T>& b, const P& preconditioner, const iterative_solver_settings<T>& settings = iterative_solver_settings<T>())
+{
+    static_assert(has_sqrt_implementation_v<T>, "Iterative solvers require square root of mathematical field!");
+
+    detail::krylov_iteration<T> iteration(b, settings);
+    const size_t n = iteration.n;
+    dynamic_vector<T>& x = iteration.result.solution;
+
+    dynamic_vector<T> r(n), z(n), p(n), q(n);
+
+    iteration.residual(op, b, r, q);
+
+    if (!iteration.report(0, iteration.norm(r)))
+    {
+        return std::move(iteration.result);
+    }
+
+    detail::apply_preconditioner(preconditioner, r, z);
+    p = z;
+    T rz = iteration.dot(r, z);
+
+    for (size_t k = 1;; k++)
+    {
+        detail::apply_linear_operator(op, p, q);
+
+        const T pq = iteration.dot(p, q);
+        if (!(pq > get_additive_identity<T>()))
+        {
+            //operator (or preconditioner) is not positive-definite
+            break;
+        }
+
+        const T alpha = rz / pq;
+        detail::krylov_axpy(n, alpha, p.data(), x.data(), iteration.parallel);
+        detail::krylov_axpy(n, -alpha, q.data(), r.data(), iteration.parallel);
+
+        if (!iteration.report(k, iteration.norm(r)))
+        {
+            break;
+        }
+
+        detail::apply_preconditioner(preconditioner, r, z);
+
+        const T rz_next = iteration.dot(r, z);
+        const T beta = rz_next / rz;
+        rz = rz_next;
+
+        detail::krylov_xpby(n, z.data(), beta, p.data(), iteration.parallel);
+    }
+
+    return std::move(iteration.result);
+}
+
+//conjugate gradient method without preconditioning
+template<class A, class T>
+iterative_solver_result<T> conjugate_gradient(const A& op, const dynamic_vector<T>& b, const iterative_solver_settings<T>& settings = iterative_solver_settings<T>())
+{
+    return conjugate_gradient(op, b, identity_preconditioner<T>(), settings);
+}
+
+///<summary>
+/// solves A * x = b for square (possibly nonsymmetric) operator by right-preconditioned stabilized biconjugate gradient method (BiCGSTAB)
+/// <para>every iteration costs two products with operator and two applications of preconditioner (e.g ilu0_preconditioner),
+/// memory does not grow with number of iterations (unlike gmres), but convergence is not monotone and may break down</para>
+/// <para>if method breaks down, iterations stop and result is not converged</para>
+///</summary>
+/// <param name="op"> square linear operator </param>
+/// <param name="b"> constant terms </param>
+/// <param name="preconditioner"> approximation M of A applied as z = M^-1 * r </param>
+/// <param name="settings"> stopping criteria, initial guess and convergence monitor </param>
+template<class A, class T, class P>
+iterative_solver_result<T> bicgstab(const A& op, const dynamic_vector<T>& b, const P& preconditioner, const iterative_solver_settings<T>& settings = iterative_solver_settings<T>())
+{
+    static_assert(has_sqrt_implementation_v<T>, "Iterative solvers require square root of mathematical field!");
+
+    detail::krylov_iteration<T> iteration(b, settings);
+    const size_t n = iteration.n;
+    dynamic_vector<T>& x = iteration.result.solution;
+
+    dynamic_vector<T> r(n), r_hat(n), p(n), p_hat(n), v(n), s(n), s_hat(n), t(n);
+
+    iteration.residual(op, b, r, v);
+
+    if (!iteration.report(0, iteration.norm(r)))
+    {
+        return std::move(iteration.result);
+    }
+
+    r_hat = r;
+
+    T rho = get_multiplicative_identity<T>();
+    T alpha = get_multiplicative_identity<T>();
+    T omega = get_multiplicative_identity<T>();
+
+    for (size_t k = 1;; k++)
+    {
+        const T rho_next = iteration.dot(r_hat, r);
+        if (equal(rho_next, get_additive_identity<T>()))
+        {
+            break;
+        }
+
+        if (k == 1)
+        {
+            p = r;
+        }
+        else
+        {
+            //p = r + beta * (p - omega * v)
+            const T beta = (rho_next / rho) * (alpha / omega);
+            detail::krylov_axpy(n, -omega, v.data(), p.data(), iteration.parallel);
+            detail::krylov_xpby(n, r.data(), beta, p.data(), iteration.parallel);
+        }
+
+        rho = rho_next;
+
+        detail::apply_preconditioner(preconditioner, p, p_hat);
+        detail::apply_linear_operator(op, p_hat, v);
+
+        const T r_hat_v = iteration.dot(r_hat, v);
+        if (equal(r_hat_v, get_additive_identity<T>()))
+        {
+            break;
+        }
+
+        alpha = rho / r_hat_v;
+
+        //s = r - alpha * v
+        s = r;
+        detail::krylov_axpy(n, -alpha, v.data(), s.data(), iteration.parallel);
+
+        //half step already satisfies tolerance
+        const T s_norm = iteration.norm(s);
+        if (iteration.satisfies_tolerance(s_norm))
+        {
+            detail::krylov_axpy(n, alpha, p_hat.data(), x.data(), iteration.parallel);
+            iteration.report(k, s_norm);
+            break;
+        }
+
+        detail::apply_preconditioner(preconditioner, s, s_hat);
+        detail::apply_linear_operator(op, s_hat, t);
+
+        const T tt = iteration.dot(t, t);
+        omega = equal(tt, get_additive_identity<T>()) ? get_additive_identity<T>() : iteration.dot(t, s) / tt;
+
+        detail::krylov_axpy(n, alpha, p_hat.data(), x.data(), iteration.parallel);
+        detail::krylov_axpy(n, omega, s_hat.data(), x.data(), iteration.parallel);
+
+        //r = s - omega * t
+        r = s;
+        detail::krylov_axpy(n, -omega, t.data(), r.data(), iteration.parallel);
+
+        if (!iteration.report(k, iteration.norm(r)) || equal(omega, get_additive_identity<T>()))
+        {
+            break;
+        }
+    }
+
+    return std::move(iteration.result);
+}
+
+//stabilized biconjugate gradient method without preconditioning
+template<class A, class T>
+iterative_solver_result<T> bicgstab(const A& op, const dynamic_vector<T>& b, const iterative_solver_settings<T>& settings = iterative_solver_settings<T>())
+{
+    return bicgstab(op, b, identity_preconditioner<T>(), settings);
+}
+
+///<summary>
+/// solves A * x = b for square (possibly nonsymmetric) operator by right-preconditioned generalized minimal residual method restarted
+/// every settings.restart iterations (GMRES(m))
+/// <para>every iteration costs one product with operator, one application of preconditioner and orthogonalization against all previous
+/// vectors of Krylov subspace (modified Gram-Schmidt), residual never grows within cycle, larger restart converges in fewer iterations
+/// but needs more memory and work per iteration</para>
+/// <para>residuals reported within cycle are estimates given by least squares problem of cycle (equal to residuals in exact arithmetic)</para>
+///</summary>
+/// <param name="op"> square linear operator </param>
+/// <param name="b"> constant terms </param>
+/// <param name="preconditioner"> approximation M of A applied as z = M^-1 * r </param>
+/// <param name="settings"> stopping criteria, restart, initial guess and convergence monitor </param>
+template<class A, class T, class P>
+iterative_solver_result<T> gmres(const A& op, const dynamic_vector<T>& b, const P& preconditioner, const iterative_solver_settings<T>& settings = iterative_solver_settings<T>())
+{
+    static_assert(has_sqrt_implementation_v<T>, "Iterative solvers require square root of mathematical field!");
+    assert(settings.restart != 0);
+
+    detail::krylov_iteration<T> iteration(b, settings);
+    const size_t n = iteration.n;
+    const size_t m = settings.restart;
+    dynamic_vector<T>& x = iteration.result.solution;
+
+    dynamic_vector<T> r(n), z(n), w(n);
+
+    iteration.residual(op, b, r, w);
+    T beta = iteration.norm(r);
+
+    if (!iteration.report(0, beta))
+    {
+        return std::move(iteration.result);
+    }
+
+    //orthonormal basis of Krylov subspace, hessenberg matrix (row stride m) reduced to triangular form by givens rotations,
+    //rotations and right hand side of least squares problem of cycle
+    detail::storage_vector<dynamic_vector<T>> basis(m + 1, dynamic_vector<T>(n));
+    detail::storage_vector<T> h((m + 1) * m);
+    detail::storage_vector<T> c(m), s(m), g(m + 1), y(m);
+
+    for (size_t k = 0;;)
+    {
+        basis[0] = r;
+        basis[0] /= beta;
+
+        std::fill(g.begin(), g.end(), get_additive_identity<T>());
+        g[0] = beta;
+
+        bool proceed = true;
+        bool invariant_subspace = false;
+        size_t dimension = 0;
+
+        while (dimension < m && proceed)
+        {
+            const size_t j = dimension++;
+
+            detail::apply_preconditioner(preconditioner, basis[j], z);
+            detail::apply_linear_operator(op, z, w);
+
+            for (size_t i = 0; i <= j; i++)
+            {
+                h[i * m + j] = iteration.dot(w, basis[i]);
+                detail::krylov_axpy(n, -h[i * m + j], basis[i].data(), w.data(), iteration.parallel);
+            }
+
+            const T w_norm = iteration.norm(w);
+            h[(j + 1) * m + j] = w_norm;
+
+            //exact solution lies in current subspace
+            invariant_subspace = equal(w_norm, get_additive_identity<T>());
+            if (!invariant_subspace)
+            {
+                basis[j + 1] = w;
+                basis[j + 1] /= w_norm;
+            }
+
+            for (size_t i = 0; i < j; i++)
+            {
+                const T upper = c[i] * h[i * m + j] + s[i] * h[(i + 1) * m + j];
+                h[(i + 1) * m + j] = c[i] * h[(i + 1) * m + j] - s[i] * h[i * m + j];
+                h[i * m + j] = upper;
+            }
+
+            detail::krylov_givens(h[j * m + j], h[(j + 1) * m + j], c[j], s[j]);
+
+            h[j * m + j] = c[j] * h[j * m + j] + s[j] * h[(j + 1) * m + j];
+            h[(j + 1) * m + j] = get_additive_identity<T>();
+            g[j + 1] = -s[j] * g[j];
+            g[j] = c[j] * g[j];
+
+            proceed = iteration.report(++k, functions_implementation<T>::abs(g[j + 1])) && !invariant_subspace;
+        }
+
+        //y = H^-1 * g (upper triangular), x = x + M^-1 * (V * y)
+        for (size_t i = dimension; i-- > 0;)
+        {
+            T sum = g[i];
+            for (size_t l = i + 1; l < dimension; l++)
+            {
+                sum -= h[i * m + l] * y[l];
+            }
+            y[i] = sum / h[i * m + i];
+        }
+
+        std::fill(w.begin(), w.end(), get_additive_identity<T>());
+        for (size_t i = 0; i < dimension; i++)
+        {
+            detail::krylov_axpy(n, y[i], basis[i].data(), w.data(), iteration.parallel);
+        }
+
+        detail::apply_preconditioner(preconditioner, w, z);
+        detail::krylov_axpy(n, get_multiplicative_identity<T>(), z.data(), x.data(), iteration.parallel);
+
+        //estimated residual of cycle is replaced by true residual, cycle is restarted from it unless solver has to stop
+        //(cycle may end early because estimated residual converged while true residual, affected by rounding errors, has not)
+        iteration.residual(op, b, r, w);
+        beta = iteration.norm(r);
+
+        if (!iteration.update(beta))
+        {
+            break;
+        }
+    }
+
+    return std::move(iteration.result);
+}
+
+//restarted generalized minimal residual method without preconditioning
+template<class A, class T>
+iterative_solver_result<T> gmres(const A& op, const dynamic_vector<T>& b, const iterative_solver_settings<T>& settings = iterative_solver_settings<T>())
+{
+    return gmres(op, b, identity_preconditioner<T>(), settings);
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
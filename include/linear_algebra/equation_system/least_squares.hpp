@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../matrix/matrix.inl"
+#include "../vector/vector.hpp"
+#include "../vector/vector.inl"
+#include "../dynamic_matrix/dynamic_matrix.hpp"
+#include "../dynamic_matrix/dynamic_matrix.inl"
+#include "../dynamic_vector/dynamic_vector.hpp"
+#include "../dynamic_vector/dynamic_vector.inl"
+#include "../kernels/qr.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// solves overdetermined linear equations system (N equations, M variables, N >= M) in least squares sense
+/// <para>rows of system are streamed into householder QR factorization of [A b] (see qr_least_squares), so A^T * A is never formed
+/// and only O(M^2) workspace per group of rows is used, which suits tall and skinny systems (many equations, few variables)</para>
+/// <para>*** RESULTS ***</para>
+/// <para>if columns of coefficents are linearly dependent (solution is not unique) returns nullopt</para>
+/// <para>otherwise returns x minimizing ||coefficents * x - constant_terms||</para>
+///</summary>
+/// <param name="coefficents"> linear equation system coefficents represented in NxM matrix </param>
+/// <param name="constant_terms"> linear equation system constant terms </param>
+template<class T, size_t N, size_t M>
+std::optional<vector<T, M>> least_squares(const matrix<T, N, M>& coefficents, const vector<T, N>& constant_terms)
+{
+    static_assert(N >= M, "Least squares system requires at least as many equations as variables!");
+    static_assert(has_sqrt_implementation_v<T>, "Least squares solver requires square root of mathematical field!");
+
+    vector<T, M> solution;
+
+    if (!detail::qr_least_squares(N, M, coefficents.data(), M, constant_terms.data(), static_cast<size_t>(1), solution.data(), detail::parallel_elimination(N, M * M)))
+    {
+        return std::nullopt;
+    }
+
+    return std::optional<vector<T, M>>(std::move(solution));
+}
+
+///<summary>
+/// solves overdetermined linear equations system with sizes given at runtime in least squares sense
+/// (coefficents must have at least as many rows as columns and constant_terms must have coefficents.rows() coordinates)
+/// <para>see least_squares for matrices with dimensions known at compile time</para>
+///</summary>
+template<class T>
+std::optional<dynamic_vector<T>> least_squares(const dynamic_matrix<T>& coefficents, const dynamic_vector<T>& constant_terms)
+{
+    static_assert(has_sqrt_implementation_v<T>, "Least squares solver requires square root of mathematical field!");
+    assert(coefficents.rows() >= coefficents.columns());
+    assert(constant_terms.size() == coefficents.rows());
+
+    const size_t n = coefficents.rows();
+    const size_t m = coefficents.columns();
+
+    dynamic_vector<T> solution(m);
+
+    if (!detail::qr_least_squares(n, m, coefficents.data(), m, constant_terms.data(), static_cast<size_t>(1), solution.data(), detail::parallel_elimination(n, m * m)))
+    {
+        return std::nullopt;
+    }
+
+    return std::optional<dynamic_vector<T>>(std::move(solution));
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
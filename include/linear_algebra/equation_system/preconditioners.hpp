@@ -0,0 +1,149 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+#include "../dynamic_vector/dynamic_vector.hpp"
+#include "../dynamic_matrix/dynamic_matrix.hpp"
+#include "../sparse_matrix/sparse_matrix.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+/*
+    preconditioners of iterative solvers (see iterative_solvers.hpp)
+    preconditioner M approximates operator A, so that M^-1 * A is better conditioned than A and solver needs fewer iterations
+    every preconditioner provides apply(r, z) computing z = M^-1 * r (z has dimension of r and is not r),
+    user types with such member (or callables with the same arguments) can be used in the same way
+*/
+
+///<summary>
+/// M = I (no preconditioning)
+///</summary>
+template<class T>
+class identity_preconditioner
+{
+public:
+    void apply(const dynamic_vector<T>& r, dynamic_vector<T>& z) const;
+};
+
+///<summary>
+/// M = diag(A) (Jacobi preconditioner)
+/// <para>costs one division per coordinate and suits diagonally dominant systems and systems with badly scaled equations,
+/// zeros of diagonal are replaced by 1 (their coordinates are not scaled)</para>
+///</summary>
+template<class T>
+class jacobi_preconditioner
+{
+    static_assert(is_valid_mathematical_field_v<T>, "Matrix element type must satisfy valid_mathematical_field concept!");
+private:
+    dynamic_vector<T> _inverse_diagonal;
+public:
+    //constructors
+
+    jacobi_preconditioner() = delete;
+
+    jacobi_preconditioner(const jacobi_preconditioner<T>& other) = default;
+
+    jacobi_preconditioner(jacobi_preconditioner<T>&& other) = default;
+
+    jacobi_preconditioner<T>& operator=(const jacobi_preconditioner<T>& other) = default;
+
+    jacobi_preconditioner<T>& operator=(jacobi_preconditioner<T>&& other) = default;
+
+    //from diagonal of operator (e.g diagonal of matrix-free operator)
+    explicit jacobi_preconditioner(const dynamic_vector<T>& diagonal);
+
+    template<class L>
+    explicit jacobi_preconditioner(const sparse_matrix<T, L>& m);
+
+    explicit jacobi_preconditioner(const dynamic_matrix<T>& m);
+
+    template<size_t N>
+    explicit jacobi_preconditioner(const matrix<T, N, N>& m);
+public:
+    //z = diag(A)^-1 * r
+    void apply(const dynamic_vector<T>& r, dynamic_vector<T>& z) const;
+
+    const dynamic_vector<T>& inverse_diagonal() const;
+};
+
+///<summary>
+/// M = L * U where L and U are incomplete LU factors of sparse matrix restricted to its sparsity pattern (ILU(0))
+/// <para>factorization costs about one pass over nonzeros for every nonzero of row, application is forward and backward substitution
+/// (sequential), it suits nonsymmetric systems solved by bicgstab or gmres</para>
+///</summary>
+template<class T>
+class ilu0_preconditioner
+{
+    static_assert(is_valid_mathematical_field_v<T>, "Matrix element type must satisfy valid_mathematical_field concept!");
+private:
+    csr_matrix<T> _factors;
+    detail::storage_vector<size_t> _diagonal;
+    bool _nonsingular = true;
+public:
+    //constructors
+
+    ilu0_preconditioner() = delete;
+
+    ilu0_preconditioner(const ilu0_preconditioner<T>& other) = default;
+
+    ilu0_preconditioner(ilu0_preconditioner<T>&& other) = default;
+
+    ilu0_preconditioner<T>& operator=(const ilu0_preconditioner<T>& other) = default;
+
+    ilu0_preconditioner<T>& operator=(ilu0_preconditioner<T>&& other) = default;
+
+    //factors copy of given square matrix (CSC matrices are converted to CSR)
+    template<class L>
+    explicit ilu0_preconditioner(const sparse_matrix<T, L>& m);
+public:
+    //factorization fails if some diagonal element is not stored or some pivot is 0 (apply copies r to z then)
+    bool is_nonsingular() const;
+
+    //packed factors: strictly lower part contains L (its unit diagonal is not stored), remaining part contains U
+    const csr_matrix<T>& factors() const;
+
+    //z = U^-1 * L^-1 * r
+    void apply(const dynamic_vector<T>& r, dynamic_vector<T>& z) const;
+};
+
+///<summary>
+/// M = L * L^T where L is incomplete Cholesky factor of symmetric positive-definite sparse matrix restricted to sparsity pattern
+/// of its lower triangle (IC(0))
+/// <para>only lower triangle of matrix is read, application is forward and backward substitution (sequential),
+/// it suits symmetric positive-definite systems solved by conjugate_gradient</para>
+///</summary>
+template<class T>
+class ic0_preconditioner
+{
+    static_assert(has_sqrt_implementation_v<T>, "Incomplete Cholesky factorization requires square root of mathematical field!");
+private:
+    csr_matrix<T> _l;
+    detail::storage_vector<size_t> _diagonal;
+    bool _positive_definite = true;
+public:
+    //constructors
+
+    ic0_preconditioner() = delete;
+
+    ic0_preconditioner(const ic0_preconditioner<T>& other) = default;
+
+    ic0_preconditioner(ic0_preconditioner<T>&& other) = default;
+
+    ic0_preconditioner<T>& operator=(const ic0_preconditioner<T>& other) = default;
+
+    ic0_preconditioner<T>& operator=(ic0_preconditioner<T>&& other) = default;
+
+    //factors lower triangle of given square matrix
+    template<class L>
+    explicit ic0_preconditioner(const sparse_matrix<T, L>& m);
+public:
+    //factorization fails if some diagonal element is not stored or some pivot is not positive (apply copies r to z then)
+    bool is_positive_definite() const;
+
+    //L (lower triangle including diagonal)
+    const csr_matrix<T>& lower() const;
+
+    //z = L^-T * L^-1 * r
+    void apply(const dynamic_vector<T>& r, dynamic_vector<T>& z) const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
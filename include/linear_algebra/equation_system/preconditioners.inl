@@ -0,0 +1,191 @@
+#pragma once
+
+#include "preconditioners.hpp"
+#include "../matrix/matrix.inl"
+#include "../dynamic_vector/dynamic_vector.inl"
+#include "../dynamic_matrix/dynamic_matrix.inl"
+#include "../sparse_matrix/sparse_matrix.inl"
+#include "../sparse_matrix/sparse_matrix_builder.inl"
+#include "../kernels/sparse.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    template<class T>
+    inline dynamic_vector<T> jacobi_inverse_diagonal(dynamic_vector<T> diagonal)
+    {
+        for (T& element : diagonal)
+        {
+            element = equal(element, get_additive_identity<T>()) ? get_multiplicative_identity<T>() : get_multiplicative_identity<T>() / element;
+        }
+
+        return diagonal;
+    }
+}
+
+template<class T>
+void identity_preconditioner<T>::apply(const dynamic_vector<T>& r, dynamic_vector<T>& z) const
+{
+    z = r;
+}
+
+template<class T>
+jacobi_preconditioner<T>::jacobi_preconditioner(const dynamic_vector<T>& diagonal) :
+    _inverse_diagonal(detail::jacobi_inverse_diagonal(diagonal))
+{
+}
+
+template<class T>
+template<class L>
+jacobi_preconditioner<T>::jacobi_preconditioner(const sparse_matrix<T, L>& m) :
+    _inverse_diagonal(detail::jacobi_inverse_diagonal(m.diagonal()))
+{
+    assert(m.rows() == m.columns());
+}
+
+template<class T>
+jacobi_preconditioner<T>::jacobi_preconditioner(const dynamic_matrix<T>& m) :
+    _inverse_diagonal(m.rows())
+{
+    assert(m.rows() == m.columns());
+
+    for (size_t row = 0; row < m.rows(); row++)
+    {
+        _inverse_diagonal[row] = m[row][row];
+    }
+
+    _inverse_diagonal = detail::jacobi_inverse_diagonal(std::move(_inverse_diagonal));
+}
+
+template<class T>
+template<size_t N>
+jacobi_preconditioner<T>::jacobi_preconditioner(const matrix<T, N, N>& m) :
+    _inverse_diagonal(N)
+{
+    for (size_t row = 0; row < N; row++)
+    {
+        _inverse_diagonal[row] = m[row][row];
+    }
+
+    _inverse_diagonal = detail::jacobi_inverse_diagonal(std::move(_inverse_diagonal));
+}
+
+template<class T>
+void jacobi_preconditioner<T>::apply(const dynamic_vector<T>& r, dynamic_vector<T>& z) const
+{
+    assert(r.size() == _inverse_diagonal.size());
+
+    z.resize(r.size());
+
+    const T* inverse_diagonal = _inverse_diagonal.data();
+    const T* r_data = r.data();
+    T* z_data = z.data();
+
+    detail::elementwise_for_each(r.size(), detail::parallel_elementwise(r.size()), [&](size_t index) {
+        z_data[index] = inverse_diagonal[index] * r_data[index];
+    });
+}
+
+template<class T>
+const dynamic_vector<T>& jacobi_preconditioner<T>::inverse_diagonal() const
+{
+    return _inverse_diagonal;
+}
+
+template<class T>
+template<class L>
+ilu0_preconditioner<T>::ilu0_preconditioner(const sparse_matrix<T, L>& m) :
+    _factors(m)
+{
+    assert(m.rows() == m.columns());
+
+    const size_t n = _factors.rows();
+
+    _diagonal = detail::sparse_diagonal_positions(n, _factors.offsets(), _factors.indices());
+    _nonsingular = detail::sparse_ilu0(n, _factors.offsets(), _factors.indices(), _factors.values(), _diagonal.data());
+}
+
+template<class T>
+bool ilu0_preconditioner<T>::is_nonsingular() const
+{
+    return _nonsingular;
+}
+
+template<class T>
+const csr_matrix<T>& ilu0_preconditioner<T>::factors() const
+{
+    return _factors;
+}
+
+template<class T>
+void ilu0_preconditioner<T>::apply(const dynamic_vector<T>& r, dynamic_vector<T>& z) const
+{
+    assert(r.size() == _factors.rows());
+
+    z = r;
+
+    if (!_nonsingular)
+    {
+        return;
+    }
+
+    detail::sparse_lower_solve(z.size(), _factors.offsets(), _factors.indices(), _factors.values(), static_cast<const size_t*>(nullptr), z.data());
+    detail::sparse_upper_solve(z.size(), _factors.offsets(), _factors.indices(), _factors.values(), _diagonal.data(), z.data());
+}
+
+template<class T>
+template<class L>
+ic0_preconditioner<T>::ic0_preconditioner(const sparse_matrix<T, L>& m)
+{
+    assert(m.rows() == m.columns());
+
+    //lower triangle is extracted from rows of CSR copy (rows stay sorted, so diagonal is last element of every row)
+    const csr_matrix<T> rows(m);
+    const size_t n = rows.rows();
+
+    sparse_matrix_builder<T> builder(n, n);
+    builder.reserve((rows.non_zeros() + n) / 2);
+
+    for (size_t row = 0; row < n; row++)
+    {
+        for (size_t element = rows.offsets()[row]; element < rows.offsets()[row + 1] && rows.indices()[element] <= row; element++)
+        {
+            builder.add(row, rows.indices()[element], rows.values()[element]);
+        }
+    }
+
+    _l = builder.build();
+    _diagonal = detail::sparse_diagonal_positions(n, _l.offsets(), _l.indices());
+    _positive_definite = detail::sparse_ic0(n, _l.offsets(), _l.indices(), _l.values());
+}
+
+template<class T>
+bool ic0_preconditioner<T>::is_positive_definite() const
+{
+    return _positive_definite;
+}
+
+template<class T>
+const csr_matrix<T>& ic0_preconditioner<T>::lower() const
+{
+    return _l;
+}
+
+template<class T>
+void ic0_preconditioner<T>::apply(const dynamic_vector<T>& r, dynamic_vector<T>& z) const
+{
+    assert(r.size() == _l.rows());
+
+    z = r;
+
+    if (!_positive_definite)
+    {
+        return;
+    }
+
+    detail::sparse_lower_solve(z.size(), _l.offsets(), _l.indices(), _l.values(), _diagonal.data(), z.data());
+    detail::sparse_transposed_lower_solve(z.size(), _l.offsets(), _l.indices(), _l.values(), z.data());
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "../matrix/matrix.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// lazily evaluated element-wise expression over NxM matrices (e.g a * 2 + b - c)
+/// <para>elements are computed in single pass over memory when expression is assigned or converted to matrix,
+/// no temporary matrices are created for intermediate results</para>
+/// <para>expression references matrices used in it, so it must not outlive them</para>
+///</summary>
+/// <param name="E"> callable returning element of expression at given index of row-major data </param>
+template<class T, size_t N, size_t M, class E>
+class matrix_expression
+{
+private:
+    E _element;
+public:
+    using mathematical_field_type = T;
+
+    static constexpr size_t rows = N;
+    static constexpr size_t columns = M;
+public:
+    matrix_expression() = delete;
+
+    explicit matrix_expression(const E& element);
+
+    matrix_expression(const matrix_expression<T, N, M, E>& other) = default;
+
+    matrix_expression(matrix_expression<T, N, M, E>&& other) = default;
+
+    matrix_expression<T, N, M, E>& operator=(const matrix_expression<T, N, M, E>& other) = delete;
+
+    matrix_expression<T, N, M, E>& operator=(matrix_expression<T, N, M, E>&& other) = delete;
+public:
+    //element at given index of row-major data (i.e row * M + column)
+    T element(size_t index) const;
+
+    //callable used to compute elements
+    const E& element_function() const;
+
+    //evaluation
+    matrix<T, N, M> operator()() const;
+    matrix<T, N, M> operator*() const;
+};
+
+namespace detail
+{
+    //element of matrix multiplied by scalar (v * A), matrix product can absorb such expressions as its scalar factor
+    template<class T, size_t N, size_t M, class TO>
+    struct scaled_matrix_element
+    {
+        const matrix<T, N, M>* source;
+        const T* data;
+        TO factor;
+
+        auto operator()(size_t index) const { return data[index] * factor; }
+    };
+
+    template<class E>
+    struct is_scaled_matrix_element : std::false_type {};
+
+    template<class T, size_t N, size_t M, class TO>
+    struct is_scaled_matrix_element<scaled_matrix_element<T, N, M, TO>> : std::true_type {};
+
+    template<class E>
+    constexpr bool is_scaled_matrix_element_v = is_scaled_matrix_element<E>::value;
+
+    template<class TS>
+    struct matrix_expression_operand_traits
+    {
+        static constexpr bool is_operand = false;
+        static constexpr bool is_expression = false;
+    };
+
+    template<class T, size_t N, size_t M>
+    struct matrix_expression_operand_traits<matrix<T, N, M>>
+    {
+        static constexpr bool is_operand = true;
+        static constexpr bool is_expression = false;
+    };
+
+    template<class T, size_t N, size_t M, class E>
+    struct matrix_expression_operand_traits<matrix_expression<T, N, M, E>>
+    {
+        static constexpr bool is_operand = true;
+        static constexpr bool is_expression = true;
+
+        using element_function_type = E;
+    };
+
+    //matrices and expressions form new expression if at least one of them is an expression or both are big matrices of equal dimensions
+    template<class A, class B, bool = matrix_expression_operand_traits<A>::is_operand && matrix_expression_operand_traits<B>::is_operand>
+    constexpr bool are_matrix_expression_operands_v = false;
+
+    template<class A, class B>
+    constexpr bool are_matrix_expression_operands_v<A, B, true> =
+        A::rows == B::rows && A::columns == B::columns &&
+        (matrix_expression_operand_traits<A>::is_expression || matrix_expression_operand_traits<B>::is_expression ||
+            use_matrix_expression_v<typename A::mathematical_field_type, A::rows, A::columns, B::rows, B::columns>);
+
+    //single operand forms new expression (with scalar or unary operator) if it is an expression or a big matrix
+    template<class A, bool = matrix_expression_operand_traits<A>::is_operand>
+    constexpr bool is_matrix_expression_operand_v = false;
+
+    template<class A>
+    constexpr bool is_matrix_expression_operand_v<A, true> =
+        matrix_expression_operand_traits<A>::is_expression ||
+        use_matrix_expression_v<typename A::mathematical_field_type, A::rows, A::columns, A::rows, A::columns>;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "matrix_expression.hpp"
+#include "../matrix/matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t N, size_t M, class E>
+matrix_expression<T, N, M, E>::matrix_expression(const E& element) :
+    _element(element)
+{
+}
+
+template<class T, size_t N, size_t M, class E>
+inline T matrix_expression<T, N, M, E>::element(size_t index) const
+{
+    return static_cast<T>(_element(index));
+}
+
+template<class T, size_t N, size_t M, class E>
+inline const E& matrix_expression<T, N, M, E>::element_function() const
+{
+    return _element;
+}
+
+template<class T, size_t N, size_t M, class E>
+matrix<T, N, M> matrix_expression<T, N, M, E>::operator()() const
+{
+    return matrix<T, N, M>(*this);
+}
+
+template<class T, size_t N, size_t M, class E>
+matrix<T, N, M> matrix_expression<T, N, M, E>::operator*() const
+{
+    return matrix<T, N, M>(*this);
+}
+
+namespace detail
+{
+    //callables returning element of operand at given index, matrices are referenced and expressions are copied
+
+    template<class T, size_t N, size_t M>
+    inline auto matrix_expression_element(const matrix<T, N, M>& matrix)
+    {
+        return [data = matrix.data()](size_t index) { return data[index]; };
+    }
+
+    template<class T, size_t N, size_t M, class E>
+    inline auto matrix_expression_element(const matrix_expression<T, N, M, E>& expression)
+    {
+        return [expression](size_t index) { return expression.element(index); };
+    }
+
+    template<class T, size_t N, size_t M, class F>
+    inline auto make_matrix_expression(const F& element)
+    {
+        return matrix_expression<T, N, M, F>(element);
+    }
+
+    template<class T, size_t N, size_t M, class TO>
+    inline auto make_scaled_matrix_expression(const matrix<T, N, M>& matrix, const TO& factor)
+    {
+        return make_matrix_expression<multiplication_result_t<T, TO>, N, M>(scaled_matrix_element<T, N, M, TO>{ &matrix, matrix.data(), factor });
+    }
+
+    //writes (or accumulates with given operation) every element of expression to row-major array
+    //element-wise expressions can be safely evaluated into matrix used in expression itself
+    template<class T, class TO, size_t N, size_t M, class E, class F>
+    inline void evaluate_matrix_expression(T* result, const matrix_expression<TO, N, M, E>& expression, F&& operation)
+    {
+        simd_for_each_chunk(N * M, use_matrix_expression_v<TO, N, M, N, M>, [&](size_t offset, size_t count) {
+            for (size_t index = offset; index < offset + count; index++)
+            {
+                operation(result[index], expression.element(index));
+            }
+        });
+    }
+}
+
+//matrix-matrix operators
+
+template<class A, class B, std::enable_if_t<detail::are_matrix_expression_operands_v<A, B> && can_be_added_v<typename A::mathematical_field_type, typename B::mathematical_field_type>, int> = 0>
+auto operator+(const A& a, const B& b)
+{
+    return detail::make_matrix_expression<addition_result_t<typename A::mathematical_field_type, typename B::mathematical_field_type>, A::rows, A::columns>(
+        [ea = detail::matrix_expression_element(a), eb = detail::matrix_expression_element(b)](size_t index) { return ea(index) + eb(index); }
+    );
+}
+
+template<class A, class B, std::enable_if_t<detail::are_matrix_expression_operands_v<A, B> && can_be_subtracted_v<typename A::mathematical_field_type, typename B::mathematical_field_type>, int> = 0>
+auto operator-(const A& a, const B& b)
+{
+    return detail::make_matrix_expression<subtraction_result_t<typename A::mathematical_field_type, typename B::mathematical_field_type>, A::rows, A::columns>(
+        [ea = detail::matrix_expression_element(a), eb = detail::matrix_expression_element(b)](size_t index) { return ea(index) - eb(index); }
+    );
+}
+
+//matrix-scalar operators
+
+//scaled matrices stay scaled matrices (so they can still be absorbed by matrix product)
+
+template<class T, size_t N, size_t M, class E>
+auto operator-(const matrix_expression<T, N, M, E>& a)
+{
+    if constexpr (detail::is_scaled_matrix_element_v<E>)
+    {
+        return detail::make_scaled_matrix_expression(*a.element_function().source, -a.element_function().factor);
+    }
+    else
+    {
+        return detail::make_matrix_expression<T, N, M>(
+            [ea = detail::matrix_expression_element(a)](size_t index) { return -ea(index); }
+        );
+    }
+}
+
+template<class A, class TO, std::enable_if_t<detail::is_matrix_expression_operand_v<A> && can_be_multiplied_v<typename A::mathematical_field_type, TO> && std::is_convertible_v<TO, typename A::mathematical_field_type>, int> = 0>
+auto operator*(const A& a, const TO& v)
+{
+    if constexpr (!detail::matrix_expression_operand_traits<A>::is_expression)
+    {
+        return detail::make_scaled_matrix_expression(a, v);
+    }
+    else if constexpr (detail::is_scaled_matrix_element_v<typename detail::matrix_expression_operand_traits<A>::element_function_type>)
+    {
+        return detail::make_scaled_matrix_expression(*a.element_function().source, a.element_function().factor * v);
+    }
+    else
+    {
+        return detail::make_matrix_expression<multiplication_result_t<typename A::mathematical_field_type, TO>, A::rows, A::columns>(
+            [ea = detail::matrix_expression_element(a), v](size_t index) { return ea(index) * v; }
+        );
+    }
+}
+
+template<class T, size_t N, size_t M, class E, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+auto operator*(const TO& v, const matrix_expression<T, N, M, E>& a)
+{
+    return a * v;
+}
+
+template<class A, class TO, std::enable_if_t<detail::is_matrix_expression_operand_v<A> && can_be_divided_v<typename A::mathematical_field_type, TO> && std::is_convertible_v<TO, typename A::mathematical_field_type>, int> = 0>
+auto operator/(const A& a, const TO& v)
+{
+    return detail::make_matrix_expression<division_result_t<typename A::mathematical_field_type, TO>, A::rows, A::columns>(
+        [ea = detail::matrix_expression_element(a), v](size_t index) { return ea(index) / v; }
+    );
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
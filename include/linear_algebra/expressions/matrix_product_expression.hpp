@@ -0,0 +1,129 @@
+#pragma once
+
+#include "matrix_expression.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// sum of matrix product and element-wise expression (e.g alpha * A * B + beta * C or A * B + D)
+/// <para>when assigned to matrix, added expression is written to it first and final multiplication of product
+/// accumulates into it (GEMM with beta = 1), so neither product nor sum is stored in temporary matrix</para>
+/// <para>if added expression is just scaled matrix that expression is assigned to (C = A * B + beta * C),
+/// it is not evaluated at all and its factor is passed to GEMM as beta</para>
+///</summary>
+/// <param name="P"> matrix_multiplication_proxy of product </param>
+/// <param name="E"> matrix_expression added to product </param>
+template<class P, class E>
+class matrix_product_expression
+{
+private:
+    P _product;
+    E _addend;
+public:
+    using mathematical_field_type = typename P::result_mathematical_field_type;
+
+    static constexpr size_t rows = P::result_rows;
+    static constexpr size_t columns = P::result_columns;
+public:
+    matrix_product_expression() = delete;
+
+    matrix_product_expression(const P& product, const E& addend);
+
+    matrix_product_expression(const matrix_product_expression<P, E>& other) = default;
+
+    matrix_product_expression(matrix_product_expression<P, E>&& other) = default;
+
+    matrix_product_expression<P, E>& operator=(const matrix_product_expression<P, E>& other) = delete;
+
+    matrix_product_expression<P, E>& operator=(matrix_product_expression<P, E>&& other) = delete;
+public:
+    const P& product() const;
+    const E& addend() const;
+
+    //writes value of expression to result (result may be used in expression)
+    template<class T>
+    void evaluate(matrix<T, rows, columns>& result) const;
+
+    //evaluation
+    matrix<mathematical_field_type, rows, columns> operator()() const;
+    matrix<mathematical_field_type, rows, columns> operator*() const;
+};
+
+namespace detail
+{
+    template<class TS>
+    struct matrix_product_operand_traits
+    {
+        static constexpr bool is_product = false;
+        static constexpr bool is_sum = false;
+        static constexpr bool is_scaled_matrix = false;
+    };
+
+    template<class T, size_t N, size_t M>
+    struct matrix_product_operand_traits<matrix<T, N, M>>
+    {
+        static constexpr bool is_product = true;
+        static constexpr bool is_sum = false;
+        static constexpr bool is_scaled_matrix = false;
+    };
+
+    template<class... MS>
+    struct matrix_product_operand_traits<matrix_multiplication_proxy<MS...>>
+    {
+        static constexpr bool is_product = true;
+        static constexpr bool is_sum = false;
+        static constexpr bool is_scaled_matrix = false;
+    };
+
+    template<class T, size_t N, size_t M, class E>
+    struct matrix_product_operand_traits<matrix_expression<T, N, M, E>>
+    {
+        static constexpr bool is_product = is_scaled_matrix_element_v<E>;
+        static constexpr bool is_sum = false;
+        static constexpr bool is_scaled_matrix = is_scaled_matrix_element_v<E>;
+    };
+
+    template<class P, class E>
+    struct matrix_product_operand_traits<matrix_product_expression<P, E>>
+    {
+        static constexpr bool is_product = false;
+        static constexpr bool is_sum = true;
+        static constexpr bool is_scaled_matrix = false;
+    };
+
+    //scaled matrices (v * A) multiplied by matrices, proxies or other scaled matrices form multiplication proxy with scalar factor
+    template<class A, class B, bool = matrix_product_operand_traits<A>::is_product && matrix_product_operand_traits<B>::is_product>
+    constexpr bool are_scaled_matrix_product_operands_v = false;
+
+    template<class A, class B>
+    constexpr bool are_scaled_matrix_product_operands_v<A, B, true> =
+        A::columns == B::rows &&
+        (matrix_product_operand_traits<A>::is_scaled_matrix || matrix_product_operand_traits<B>::is_scaled_matrix) &&
+        can_calculate_inner_product_v<typename A::mathematical_field_type, typename B::mathematical_field_type>;
+
+    //other element-wise expressions are evaluated before they are multiplied
+    template<class A, class B, bool =
+        (matrix_product_operand_traits<A>::is_product || matrix_expression_operand_traits<A>::is_expression) &&
+        (matrix_product_operand_traits<B>::is_product || matrix_expression_operand_traits<B>::is_expression)>
+    constexpr bool are_evaluated_matrix_product_operands_v = false;
+
+    template<class A, class B>
+    constexpr bool are_evaluated_matrix_product_operands_v<A, B, true> =
+        A::columns == B::rows &&
+        ((matrix_expression_operand_traits<A>::is_expression && !matrix_product_operand_traits<A>::is_scaled_matrix) ||
+            (matrix_expression_operand_traits<B>::is_expression && !matrix_product_operand_traits<B>::is_scaled_matrix)) &&
+        can_calculate_inner_product_v<typename A::mathematical_field_type, typename B::mathematical_field_type>;
+
+    //products (or their sums with expressions) and matrices (or element-wise expressions) of same dimensions form matrix_product_expression
+    template<class P, class B, bool =
+        (matrix_product_operand_traits<P>::is_sum || (matrix_product_operand_traits<P>::is_product && !matrix_expression_operand_traits<P>::is_operand)) &&
+        matrix_expression_operand_traits<B>::is_operand>
+    constexpr bool are_matrix_product_sum_operands_v = false;
+
+    template<class P, class B>
+    constexpr bool are_matrix_product_sum_operands_v<P, B, true> =
+        P::rows == B::rows && P::columns == B::columns &&
+        can_be_added_v<typename P::mathematical_field_type, typename B::mathematical_field_type>;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "matrix_product_expression.hpp"
+#include "matrix_expression.inl"
+#include "../matrix/matrix.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class P, class E>
+matrix_product_expression<P, E>::matrix_product_expression(const P& product, const E& addend) :
+    _product(product),
+    _addend(addend)
+{
+}
+
+template<class P, class E>
+const P& matrix_product_expression<P, E>::product() const
+{
+    return _product;
+}
+
+template<class P, class E>
+const E& matrix_product_expression<P, E>::addend() const
+{
+    return _addend;
+}
+
+template<class P, class E>
+template<class T>
+void matrix_product_expression<P, E>::evaluate(matrix<T, rows, columns>& result) const
+{
+    auto assign = [](T& element, const auto& value) { element = static_cast<T>(value); };
+
+    if (_product.is_factor(result))
+    {
+        //result cannot be overwritten before product is calculated
+        matrix<mathematical_field_type, rows, columns> product = _product();
+
+        detail::evaluate_matrix_expression(result.data(), product + _addend, assign);
+        return;
+    }
+
+    if constexpr (detail::is_scaled_matrix_element_v<typename detail::matrix_expression_operand_traits<E>::element_function_type>)
+    {
+        if (static_cast<const void*>(_addend.element_function().source) == static_cast<const void*>(&result))
+        {
+            //result = alpha * product + beta * result
+            _product.multiply_add(result, static_cast<mathematical_field_type>(_addend.element_function().factor));
+            return;
+        }
+    }
+
+    //added expression is written first, product is accumulated into it
+    detail::evaluate_matrix_expression(result.data(), _addend, assign);
+    _product.multiply_add(result, get_multiplicative_identity<mathematical_field_type>());
+}
+
+template<class P, class E>
+matrix<typename matrix_product_expression<P, E>::mathematical_field_type, matrix_product_expression<P, E>::rows, matrix_product_expression<P, E>::columns> matrix_product_expression<P, E>::operator()() const
+{
+    return matrix<mathematical_field_type, rows, columns>(*this);
+}
+
+template<class P, class E>
+matrix<typename matrix_product_expression<P, E>::mathematical_field_type, matrix_product_expression<P, E>::rows, matrix_product_expression<P, E>::columns> matrix_product_expression<P, E>::operator*() const
+{
+    return matrix<mathematical_field_type, rows, columns>(*this);
+}
+
+namespace detail
+{
+    //scaled matrix (v * A) is split into matrix and its factor, matrices and proxies are used as they are
+
+    template<class T, size_t N, size_t M>
+    inline const matrix<T, N, M>& matrix_product_factor(const matrix<T, N, M>& matrix)
+    {
+        return matrix;
+    }
+
+    template<class... MS>
+    inline const matrix_multiplication_proxy<MS...>& matrix_product_factor(const matrix_multiplication_proxy<MS...>& proxy)
+    {
+        return proxy;
+    }
+
+    template<class T, size_t N, size_t M, class E>
+    inline const auto& matrix_product_factor(const matrix_expression<T, N, M, E>& expression)
+    {
+        return *expression.element_function().source;
+    }
+
+    template<class TS>
+    inline auto matrix_product_scale(const TS& operand)
+    {
+        if constexpr (matrix_product_operand_traits<TS>::is_scaled_matrix)
+        {
+            return operand.element_function().factor;
+        }
+        else
+        {
+            return get_multiplicative_identity<typename TS::mathematical_field_type>();
+        }
+    }
+
+    //element-wise expressions that are multiplied are evaluated to matrices
+
+    template<class TS>
+    inline decltype(auto) evaluate_matrix_product_operand(const TS& operand)
+    {
+        if constexpr (matrix_expression_operand_traits<TS>::is_expression)
+        {
+            return *operand;
+        }
+        else
+        {
+            return (operand);
+        }
+    }
+
+    //matrices are added to product as scaled matrices, so product can recognize matrix it is assigned to
+
+    template<class T, size_t N, size_t M>
+    inline auto matrix_product_addend(const matrix<T, N, M>& matrix)
+    {
+        return make_scaled_matrix_expression(matrix, get_multiplicative_identity<T>());
+    }
+
+    template<class T, size_t N, size_t M, class E>
+    inline const matrix_expression<T, N, M, E>& matrix_product_addend(const matrix_expression<T, N, M, E>& expression)
+    {
+        return expression;
+    }
+
+    template<class P, class E>
+    inline auto make_matrix_product_expression(const P& product, const E& addend)
+    {
+        return matrix_product_expression<P, E>(product, addend);
+    }
+}
+
+//matrix-matrix multiplication operators with element-wise expressions
+
+template<class A, class B, std::enable_if_t<detail::are_scaled_matrix_product_operands_v<A, B>, int> = 0>
+auto operator*(const A& a, const B& b)
+{
+    return (detail::matrix_product_factor(a) * detail::matrix_product_factor(b)) * (detail::matrix_product_scale(a) * detail::matrix_product_scale(b));
+}
+
+template<class A, class B, std::enable_if_t<detail::are_evaluated_matrix_product_operands_v<A, B>, int> = 0>
+auto operator*(const A& a, const B& b)
+{
+    return *(detail::evaluate_matrix_product_operand(a) * detail::evaluate_matrix_product_operand(b));
+}
+
+template<class T, size_t N, size_t M, class E, class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<T, TO>>>
+auto operator*(const matrix_expression<T, N, M, E>& a, const vector<TO, M>& v)
+{
+    return *a * v;
+}
+
+//product-matrix addition operators
+
+template<class P, class B, std::enable_if_t<detail::are_matrix_product_sum_operands_v<P, B>, int> = 0>
+auto operator+(const P& p, const B& b)
+{
+    if constexpr (detail::matrix_product_operand_traits<P>::is_sum)
+    {
+        return detail::make_matrix_product_expression(p.product(), p.addend() + detail::matrix_product_addend(b));
+    }
+    else
+    {
+        return detail::make_matrix_product_expression(p, detail::matrix_product_addend(b));
+    }
+}
+
+template<class B, class P, std::enable_if_t<detail::are_matrix_product_sum_operands_v<P, B>, int> = 0>
+auto operator+(const B& b, const P& p)
+{
+    return p + b;
+}
+
+template<class P, class B, std::enable_if_t<detail::are_matrix_product_sum_operands_v<P, B>, int> = 0>
+auto operator-(const P& p, const B& b)
+{
+    if constexpr (detail::matrix_product_operand_traits<P>::is_sum)
+    {
+        return detail::make_matrix_product_expression(p.product(), p.addend() - detail::matrix_product_addend(b));
+    }
+    else
+    {
+        return detail::make_matrix_product_expression(p, -detail::matrix_product_addend(b));
+    }
+}
+
+template<class B, class P, std::enable_if_t<detail::are_matrix_product_sum_operands_v<P, B>, int> = 0>
+auto operator-(const B& b, const P& p)
+{
+    if constexpr (detail::matrix_product_operand_traits<P>::is_sum)
+    {
+        return detail::make_matrix_product_expression(-p.product(), detail::matrix_product_addend(b) - p.addend());
+    }
+    else
+    {
+        return detail::make_matrix_product_expression(-p, detail::matrix_product_addend(b));
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../vector/vector.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// lazily evaluated element-wise expression over D-dimensional vectors (e.g a * 2 + b - c)
+/// <para>coordinates are computed in single pass over memory when expression is assigned or converted to vector,
+/// no temporary vectors are created for intermediate results</para>
+/// <para>expression references vectors used in it, so it must not outlive them</para>
+///</summary>
+/// <param name="E"> callable returning coordinate of expression at given index </param>
+template<class T, size_t D, class E>
+class vector_expression
+{
+private:
+    E _element;
+public:
+    using mathematical_field_type = T;
+
+    static constexpr size_t size = D;
+    static constexpr size_t dimension = D;
+public:
+    vector_expression() = delete;
+
+    explicit vector_expression(const E& element);
+
+    vector_expression(const vector_expression<T, D, E>& other) = default;
+
+    vector_expression(vector_expression<T, D, E>&& other) = default;
+
+    vector_expression<T, D, E>& operator=(const vector_expression<T, D, E>& other) = delete;
+
+    vector_expression<T, D, E>& operator=(vector_expression<T, D, E>&& other) = delete;
+public:
+    T element(size_t index) const;
+
+    //evaluation
+    vector<T, D> operator()() const;
+    vector<T, D> operator*() const;
+};
+
+namespace detail
+{
+    template<class TS>
+    struct vector_expression_operand_traits
+    {
+        static constexpr bool is_operand = false;
+        static constexpr bool is_expression = false;
+    };
+
+    template<class T, size_t D>
+    struct vector_expression_operand_traits<vector<T, D>>
+    {
+        static constexpr bool is_operand = true;
+        static constexpr bool is_expression = false;
+    };
+
+    template<class T, size_t D, class E>
+    struct vector_expression_operand_traits<vector_expression<T, D, E>>
+    {
+        static constexpr bool is_operand = true;
+        static constexpr bool is_expression = true;
+    };
+
+    //vectors and expressions form new expression if at least one of them is an expression or both are big vectors of equal dimensions
+    template<class A, class B, bool = vector_expression_operand_traits<A>::is_operand && vector_expression_operand_traits<B>::is_operand>
+    constexpr bool are_vector_expression_operands_v = false;
+
+    template<class A, class B>
+    constexpr bool are_vector_expression_operands_v<A, B, true> =
+        A::dimension == B::dimension &&
+        (vector_expression_operand_traits<A>::is_expression || vector_expression_operand_traits<B>::is_expression ||
+            use_vector_expression_v<typename A::mathematical_field_type, A::dimension, B::dimension>);
+
+    //single operand forms new expression (with scalar or unary operator) if it is an expression or a big vector
+    template<class A, bool = vector_expression_operand_traits<A>::is_operand>
+    constexpr bool is_vector_expression_operand_v = false;
+
+    template<class A>
+    constexpr bool is_vector_expression_operand_v<A, true> =
+        vector_expression_operand_traits<A>::is_expression ||
+        use_vector_expression_v<typename A::mathematical_field_type, A::dimension, A::dimension>;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
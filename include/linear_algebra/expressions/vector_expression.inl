@@ -0,0 +1,117 @@
+#pragma once
+
+#include "vector_expression.hpp"
+#include "../vector/vector.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, size_t D, class E>
+vector_expression<T, D, E>::vector_expression(const E& element) :
+    _element(element)
+{
+}
+
+template<class T, size_t D, class E>
+inline T vector_expression<T, D, E>::element(size_t index) const
+{
+    return static_cast<T>(_element(index));
+}
+
+template<class T, size_t D, class E>
+vector<T, D> vector_expression<T, D, E>::operator()() const
+{
+    return vector<T, D>(*this);
+}
+
+template<class T, size_t D, class E>
+vector<T, D> vector_expression<T, D, E>::operator*() const
+{
+    return vector<T, D>(*this);
+}
+
+namespace detail
+{
+    //callables returning coordinate of operand at given index, vectors are referenced and expressions are copied
+
+    template<class T, size_t D>
+    inline auto vector_expression_element(const vector<T, D>& vector)
+    {
+        return [data = vector.data()](size_t index) { return data[index]; };
+    }
+
+    template<class T, size_t D, class E>
+    inline auto vector_expression_element(const vector_expression<T, D, E>& expression)
+    {
+        return [expression](size_t index) { return expression.element(index); };
+    }
+
+    template<class T, size_t D, class F>
+    inline auto make_vector_expression(const F& element)
+    {
+        return vector_expression<T, D, F>(element);
+    }
+
+    //writes (or accumulates with given operation) every coordinate of expression to array
+    template<class T, class TO, size_t D, class E, class F>
+    inline void evaluate_vector_expression(T* result, const vector_expression<TO, D, E>& expression, F&& operation)
+    {
+        simd_for_each_chunk(D, use_vector_expression_v<TO, D, D>, [&](size_t offset, size_t count) {
+            for (size_t index = offset; index < offset + count; index++)
+            {
+                operation(result[index], expression.element(index));
+            }
+        });
+    }
+}
+
+//vector-vector operators
+
+template<class A, class B, std::enable_if_t<detail::are_vector_expression_operands_v<A, B> && can_be_added_v<typename A::mathematical_field_type, typename B::mathematical_field_type>, int> = 0>
+auto operator+(const A& a, const B& b)
+{
+    return detail::make_vector_expression<addition_result_t<typename A::mathematical_field_type, typename B::mathematical_field_type>, A::dimension>(
+        [ea = detail::vector_expression_element(a), eb = detail::vector_expression_element(b)](size_t index) { return ea(index) + eb(index); }
+    );
+}
+
+template<class A, class B, std::enable_if_t<detail::are_vector_expression_operands_v<A, B> && can_be_subtracted_v<typename A::mathematical_field_type, typename B::mathematical_field_type>, int> = 0>
+auto operator-(const A& a, const B& b)
+{
+    return detail::make_vector_expression<subtraction_result_t<typename A::mathematical_field_type, typename B::mathematical_field_type>, A::dimension>(
+        [ea = detail::vector_expression_element(a), eb = detail::vector_expression_element(b)](size_t index) { return ea(index) - eb(index); }
+    );
+}
+
+//vector-scalar operators
+
+template<class T, size_t D, class E>
+auto operator-(const vector_expression<T, D, E>& a)
+{
+    return detail::make_vector_expression<T, D>(
+        [ea = detail::vector_expression_element(a)](size_t index) { return -ea(index); }
+    );
+}
+
+template<class A, class TO, std::enable_if_t<detail::is_vector_expression_operand_v<A> && can_be_multiplied_v<typename A::mathematical_field_type, TO> && std::is_convertible_v<TO, typename A::mathematical_field_type>, int> = 0>
+auto operator*(const A& a, const TO& v)
+{
+    return detail::make_vector_expression<multiplication_result_t<typename A::mathematical_field_type, TO>, A::dimension>(
+        [ea = detail::vector_expression_element(a), v](size_t index) { return ea(index) * v; }
+    );
+}
+
+template<class T, size_t D, class E, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+auto operator*(const TO& v, const vector_expression<T, D, E>& a)
+{
+    return a * v;
+}
+
+template<class A, class TO, std::enable_if_t<detail::is_vector_expression_operand_v<A> && can_be_divided_v<typename A::mathematical_field_type, TO> && std::is_convertible_v<TO, typename A::mathematical_field_type>, int> = 0>
+auto operator/(const A& a, const TO& v)
+{
+    return detail::make_vector_expression<division_result_t<typename A::mathematical_field_type, TO>, A::dimension>(
+        [ea = detail::vector_expression_element(a), v](size_t index) { return ea(index) / v; }
+    );
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
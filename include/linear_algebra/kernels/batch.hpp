@@ -0,0 +1,431 @@
+#pragma once
+
+#include "closed_form.hpp"
+#include "gemm.hpp"
+#include "lu.hpp"
+#include "transpose.hpp"
+#include "../memory/storage_allocator.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //batched kernels process groups of small matrices at once, every matrix of group occupies one lane
+    //elements of group are interleaved (structure of arrays) by transposing group in registers, so every arithmetic
+    //operation of formula is applied to all lanes by single loop which compiler turns into simd instructions
+    //i-th matrix of batch starts stride elements after (i-1)-th one (stride 0 repeats single matrix)
+
+    //matrices in single group (lane type fills one cache line, which is as wide as the widest simd register)
+    template<class T>
+    constexpr size_t batch_lanes_v = sizeof(T) < storage_alignment ? storage_alignment / sizeof(T) : 1;
+
+    //interleaved kernels are used for matrices of up to that many elements (bigger ones are processed one by one)
+    constexpr size_t batch_interleave_max_size = closed_form_max_size * closed_form_max_size;
+
+    //matrices processed by single task when batch is processed in parallel
+    constexpr size_t batch_chunk_size = 1024;
+
+    //single element of L matrices (element of l-th matrix is in lane[l])
+    template<class T, size_t L>
+    struct batch_lanes
+    {
+        T lane[L];
+    };
+
+    template<class T, size_t L>
+    inline batch_lanes<T, L> operator+(const batch_lanes<T, L>& a, const batch_lanes<T, L>& b)
+    {
+        batch_lanes<T, L> result;
+        for (size_t l = 0; l < L; l++)
+        {
+            result.lane[l] = a.lane[l] + b.lane[l];
+        }
+        return result;
+    }
+
+    template<class T, size_t L>
+    inline batch_lanes<T, L> operator-(const batch_lanes<T, L>& a, const batch_lanes<T, L>& b)
+    {
+        batch_lanes<T, L> result;
+        for (size_t l = 0; l < L; l++)
+        {
+            result.lane[l] = a.lane[l] - b.lane[l];
+        }
+        return result;
+    }
+
+    template<class T, size_t L>
+    inline batch_lanes<T, L> operator*(const batch_lanes<T, L>& a, const batch_lanes<T, L>& b)
+    {
+        batch_lanes<T, L> result;
+        for (size_t l = 0; l < L; l++)
+        {
+            result.lane[l] = a.lane[l] * b.lane[l];
+        }
+        return result;
+    }
+
+    template<class T, size_t L>
+    inline batch_lanes<T, L> operator-(const batch_lanes<T, L>& a)
+    {
+        batch_lanes<T, L> result;
+        for (size_t l = 0; l < L; l++)
+        {
+            result.lane[l] = -a.lane[l];
+        }
+        return result;
+    }
+
+    //interleaves S elements of lanes matrices starting at a (unused lanes repeat last matrix, their results are never written)
+    template<size_t S, class T, size_t L>
+    inline void batch_gather(batch_lanes<T, L>* out, size_t lanes, const T* a, size_t stride)
+    {
+        static_assert(sizeof(batch_lanes<T, L>) == L * sizeof(T), "Lanes of consecutive elements must be contiguous!");
+
+        transpose_block(lanes, S, a, stride, out[0].lane, L);
+
+        for (size_t e = 0; e < S; e++)
+        {
+            for (size_t l = lanes; l < L; l++)
+            {
+                out[e].lane[l] = out[e].lane[lanes - 1];
+            }
+        }
+    }
+
+    //writes S elements of lanes matrices back to memory starting at c
+    //lanes marked in skipped (if given) are not written
+    template<size_t S, class T, size_t L>
+    inline void batch_scatter(const batch_lanes<T, L>* in, size_t lanes, T* c, size_t stride, const bool* skipped = nullptr)
+    {
+        if (!skipped || std::none_of(skipped, skipped + lanes, [](bool skip) { return skip; }))
+        {
+            transpose_block(S, lanes, in[0].lane, L, c, stride);
+            return;
+        }
+
+        for (size_t l = 0; l < lanes; l++)
+        {
+            if (!skipped[l])
+            {
+                for (size_t e = 0; e < S; e++)
+                {
+                    c[l * stride + e] = in[e].lane[l];
+                }
+            }
+        }
+    }
+
+    ///<summary>
+    /// calls kernel(first, count) for chunks of batch of n matrices (in parallel if requested)
+    ///</summary>
+    /// <returns> sum of values returned by kernel </returns>
+    template<class F>
+    inline size_t batch_for_each_chunk(size_t n, bool parallel, F&& kernel)
+    {
+        if (parallel && n > batch_chunk_size)
+        {
+            const size_t chunks = (n + batch_chunk_size - 1) / batch_chunk_size;
+
+            //every chunk writes its own partial sum, partial sums are added after loop
+            storage_vector<size_t> results(chunks);
+
+            parallel_for(chunks, true, [&](size_t chunk) {
+                const size_t first = chunk * batch_chunk_size;
+                results[chunk] = kernel(first, std::min(batch_chunk_size, n - first));
+            });
+
+            return std::accumulate(results.begin(), results.end(), static_cast<size_t>(0));
+        }
+        else
+        {
+            return kernel(static_cast<size_t>(0), n);
+        }
+    }
+
+    //calls kernel(first, lanes) for groups of batch_lanes_v<T> consecutive matrices of chunk
+    template<class T, class F>
+    inline size_t batch_for_each_group(size_t first, size_t count, F&& kernel)
+    {
+        constexpr size_t L = batch_lanes_v<T>;
+
+        size_t result = 0;
+        for (size_t group = first; group < first + count; group += L)
+        {
+            result += kernel(group, std::min(L, first + count - group));
+        }
+        return result;
+    }
+
+    ///<summary>
+    /// c_i = a_i * b_i for batch of n row-major matrices (a_i is N x M, b_i is M x K, c_i is N x K)
+    ///</summary>
+    template<class T, size_t N, size_t M, size_t K>
+    void batch_multiply(size_t n, const T* a, size_t stride_a, const T* b, size_t stride_b, T* c, size_t stride_c, bool parallel)
+    {
+        constexpr size_t L = batch_lanes_v<T>;
+
+        batch_for_each_chunk(n, parallel, [&](size_t first, size_t count) {
+            if constexpr (N * M <= batch_interleave_max_size && M * K <= batch_interleave_max_size && N * K <= batch_interleave_max_size)
+            {
+                //matrix repeated for whole batch (stride 0) is interleaved only once
+                batch_lanes<T, L> la[N * M];
+                if (stride_a == 0)
+                {
+                    batch_gather<N * M>(la, L, a, 0);
+                }
+
+                return batch_for_each_group<T>(first, count, [&](size_t group, size_t lanes) {
+                    batch_lanes<T, L> lb[M * K];
+                    batch_lanes<T, L> lc[N * K];
+
+                    if (stride_a != 0)
+                    {
+                        batch_gather<N * M>(la, lanes, a + group * stride_a, stride_a);
+                    }
+                    batch_gather<M * K>(lb, lanes, b + group * stride_b, stride_b);
+
+                    for (size_t i = 0; i < N; i++)
+                    {
+                        for (size_t j = 0; j < K; j++)
+                        {
+                            batch_lanes<T, L> sum = la[i * M] * lb[j];
+                            for (size_t p = 1; p < M; p++)
+                            {
+                                sum = sum + la[i * M + p] * lb[p * K + j];
+                            }
+                            lc[i * K + j] = sum;
+                        }
+                    }
+
+                    batch_scatter<N * K>(lc, lanes, c + group * stride_c, stride_c);
+                    return static_cast<size_t>(0);
+                });
+            }
+            else
+            {
+                for (size_t i = first; i < first + count; i++)
+                {
+                    multiply_add(N, K, M, get_multiplicative_identity<T>(), a + i * stride_a, M, 1, b + i * stride_b, K, 1, get_additive_identity<T>(), c + i * stride_c, K, 1, false);
+                }
+                return static_cast<size_t>(0);
+            }
+        });
+    }
+
+    //determinant of LU factors (product of diagonal of U, every row swap changes its sign)
+    template<class T, size_t N>
+    inline T batch_lu_determinant(const T* lu, const size_t* pivots)
+    {
+        T determinant = get_multiplicative_identity<T>();
+
+        for (size_t k = 0; k < N; k++)
+        {
+            determinant *= lu[k * N + k];
+
+            if (pivots[k] != k)
+            {
+                determinant = -determinant;
+            }
+        }
+
+        return determinant;
+    }
+
+    ///<summary>
+    /// writes determinants of batch of n row-major NxN matrices to out
+    ///</summary>
+    template<class T, size_t N>
+    void batch_determinant(size_t n, const T* a, size_t stride_a, T* out, bool parallel)
+    {
+        constexpr size_t L = batch_lanes_v<T>;
+
+        batch_for_each_chunk(n, parallel, [&](size_t first, size_t count) {
+            if constexpr (N >= 2 && use_closed_form_v<N>)
+            {
+                return batch_for_each_group<T>(first, count, [&](size_t group, size_t lanes) {
+                    batch_lanes<T, L> la[N * N];
+                    batch_lanes<T, L> adjugate[N * N];
+
+                    batch_gather<N * N>(la, lanes, a + group * stride_a, stride_a);
+                    const batch_lanes<T, L> determinant = closed_form_adjugate<batch_lanes<T, L>, N>(la, adjugate);
+
+                    std::copy_n(determinant.lane, lanes, out + group);
+                    return static_cast<size_t>(0);
+                });
+            }
+            else
+            {
+                T lu[N * N];
+                size_t pivots[N];
+
+                for (size_t i = first; i < first + count; i++)
+                {
+                    std::copy_n(a + i * stride_a, N * N, lu);
+                    out[i] = lu_factorize(N, lu, N, pivots) ? batch_lu_determinant<T, N>(lu, pivots) : get_additive_identity<T>();
+                }
+                return static_cast<size_t>(0);
+            }
+        });
+    }
+
+    //inverse_determinant = 1 / determinant for every lane, singular lanes are marked (their inverse_determinant is 1)
+    //returns number of singular matrices among first lanes lanes
+    template<class T, size_t L>
+    inline size_t batch_inverse_determinant(const batch_lanes<T, L>& determinant, size_t lanes, batch_lanes<T, L>& inverse_determinant, bool* singular)
+    {
+        //divisions are done by separate loop, so all of them are done by single simd instruction
+        batch_lanes<T, L> divisor;
+        for (size_t l = 0; l < L; l++)
+        {
+            singular[l] = equal(determinant.lane[l], get_additive_identity<T>());
+            divisor.lane[l] = singular[l] ? get_multiplicative_identity<T>() : determinant.lane[l];
+        }
+
+        for (size_t l = 0; l < L; l++)
+        {
+            inverse_determinant.lane[l] = get_multiplicative_identity<T>() / divisor.lane[l];
+        }
+
+        return static_cast<size_t>(std::count(singular, singular + lanes, true));
+    }
+
+    ///<summary>
+    /// writes inverses of batch of n row-major NxN matrices to out (out must not overlap with a)
+    ///</summary>
+    /// <returns> number of singular matrices (their inverses are not written) </returns>
+    template<class T, size_t N>
+    size_t batch_inverse(size_t n, const T* a, size_t stride_a, T* out, size_t stride_out, bool parallel)
+    {
+        constexpr size_t L = batch_lanes_v<T>;
+
+        return batch_for_each_chunk(n, parallel, [&](size_t first, size_t count) {
+            if constexpr (N >= 2 && use_closed_form_v<N>)
+            {
+                return batch_for_each_group<T>(first, count, [&](size_t group, size_t lanes) {
+                    batch_lanes<T, L> la[N * N];
+                    batch_lanes<T, L> adjugate[N * N];
+                    batch_lanes<T, L> inverse_determinant;
+                    bool singular[L];
+
+                    batch_gather<N * N>(la, lanes, a + group * stride_a, stride_a);
+                    const batch_lanes<T, L> determinant = closed_form_adjugate<batch_lanes<T, L>, N>(la, adjugate);
+                    const size_t singular_count = batch_inverse_determinant(determinant, lanes, inverse_determinant, singular);
+
+                    for (size_t e = 0; e < N * N; e++)
+                    {
+                        adjugate[e] = adjugate[e] * inverse_determinant;
+                    }
+
+                    batch_scatter<N * N>(adjugate, lanes, out + group * stride_out, stride_out, singular);
+                    return singular_count;
+                });
+            }
+            else if constexpr (N == 1)
+            {
+                size_t singular_count = 0;
+
+                for (size_t i = first; i < first + count; i++)
+                {
+                    singular_count += closed_form_inverse<T, N>(a + i * stride_a, out + i * stride_out) ? 0 : 1;
+                }
+                return singular_count;
+            }
+            else
+            {
+                size_t singular_count = 0;
+                T lu[N * N];
+                size_t pivots[N];
+
+                for (size_t i = first; i < first + count; i++)
+                {
+                    std::copy_n(a + i * stride_a, N * N, lu);
+
+                    if (!lu_factorize(N, lu, N, pivots))
+                    {
+                        singular_count++;
+                        continue;
+                    }
+
+                    //inverse is obtained by solving A * X = I
+                    T* inverse = out + i * stride_out;
+                    std::fill_n(inverse, N * N, get_additive_identity<T>());
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        inverse[k * N + k] = get_multiplicative_identity<T>();
+                    }
+
+                    lu_solve(N, lu, N, pivots, inverse, N, N);
+                }
+                return singular_count;
+            }
+        });
+    }
+
+    ///<summary>
+    /// solves a_i * x_i = b_i for batch of n row-major NxN matrices and vectors of N elements
+    ///</summary>
+    /// <returns> number of singular matrices (their solutions are not written) </returns>
+    template<class T, size_t N>
+    size_t batch_solve(size_t n, const T* a, size_t stride_a, const T* b, size_t stride_b, T* x, size_t stride_x, bool parallel)
+    {
+        constexpr size_t L = batch_lanes_v<T>;
+
+        return batch_for_each_chunk(n, parallel, [&](size_t first, size_t count) {
+            if constexpr (N >= 2 && use_closed_form_v<N>)
+            {
+                return batch_for_each_group<T>(first, count, [&](size_t group, size_t lanes) {
+                    batch_lanes<T, L> la[N * N];
+                    batch_lanes<T, L> lb[N];
+                    batch_lanes<T, L> lx[N];
+                    batch_lanes<T, L> adjugate[N * N];
+                    batch_lanes<T, L> inverse_determinant;
+                    bool singular[L];
+
+                    batch_gather<N * N>(la, lanes, a + group * stride_a, stride_a);
+                    batch_gather<N>(lb, lanes, b + group * stride_b, stride_b);
+                    const batch_lanes<T, L> determinant = closed_form_adjugate<batch_lanes<T, L>, N>(la, adjugate);
+                    const size_t singular_count = batch_inverse_determinant(determinant, lanes, inverse_determinant, singular);
+
+                    //x = adj(A) * b / det(A)
+                    for (size_t i = 0; i < N; i++)
+                    {
+                        batch_lanes<T, L> sum = adjugate[i * N] * lb[0];
+                        for (size_t k = 1; k < N; k++)
+                        {
+                            sum = sum + adjugate[i * N + k] * lb[k];
+                        }
+                        lx[i] = sum * inverse_determinant;
+                    }
+
+                    batch_scatter<N>(lx, lanes, x + group * stride_x, stride_x, singular);
+                    return singular_count;
+                });
+            }
+            else
+            {
+                size_t singular_count = 0;
+                T lu[N * N];
+                size_t pivots[N];
+
+                for (size_t i = first; i < first + count; i++)
+                {
+                    std::copy_n(a + i * stride_a, N * N, lu);
+
+                    if (!lu_factorize(N, lu, N, pivots))
+                    {
+                        singular_count++;
+                        continue;
+                    }
+
+                    T* solution = x + i * stride_x;
+                    std::copy_n(b + i * stride_b, N, solution);
+                    lu_solve_vector(N, lu, N, pivots, solution);
+                }
+                return singular_count;
+            }
+        });
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
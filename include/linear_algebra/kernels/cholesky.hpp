@@ -0,0 +1,289 @@
+#pragma once
+
+#include "lu.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    /*
+        factorizations of symmetric matrices (A = L * L^T and A = L * D * L^T)
+        only lower triangle of A is read and overwritten by factors (blocked algorithm uses diagonal blocks of upper triangle as workspace)
+        (half of LU work: rows of L are computed as inner products of already computed rows)
+    */
+
+    //sum of x[k] * y[k] * (d ? d[k] : 1) for k in [0, n)
+    template<class T>
+    inline T cholesky_inner_product(size_t n, const T* x, const T* y, const T* d)
+    {
+        T sum = get_additive_identity<T>();
+
+        if (d)
+        {
+            for (size_t k = 0; k < n; k++)
+            {
+                sum += x[k] * d[k] * y[k];
+            }
+        }
+        else
+        {
+            for (size_t k = 0; k < n; k++)
+            {
+                sum += x[k] * y[k];
+            }
+        }
+
+        return sum;
+    }
+
+    ///<summary>
+    /// unblocked left-looking factorization of n x n row-major matrix (rows below diagonal are computed in parallel if parallel is set)
+    /// <para>if Unit is false A = L * L^T (L is written to lower triangle including diagonal),
+    /// otherwise A = L * D * L^T (unit L is written below diagonal and D to diagonal)</para>
+    ///</summary>
+    /// <returns> false if matrix is not positive definite (LLT) or zero pivot was found (LDLT), factorization stops at that column </returns>
+    template<bool Unit, class T>
+    bool cholesky_factorize_unblocked(size_t n, T* a, size_t lda, bool parallel = false)
+    {
+        //diagonal of LDLT factorization is gathered, so inner products read it contiguously
+        storage_vector<T> diagonal(Unit ? n : 0);
+        const T* d = Unit ? diagonal.data() : nullptr;
+
+        for (size_t j = 0; j < n; j++)
+        {
+            T* a_j = a + j * lda;
+
+            const T pivot = a_j[j] - cholesky_inner_product(j, a_j, a_j, d);
+
+            if constexpr (Unit)
+            {
+                if (equal(pivot, get_additive_identity<T>()))
+                {
+                    return false;
+                }
+
+                diagonal[j] = pivot;
+                a_j[j] = pivot;
+            }
+            else
+            {
+                if (!(pivot > get_additive_identity<T>()))
+                {
+                    return false;
+                }
+
+                a_j[j] = functions_implementation<T>::sqrt(pivot);
+            }
+
+            const T divisor = a_j[j];
+
+            parallel_for(j + 1, n, parallel && parallel_elimination(n - j - 1, j), [&](size_t row) {
+                T* a_row = a + row * lda;
+                a_row[j] = (a_row[j] - cholesky_inner_product(j, a_row, a_j, d)) / divisor;
+            });
+        }
+
+        return true;
+    }
+
+    //solves X * L^T = B in place for rows x n matrix B (L is n x n lower triangular part of l, unit if Unit is set)
+    template<bool Unit, class T>
+    void cholesky_solve_transposed_right(size_t rows, size_t n, const T* l, size_t lda, T* b, size_t ldb, bool parallel)
+    {
+        parallel_for(rows, parallel, [&](size_t row) {
+            T* b_row = b + row * ldb;
+
+            for (size_t column = 0; column < n; column++)
+            {
+                const T* l_column = l + column * lda;
+                const T value = b_row[column] - cholesky_inner_product(column, b_row, l_column, static_cast<const T*>(nullptr));
+                b_row[column] = Unit ? value : value / l_column[column];
+            }
+        });
+    }
+
+    //columns of single panel of blocked factorization
+    constexpr size_t cholesky_block_size = 128;
+
+    //matrices smaller than this are factored by unblocked algorithm
+    constexpr size_t cholesky_blocked_min_size = 2 * cholesky_block_size;
+
+    ///<summary>
+    /// blocked right-looking factorization of n x n row-major matrix (see cholesky_factorize_unblocked)
+    /// <para>for every block of columns: diagonal block is factored, block column of L is computed by triangular solve
+    /// and lower triangle of trailing matrix is updated by products of block rows (blocks of rows are updated in parallel)</para>
+    ///</summary>
+    template<bool Unit, class T>
+    bool cholesky_factorize_blocked(size_t n, T* a, size_t lda, bool parallel)
+    {
+        //block column of L multiplied by D (LDLT only)
+        storage_vector<T> scaled(Unit ? (n - std::min(n, cholesky_block_size)) * cholesky_block_size : 0);
+
+        for (size_t k = 0; k < n; k += cholesky_block_size)
+        {
+            const size_t kb = std::min(cholesky_block_size, n - k);
+            const size_t rest = n - k - kb;
+
+            T* a11 = a + k * lda + k;
+            T* a21 = a11 + kb * lda;
+            T* a22 = a21 + kb;
+
+            if (!cholesky_factorize_unblocked<Unit>(kb, a11, lda))
+            {
+                return false;
+            }
+
+            if (rest == 0)
+            {
+                break;
+            }
+
+            //L21 = A21 * L11^-T (and L21 = L21 * D11^-1 for LDLT)
+            cholesky_solve_transposed_right<Unit>(rest, kb, a11, lda, a21, lda, parallel && parallel_elimination(rest * kb / 2, kb));
+
+            const T* left = a21;
+            size_t ldl = lda;
+
+            if constexpr (Unit)
+            {
+                parallel_for(rest, parallel && parallel_elementwise(rest * kb), [&](size_t row) {
+                    T* a_row = a21 + row * lda;
+                    T* scaled_row = scaled.data() + row * kb;
+
+                    for (size_t column = 0; column < kb; column++)
+                    {
+                        scaled_row[column] = a_row[column];
+                        a_row[column] /= a11[column * lda + column];
+                    }
+                });
+
+                left = scaled.data();
+                ldl = kb;
+            }
+
+            //A22 = A22 - L21 * (D11) * L21^T, only blocks on and below diagonal are updated
+            const size_t row_blocks = (rest + cholesky_block_size - 1) / cholesky_block_size;
+
+            parallel_for(row_blocks, parallel && parallel_gemm(rest, rest / 2, kb), [&](size_t block) {
+                const size_t first_row = block * cholesky_block_size;
+                const size_t rows = std::min(cholesky_block_size, rest - first_row);
+
+                gemm<T>(
+                    rows, first_row + rows, kb,
+                    static_cast<T>(-1),
+                    left + first_row * ldl, ldl, 1,
+                    a21, 1, lda,
+                    static_cast<T>(1),
+                    a22 + first_row * lda, lda, 1
+                );
+            });
+        }
+
+        return true;
+    }
+
+    ///<summary>
+    /// in place factorization of symmetric n x n row-major matrix (A = L * L^T if Unit is false, A = L * D * L^T otherwise)
+    /// <para>big matrices of types supported by packed matrix multiplication are factored by blocked algorithm</para>
+    ///</summary>
+    /// <param name="parallel"> whether steps expensive enough to go parallel (see parallel_thresholds) may be split over threads </param>
+    /// <returns> false if matrix is not positive definite (LLT) or zero pivot was found (LDLT) </returns>
+    template<bool Unit, class T>
+    bool cholesky_factorize(size_t n, T* a, size_t lda, bool parallel = false)
+    {
+        if constexpr (use_gemm_kernel_v<T, T>)
+        {
+            if (n >= cholesky_blocked_min_size)
+            {
+                return cholesky_factorize_blocked<Unit>(n, a, lda, parallel);
+            }
+        }
+
+        return cholesky_factorize_unblocked<Unit>(n, a, lda, parallel);
+    }
+
+    //solves L * (D) * L^T * X = B for columns [first_column, first_column + columns) of B
+    template<bool Unit, class T>
+    void cholesky_solve_columns(size_t n, const T* l, size_t lda, T* b, size_t ldb, size_t first_column, size_t columns)
+    {
+        b += first_column;
+
+        //L * Y = B
+        for (size_t row = 0; row < n; row++)
+        {
+            const T* l_row = l + row * lda;
+            T* b_row = b + row * ldb;
+
+            for (size_t k = 0; k < row; k++)
+            {
+                const T factor = l_row[k];
+                const T* b_k = b + k * ldb;
+                for (size_t column = 0; column < columns; column++)
+                {
+                    b_row[column] -= factor * b_k[column];
+                }
+            }
+
+            if constexpr (!Unit)
+            {
+                for (size_t column = 0; column < columns; column++)
+                {
+                    b_row[column] /= l_row[row];
+                }
+            }
+        }
+
+        if constexpr (Unit)
+        {
+            //D * Z = Y
+            for (size_t row = 0; row < n; row++)
+            {
+                T* b_row = b + row * ldb;
+                for (size_t column = 0; column < columns; column++)
+                {
+                    b_row[column] /= l[row * lda + row];
+                }
+            }
+        }
+
+        //L^T * X = Z, row of L is column of L^T, so every computed row of X is subtracted from rows above it
+        for (size_t row = n; row-- > 0;)
+        {
+            const T* l_row = l + row * lda;
+            T* b_row = b + row * ldb;
+
+            if constexpr (!Unit)
+            {
+                for (size_t column = 0; column < columns; column++)
+                {
+                    b_row[column] /= l_row[row];
+                }
+            }
+
+            for (size_t k = 0; k < row; k++)
+            {
+                const T factor = l_row[k];
+                T* b_k = b + k * ldb;
+                for (size_t column = 0; column < columns; column++)
+                {
+                    b_k[column] -= factor * b_row[column];
+                }
+            }
+        }
+    }
+
+    ///<summary>
+    /// solves A * X = B using factors computed by cholesky_factorize (B is overwritten by X)
+    /// <para>B is n x columns row-major matrix with row stride ldb</para>
+    ///</summary>
+    /// <param name="parallel"> whether independent groups of columns should be solved in parallel </param>
+    template<bool Unit, class T>
+    void cholesky_solve(size_t n, const T* l, size_t lda, T* b, size_t ldb, size_t columns, bool parallel = false)
+    {
+        lu_for_each_column_chunk(columns, parallel, [&](size_t first_column, size_t count) {
+            cholesky_solve_columns<Unit>(n, l, lda, b, ldb, first_column, count);
+        });
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
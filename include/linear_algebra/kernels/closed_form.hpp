@@ -0,0 +1,174 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //closed-form (cofactor/adjugate) formulas are used for square matrices up to this size,
+    //bigger ones use LU factorization
+    constexpr size_t closed_form_max_size = 4;
+
+    template<size_t N>
+    constexpr bool use_closed_form_v = N <= closed_form_max_size;
+
+    //returns determinant of row-major NxN matrix a (N <= closed_form_max_size)
+    template<class T, size_t N>
+    inline T closed_form_determinant(const T* a)
+    {
+        static_assert(use_closed_form_v<N>, "Closed-form determinant is available only for small matrices!");
+
+        if constexpr (N == 1)
+        {
+            return a[0];
+        }
+        if constexpr (N == 2)
+        {
+            return a[0] * a[3] - a[1] * a[2];
+        }
+        if constexpr (N == 3)
+        {
+            return
+                a[0] * (a[4] * a[8] - a[5] * a[7]) -
+                a[1] * (a[3] * a[8] - a[5] * a[6]) +
+                a[2] * (a[3] * a[7] - a[4] * a[6]);
+        }
+        if constexpr (N == 4)
+        {
+            //expansion by 2x2 minors of two upper and two lower rows (Laplace expansion)
+            const T s0 = a[0] * a[5] - a[4] * a[1];
+            const T s1 = a[0] * a[6] - a[4] * a[2];
+            const T s2 = a[0] * a[7] - a[4] * a[3];
+            const T s3 = a[1] * a[6] - a[5] * a[2];
+            const T s4 = a[1] * a[7] - a[5] * a[3];
+            const T s5 = a[2] * a[7] - a[6] * a[3];
+
+            const T c5 = a[10] * a[15] - a[14] * a[11];
+            const T c4 = a[9] * a[15] - a[13] * a[11];
+            const T c3 = a[9] * a[14] - a[13] * a[10];
+            const T c2 = a[8] * a[15] - a[12] * a[11];
+            const T c1 = a[8] * a[14] - a[12] * a[10];
+            const T c0 = a[8] * a[13] - a[12] * a[9];
+
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    }
+
+    ///<summary>
+    /// writes adjugate (transposed cofactor matrix) of row-major NxN matrix a to out (2 <= N <= closed_form_max_size, out must not be a)
+    /// <para>formulas have no branches, so T can also be lane type of batched kernels (see batch_lanes)</para>
+    ///</summary>
+    /// <returns> determinant of a </returns>
+    template<class T, size_t N>
+    inline T closed_form_adjugate(const T* a, T* out)
+    {
+        static_assert(N >= 2 && use_closed_form_v<N>, "Closed-form adjugate is available only for small matrices!");
+
+        if constexpr (N == 2)
+        {
+            out[0] = a[3];
+            out[1] = -a[1];
+            out[2] = -a[2];
+            out[3] = a[0];
+
+            return a[0] * a[3] - a[1] * a[2];
+        }
+        if constexpr (N == 3)
+        {
+            //cofactors of first row are reused by determinant
+            out[0] = a[4] * a[8] - a[5] * a[7];
+            out[1] = a[2] * a[7] - a[1] * a[8];
+            out[2] = a[1] * a[5] - a[2] * a[4];
+            out[3] = a[5] * a[6] - a[3] * a[8];
+            out[4] = a[0] * a[8] - a[2] * a[6];
+            out[5] = a[2] * a[3] - a[0] * a[5];
+            out[6] = a[3] * a[7] - a[4] * a[6];
+            out[7] = a[1] * a[6] - a[0] * a[7];
+            out[8] = a[0] * a[4] - a[1] * a[3];
+
+            return a[0] * out[0] + a[1] * out[3] + a[2] * out[6];
+        }
+        if constexpr (N == 4)
+        {
+            //2x2 minors of two upper (s) and two lower (c) rows are shared by determinant and all cofactors
+            const T s0 = a[0] * a[5] - a[4] * a[1];
+            const T s1 = a[0] * a[6] - a[4] * a[2];
+            const T s2 = a[0] * a[7] - a[4] * a[3];
+            const T s3 = a[1] * a[6] - a[5] * a[2];
+            const T s4 = a[1] * a[7] - a[5] * a[3];
+            const T s5 = a[2] * a[7] - a[6] * a[3];
+
+            const T c5 = a[10] * a[15] - a[14] * a[11];
+            const T c4 = a[9] * a[15] - a[13] * a[11];
+            const T c3 = a[9] * a[14] - a[13] * a[10];
+            const T c2 = a[8] * a[15] - a[12] * a[11];
+            const T c1 = a[8] * a[14] - a[12] * a[10];
+            const T c0 = a[8] * a[13] - a[12] * a[9];
+
+            out[0] = a[5] * c5 - a[6] * c4 + a[7] * c3;
+            out[1] = -a[1] * c5 + a[2] * c4 - a[3] * c3;
+            out[2] = a[13] * s5 - a[14] * s4 + a[15] * s3;
+            out[3] = -a[9] * s5 + a[10] * s4 - a[11] * s3;
+
+            out[4] = -a[4] * c5 + a[6] * c2 - a[7] * c1;
+            out[5] = a[0] * c5 - a[2] * c2 + a[3] * c1;
+            out[6] = -a[12] * s5 + a[14] * s2 - a[15] * s1;
+            out[7] = a[8] * s5 - a[10] * s2 + a[11] * s1;
+
+            out[8] = a[4] * c4 - a[5] * c2 + a[7] * c0;
+            out[9] = -a[0] * c4 + a[1] * c2 - a[3] * c0;
+            out[10] = a[12] * s4 - a[13] * s2 + a[15] * s0;
+            out[11] = -a[8] * s4 + a[9] * s2 - a[11] * s0;
+
+            out[12] = -a[4] * c3 + a[5] * c1 - a[6] * c0;
+            out[13] = a[0] * c3 - a[1] * c1 + a[2] * c0;
+            out[14] = -a[12] * s3 + a[13] * s1 - a[14] * s0;
+            out[15] = a[8] * s3 - a[9] * s1 + a[10] * s0;
+
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+    }
+
+    ///<summary>
+    /// writes inverse of row-major NxN matrix a to out (N <= closed_form_max_size, out must not be a)
+    /// <para>inverse is adjugate divided by determinant, formulas have no branches or row swaps</para>
+    ///</summary>
+    /// <returns> false if matrix is singular (out is not written then) </returns>
+    template<class T, size_t N>
+    inline bool closed_form_inverse(const T* a, T* out)
+    {
+        static_assert(use_closed_form_v<N>, "Closed-form inverse is available only for small matrices!");
+
+        if constexpr (N == 1)
+        {
+            if (equal(a[0], get_additive_identity<T>()))
+            {
+                return false;
+            }
+
+            out[0] = get_multiplicative_identity<T>() / a[0];
+        }
+        else
+        {
+            T adjugate[N * N];
+            const T determinant = closed_form_adjugate<T, N>(a, adjugate);
+
+            if (equal(determinant, get_additive_identity<T>()))
+            {
+                return false;
+            }
+
+            const T inverse_determinant = get_multiplicative_identity<T>() / determinant;
+
+            for (size_t i = 0; i < N * N; i++)
+            {
+                out[i] = adjugate[i] * inverse_determinant;
+            }
+        }
+
+        return true;
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "../simd/simd.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //element-wise operations on contiguous arrays of n elements (used by containers with runtime sizes)
+    //arrays of single and double precision numbers use simd kernels, other ones regular loops
+    //if parallel is set, big arrays are split into chunks processed in parallel
+
+    template<class F>
+    inline void elementwise_for_each(size_t n, bool parallel, F&& operation)
+    {
+        simd_for_each_chunk(n, parallel, [&](size_t offset, size_t count) {
+            for (size_t index = offset; index < offset + count; index++)
+            {
+                operation(index);
+            }
+        });
+    }
+
+    //out = x + y
+    template<class T, class TO, class TR>
+    inline void elementwise_add(size_t n, const T* x, const TO* y, TR* out, bool parallel)
+    {
+        if constexpr (use_simd_kernels_v<T, TO> && std::is_same_v<TR, T>)
+        {
+            if (n >= simd_kernels_min_size)
+            {
+                const auto& kernels = get_simd_kernels<T>();
+                simd_for_each_chunk(n, parallel, [&](size_t offset, size_t count) {
+                    kernels.add(count, x + offset, y + offset, out + offset);
+                });
+                return;
+            }
+        }
+
+        elementwise_for_each(n, parallel, [&](size_t index) { out[index] = static_cast<TR>(x[index] + y[index]); });
+    }
+
+    //out = x - y
+    template<class T, class TO, class TR>
+    inline void elementwise_subtract(size_t n, const T* x, const TO* y, TR* out, bool parallel)
+    {
+        if constexpr (use_simd_kernels_v<T, TO> && std::is_same_v<TR, T>)
+        {
+            if (n >= simd_kernels_min_size)
+            {
+                const auto& kernels = get_simd_kernels<T>();
+                simd_for_each_chunk(n, parallel, [&](size_t offset, size_t count) {
+                    kernels.subtract(count, x + offset, y + offset, out + offset);
+                });
+                return;
+            }
+        }
+
+        elementwise_for_each(n, parallel, [&](size_t index) { out[index] = static_cast<TR>(x[index] - y[index]); });
+    }
+
+    //out = x * v
+    template<class T, class TO, class TR>
+    inline void elementwise_scale(size_t n, const T* x, const TO& v, TR* out, bool parallel)
+    {
+        if constexpr (has_simd_kernels_v<T> && std::is_same_v<TR, T> && std::is_convertible_v<TO, T>)
+        {
+            if (n >= simd_kernels_min_size)
+            {
+                const auto& kernels = get_simd_kernels<T>();
+                simd_for_each_chunk(n, parallel, [&](size_t offset, size_t count) {
+                    kernels.scale(count, static_cast<T>(v), x + offset, out + offset);
+                });
+                return;
+            }
+        }
+
+        elementwise_for_each(n, parallel, [&](size_t index) { out[index] = static_cast<TR>(x[index] * v); });
+    }
+
+    //out = x / v
+    template<class T, class TO, class TR>
+    inline void elementwise_divide(size_t n, const T* x, const TO& v, TR* out, bool parallel)
+    {
+        if constexpr (has_simd_kernels_v<T> && std::is_same_v<TR, T> && std::is_convertible_v<TO, T>)
+        {
+            if (n >= simd_kernels_min_size)
+            {
+                const auto& kernels = get_simd_kernels<T>();
+                simd_for_each_chunk(n, parallel, [&](size_t offset, size_t count) {
+                    kernels.divide(count, static_cast<T>(v), x + offset, out + offset);
+                });
+                return;
+            }
+        }
+
+        elementwise_for_each(n, parallel, [&](size_t index) { out[index] = static_cast<TR>(x[index] / v); });
+    }
+
+    //out = -x
+    template<class T>
+    inline void elementwise_negate(size_t n, const T* x, T* out, bool parallel)
+    {
+        elementwise_for_each(n, parallel, [&](size_t index) { out[index] = -x[index]; });
+    }
+
+    //returns x * y (inner product)
+    template<class T, class TO>
+    inline inner_product_result_t<T, TO> elementwise_dot(size_t n, const T* x, const TO* y)
+    {
+        if constexpr (use_simd_kernels_v<T, TO>)
+        {
+            if (n >= simd_kernels_min_size)
+            {
+                return get_simd_kernels<T>().dot(n, x, y);
+            }
+        }
+
+        auto result = get_additive_identity<inner_product_result_t<T, TO>>();
+
+        for (size_t index = 0; index < n; index++)
+        {
+            result += x[index] * y[index];
+        }
+
+        return result;
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
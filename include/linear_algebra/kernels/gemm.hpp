@@ -0,0 +1,326 @@
+#pragma once
+
+#include "../simd/simd.hpp"
+#include "../memory/storage_allocator.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    /*
+        blocking parameters of packed matrix multiplication kernel
+
+        mr x nr     - size of register tile computed by micro-kernel (accumulators are kept in registers),
+                      for float and double tile size is given by micro-kernel of active instruction set
+        kc          - depth of packed panels, mr x kc panel of A and kc x nr panel of B should fit in L1 cache
+        mc          - rows of packed block of A, mc x kc block should fit in L2 cache
+        nc          - columns of packed block of B, kc x nc block should fit in L3 cache
+    */
+    template<class T>
+    struct gemm_blocking
+    {
+        static constexpr size_t mr = 6;
+        static constexpr size_t nr = sizeof(T) >= 8 ? 8 : 16;
+        static constexpr size_t kc = 256;
+        static constexpr size_t mc = 144;
+        static constexpr size_t nc = 2048;
+
+        //mc and nc are multiples of every register tile size used by simd micro-kernels
+        static_assert(mc % mr == 0 && mc % 8 == 0 && nc % nr == 0 && nc % 32 == 0, "Block sizes must be multiples of register tile size!");
+    };
+
+    //packs mc x kc block of A into row panels of height mr (panel layout: kc columns of mr elements)
+    //rows outside of matrix are filled with 0-oes so micro-kernel does not need to handle edges
+    template<class T>
+    inline void gemm_pack_a(size_t mr, size_t mc, size_t kc, const T* a, size_t rsa, size_t csa, T* packed)
+    {
+        for (size_t panel = 0; panel < mc; panel += mr)
+        {
+            const size_t rows = std::min(mr, mc - panel);
+
+            for (size_t p = 0; p < kc; p++)
+            {
+                size_t i = 0;
+                for (; i < rows; i++)
+                {
+                    packed[i] = a[(panel + i) * rsa + p * csa];
+                }
+                for (; i < mr; i++)
+                {
+                    packed[i] = static_cast<T>(0);
+                }
+                packed += mr;
+            }
+        }
+    }
+
+    //packs kc x nc block of B into column panels of width nr (panel layout: kc rows of nr elements)
+    template<class T>
+    inline void gemm_pack_b(size_t nr, size_t kc, size_t nc, const T* b, size_t rsb, size_t csb, T* packed)
+    {
+        for (size_t panel = 0; panel < nc; panel += nr)
+        {
+            const size_t columns = std::min(nr, nc - panel);
+
+            for (size_t p = 0; p < kc; p++)
+            {
+                size_t j = 0;
+                for (; j < columns; j++)
+                {
+                    packed[j] = b[p * rsb + (panel + j) * csb];
+                }
+                for (; j < nr; j++)
+                {
+                    packed[j] = static_cast<T>(0);
+                }
+                packed += nr;
+            }
+        }
+    }
+
+    //columns of C computed by single task of parallel multiplication (multiple of every register tile width)
+    constexpr size_t gemm_task_columns = 512;
+
+    //scales m x n matrix C by beta (used when there is nothing to multiply, i.e k == 0)
+    template<class T>
+    inline void gemm_scale(size_t m, size_t n, T beta, T* c, size_t rsc, size_t csc)
+    {
+        for (size_t i = 0; i < m; i++)
+        {
+            for (size_t j = 0; j < n; j++)
+            {
+                c[i * rsc + j * csc] = beta == static_cast<T>(0) ? static_cast<T>(0) : beta * c[i * rsc + j * csc];
+            }
+        }
+    }
+
+    ///<summary>
+    /// general matrix multiplication C = alpha * A * B + beta * C (GotoBLAS/BLIS style packed, cache blocked algorithm)
+    /// <para>every operand is described by pointer to its first element, row stride and column stride</para>
+    /// <para>(row-major matrix NxM has strides M, 1 and its transposition can be described by strides 1, M)</para>
+    ///</summary>
+    /// <param name="m"> rows of A and C </param>
+    /// <param name="n"> columns of B and C </param>
+    /// <param name="k"> columns of A and rows of B </param>
+    /// <param name="parallel"> whether blocks of C should be computed in parallel </param>
+    template<class T>
+    void gemm(
+        size_t m, size_t n, size_t k,
+        T alpha,
+        const T* a, size_t rsa, size_t csa,
+        const T* b, size_t rsb, size_t csb,
+        T beta,
+        T* c, size_t rsc, size_t csc,
+        bool parallel = false)
+    {
+        using blocking = gemm_blocking<T>;
+        using micro_kernel_type = void(*)(size_t, T, const T*, const T*, T, T*, size_t, size_t, size_t, size_t);
+
+        if (m == 0 || n == 0)
+        {
+            return;
+        }
+
+        if (k == 0 || alpha == static_cast<T>(0))
+        {
+            gemm_scale(m, n, beta, c, rsc, csc);
+            return;
+        }
+
+        size_t mr = blocking::mr;
+        size_t nr = blocking::nr;
+        micro_kernel_type micro_kernel = &simd_generic::gemm_micro_kernel<T, blocking::mr, blocking::nr>;
+
+        if constexpr (has_simd_kernels_v<T>)
+        {
+            const auto& kernels = get_simd_kernels<T>();
+            mr = kernels.gemm_mr;
+            nr = kernels.gemm_nr;
+            micro_kernel = kernels.gemm_micro_kernel;
+        }
+
+        const size_t packed_b_columns = std::min(n, blocking::nc);
+        storage_vector<T> packed_b(((packed_b_columns + nr - 1) / nr) * nr * blocking::kc);
+
+        for (size_t jc = 0; jc < n; jc += blocking::nc)
+        {
+            const size_t nc = std::min(blocking::nc, n - jc);
+
+            for (size_t pc = 0; pc < k; pc += blocking::kc)
+            {
+                const size_t kc = std::min(blocking::kc, k - pc);
+
+                //C is scaled by beta only once, next kc blocks accumulate into it
+                const T beta_block = pc == 0 ? beta : static_cast<T>(1);
+
+                //work is split into tasks of mc rows x gemm_task_columns columns so that there are enough
+                //tasks for many threads also when C has only few row blocks (e.g trailing updates of blocked LU)
+                const size_t row_blocks = (m + blocking::mc - 1) / blocking::mc;
+                const size_t column_groups = parallel ? (nc + gemm_task_columns - 1) / gemm_task_columns : 1;
+                const size_t group_columns = parallel ? gemm_task_columns : nc;
+                const size_t tasks = row_blocks * column_groups;
+
+                const size_t b_panels = (nc + nr - 1) / nr;
+
+                auto pack_b_panel = [&](size_t panel)
+                {
+                    const size_t jr = panel * nr;
+                    gemm_pack_b(nr, kc, std::min(nr, nc - jr), b + pc * rsb + (jc + jr) * csb, rsb, csb, packed_b.data() + jr * kc);
+                };
+
+                auto compute_task = [&](size_t task)
+                {
+                    //every task packs its own block of A (buffer outlives call, so it does not use replaceable storage resource)
+                    static thread_local storage_vector<T> packed_a{ storage_allocator<T>(aligned_storage_resource()) };
+                    packed_a.resize(blocking::mc * blocking::kc);
+
+                    const size_t ic = (task / column_groups) * blocking::mc;
+                    const size_t mc = std::min(blocking::mc, m - ic);
+                    const size_t first_column = (task % column_groups) * group_columns;
+                    const size_t last_column = std::min(nc, first_column + group_columns);
+
+                    gemm_pack_a(mr, mc, kc, a + ic * rsa + pc * csa, rsa, csa, packed_a.data());
+
+                    for (size_t jr = first_column; jr < last_column; jr += nr)
+                    {
+                        const size_t columns = std::min(nr, nc - jr);
+
+                        for (size_t ir = 0; ir < mc; ir += mr)
+                        {
+                            const size_t rows = std::min(mr, mc - ir);
+
+                            micro_kernel(
+                                kc, alpha,
+                                packed_a.data() + ir * kc,
+                                packed_b.data() + jr * kc,
+                                beta_block,
+                                c + (ic + ir) * rsc + (jc + jr) * csc, rsc, csc,
+                                rows, columns
+                            );
+                        }
+                    }
+                };
+
+                //b is packed before any task uses it (every loop returns when all its iterations have finished)
+                parallel_for(b_panels, parallel && tasks > 1, pack_b_panel);
+                parallel_for(tasks, parallel && tasks > 1, compute_task);
+            }
+        }
+    }
+
+    //packed kernel is used for built-in arithmetic types, other mathematical fields use generic loops
+    template<class T, class TO>
+    constexpr bool use_gemm_kernel_v = std::is_arithmetic_v<T> && std::is_same_v<T, TO> && std::is_same_v<inner_product_result_t<T, TO>, T>;
+
+    ///<summary>
+    /// C = alpha * A * B + beta * C for m x k matrix A, k x n matrix B and m x n matrix C of any mathematical fields
+    /// (element (i, j) of X is x[i * rsx + j * csx])
+    /// <para>if beta is 0, previous content of C is ignored, C must not overlap A or B</para>
+    /// <para>big matrices of arithmetic types are multiplied by packed kernel, other ones by generic loops
+    /// (both are parallel if product is expensive enough, see parallel_thresholds)</para>
+    ///</summary>
+    template<class T, class TO, class TR, class TS>
+    inline void multiply_add(
+        size_t m, size_t n, size_t k,
+        const TS& alpha,
+        const T* a, size_t rsa, size_t csa,
+        const TO* b, size_t rsb, size_t csb,
+        const TS& beta,
+        TR* c, size_t rsc, size_t csc,
+        bool big)
+    {
+        if constexpr (use_gemm_kernel_v<T, TO> && std::is_same_v<TR, T>)
+        {
+            if (big)
+            {
+                gemm<T>(m, n, k, static_cast<T>(alpha), a, rsa, csa, b, rsb, csb, static_cast<T>(beta), c, rsc, csc, parallel_gemm(m, n, k));
+                return;
+            }
+        }
+
+        const bool accumulate = beta != get_additive_identity<TS>();
+
+        auto multiply_row = [&](size_t row) {
+            for (size_t column = 0; column < n; column++)
+            {
+                //calculating column-row inner product
+
+                auto inner_product = get_additive_identity<inner_product_result_t<T, TO>>();
+
+                for (size_t i = 0; i < k; i++)
+                {
+                    inner_product += a[row * rsa + i * csa] * b[i * rsb + column * csb];
+                }
+
+                if (accumulate)
+                {
+                    c[row * rsc + column * csc] = static_cast<TR>(alpha * inner_product + beta * c[row * rsc + column * csc]);
+                }
+                else
+                {
+                    c[row * rsc + column * csc] = static_cast<TR>(alpha * inner_product);
+                }
+            }
+        };
+
+        parallel_for(m, parallel_gemm(m, n, k), multiply_row);
+    }
+
+    ///<summary>
+    /// C = alpha * A * B + beta * C for matrices stored in tiles of S x S elements (see tiled layout)
+    /// (A has m_tiles x k_tiles tiles, B has k_tiles x n_tiles tiles and C has m_tiles x n_tiles tiles,
+    /// tiles are stored row by row and elements of every tile are stored row by row)
+    /// <para>tiles are whole (edges are padded with 0-oes), so every tile product is a loop nest of constant size which compilers vectorize</para>
+    /// <para>if beta is 0, previous content of C is ignored, tiles of C are computed in parallel if parallel is set</para>
+    ///</summary>
+    template<size_t S, class T, class TO, class TR, class TS>
+    inline void multiply_add_tiled(size_t m_tiles, size_t n_tiles, size_t k_tiles, const TS& alpha, const T* a, const TO* b, const TS& beta, TR* c, bool parallel)
+    {
+        using product_type = inner_product_result_t<T, TO>;
+
+        constexpr size_t tile_elements = S * S;
+        const bool accumulate = beta != get_additive_identity<TS>();
+
+        auto multiply_tile = [&](size_t tile)
+        {
+            const size_t i = tile / n_tiles;
+            const size_t j = tile % n_tiles;
+
+            //tile of product stays in l1 cache while tiles of A and B are multiplied into it
+            product_type product[tile_elements];
+            std::fill(product, product + tile_elements, get_additive_identity<product_type>());
+
+            for (size_t p = 0; p < k_tiles; p++)
+            {
+                const T* a_tile = a + (i * k_tiles + p) * tile_elements;
+                const TO* b_tile = b + (p * n_tiles + j) * tile_elements;
+
+                for (size_t row = 0; row < S; row++)
+                {
+                    for (size_t q = 0; q < S; q++)
+                    {
+                        const T a_element = a_tile[row * S + q];
+                        for (size_t column = 0; column < S; column++)
+                        {
+                            product[row * S + column] += a_element * b_tile[q * S + column];
+                        }
+                    }
+                }
+            }
+
+            TR* c_tile = c + tile * tile_elements;
+            for (size_t index = 0; index < tile_elements; index++)
+            {
+                c_tile[index] = accumulate ?
+                    static_cast<TR>(alpha * product[index] + beta * c_tile[index]) :
+                    static_cast<TR>(alpha * product[index]);
+            }
+        };
+
+        const size_t tiles = m_tiles * n_tiles;
+
+        parallel_for(tiles, parallel, multiply_tile);
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "elementwise.hpp"
+#include "../memory/storage_allocator.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //vector operations of iterative solvers on contiguous arrays of n elements
+    //every iteration of solver is few of these passes and one product with operator, so they are parallel for big systems
+
+    //returns x * y, big arrays are split into chunks of simd_kernels_chunk_size elements summed in order (result does not depend on number of threads)
+    template<class T>
+    inline T krylov_dot(size_t n, const T* x, const T* y, bool parallel)
+    {
+        if (!parallel || n <= simd_kernels_chunk_size)
+        {
+            return elementwise_dot(n, x, y);
+        }
+
+        const size_t chunks = (n + simd_kernels_chunk_size - 1) / simd_kernels_chunk_size;
+        storage_vector<T> partial(chunks);
+
+        parallel_for(chunks, true, [&](size_t chunk) {
+            const size_t offset = chunk * simd_kernels_chunk_size;
+            partial[chunk] = elementwise_dot(std::min(simd_kernels_chunk_size, n - offset), x + offset, y + offset);
+        });
+
+        T result = get_additive_identity<T>();
+        for (const T& value : partial)
+        {
+            result += value;
+        }
+
+        return result;
+    }
+
+    //y = y + alpha * x
+    template<class T>
+    inline void krylov_axpy(size_t n, const T& alpha, const T* x, T* y, bool parallel)
+    {
+        elementwise_for_each(n, parallel, [&](size_t index) { y[index] += alpha * x[index]; });
+    }
+
+    //y = x + beta * y
+    template<class T>
+    inline void krylov_xpby(size_t n, const T* x, const T& beta, T* y, bool parallel)
+    {
+        elementwise_for_each(n, parallel, [&](size_t index) { y[index] = x[index] + beta * y[index]; });
+    }
+
+    //z = x - y
+    template<class T>
+    inline void krylov_subtract(size_t n, const T* x, const T* y, T* z, bool parallel)
+    {
+        elementwise_for_each(n, parallel, [&](size_t index) { z[index] = x[index] - y[index]; });
+    }
+
+    //givens rotation (c, s) zeroing b of (a, b): [c s; -s c] * (a, b) = (r, 0)
+    template<class T>
+    inline void krylov_givens(const T& a, const T& b, T& c, T& s)
+    {
+        if (equal(b, get_additive_identity<T>()))
+        {
+            c = get_multiplicative_identity<T>();
+            s = get_additive_identity<T>();
+            return;
+        }
+
+        const T r = functions_implementation<T>::sqrt(a * a + b * b);
+        c = a / r;
+        s = b / r;
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,374 @@
+#pragma once
+
+#include "gemm.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //returns row (in range [column, n)) containing pivot for given column
+    //types with abs implementation use the largest element (partial pivoting), other types use the first non-zero one
+    template<class T>
+    inline size_t lu_find_pivot(size_t n, const T* a, size_t lda, size_t column)
+    {
+        size_t pivot_row = column;
+
+        if constexpr (has_abs_implementation_v<T>)
+        {
+            T largest = functions_implementation<T>::abs(a[column * lda + column]);
+            for (size_t row = column + 1; row < n; row++)
+            {
+                const T value = functions_implementation<T>::abs(a[row * lda + column]);
+                if (value > largest)
+                {
+                    largest = value;
+                    pivot_row = row;
+                }
+            }
+        }
+        else
+        {
+            for (size_t row = column; row < n; row++)
+            {
+                if (!equal(a[row * lda + column], get_additive_identity<T>()))
+                {
+                    pivot_row = row;
+                    break;
+                }
+            }
+        }
+
+        return pivot_row;
+    }
+
+    template<class T>
+    inline void lu_swap_rows(T* a, size_t lda, size_t r1, size_t r2, size_t columns)
+    {
+        if (r1 != r2)
+        {
+            std::swap_ranges(a + r1 * lda, a + r1 * lda + columns, a + r2 * lda);
+        }
+    }
+
+    //subtracts row of factors multiplied by pivot row from single row of trailing matrix
+    template<class T>
+    inline void lu_update_row(size_t k, size_t n, T* a, size_t lda, size_t row)
+    {
+        const T factor = a[row * lda + k];
+        const T* pivot_row = a + k * lda;
+        T* updated_row = a + row * lda;
+
+        for (size_t column = k + 1; column < n; column++)
+        {
+            updated_row[column] -= factor * pivot_row[column];
+        }
+    }
+
+    ///<summary>
+    /// unblocked LU factorization with partial pivoting of m x n row-major panel (m >= n)
+    /// <para>rows are swapped only inside of panel, pivots are relative to first row of panel</para>
+    ///</summary>
+    /// <returns> false if zero pivot was found (column with zero pivot is left unreduced) </returns>
+    template<class T>
+    bool lu_factorize_unblocked(size_t m, size_t n, T* a, size_t lda, size_t* pivots, bool parallel = false)
+    {
+        bool non_singular = true;
+
+        for (size_t k = 0; k < n; k++)
+        {
+            const size_t pivot_row = lu_find_pivot(m, a, lda, k);
+            pivots[k] = pivot_row;
+
+            if (equal(a[pivot_row * lda + k], get_additive_identity<T>()))
+            {
+                //whole column below diagonal is already 0, there is nothing to eliminate
+                non_singular = false;
+                continue;
+            }
+
+            lu_swap_rows(a, lda, k, pivot_row, n);
+
+            const T pivot = a[k * lda + k];
+            for (size_t row = k + 1; row < m; row++)
+            {
+                a[row * lda + k] /= pivot;
+            }
+
+            //rank 1 update of trailing (m - k - 1) x (n - k - 1) matrix
+            parallel_for(k + 1, m, parallel && parallel_elimination(m - k - 1, n - k - 1), [&](size_t row) {
+                lu_update_row(k, n, a, lda, row);
+            });
+        }
+
+        return non_singular;
+    }
+
+    //solves L * X = B in place, L is n x n unit lower triangular part of l, B is n x columns
+    template<class T>
+    void lu_forward_substitution(size_t n, const T* l, size_t lda, T* b, size_t ldb, size_t columns)
+    {
+        for (size_t row = 1; row < n; row++)
+        {
+            T* b_row = b + row * ldb;
+            for (size_t k = 0; k < row; k++)
+            {
+                const T factor = l[row * lda + k];
+                const T* b_k = b + k * ldb;
+                for (size_t column = 0; column < columns; column++)
+                {
+                    b_row[column] -= factor * b_k[column];
+                }
+            }
+        }
+    }
+
+    //solves U * X = B in place, U is n x n upper triangular part of u, B is n x columns
+    template<class T>
+    void lu_back_substitution(size_t n, const T* u, size_t lda, T* b, size_t ldb, size_t columns)
+    {
+        for (size_t row = n; row-- > 0;)
+        {
+            T* b_row = b + row * ldb;
+            for (size_t k = row + 1; k < n; k++)
+            {
+                const T factor = u[row * lda + k];
+                const T* b_k = b + k * ldb;
+                for (size_t column = 0; column < columns; column++)
+                {
+                    b_row[column] -= factor * b_k[column];
+                }
+            }
+
+            const T diagonal = u[row * lda + row];
+            for (size_t column = 0; column < columns; column++)
+            {
+                b_row[column] /= diagonal;
+            }
+        }
+    }
+
+    //columns of right hand side matrix processed by single task
+    constexpr size_t lu_chunk_columns = 256;
+
+    //calls kernel(first_column, count) for groups of columns (in parallel if requested)
+    template<class F>
+    inline void lu_for_each_column_chunk(size_t columns, bool parallel, F&& kernel)
+    {
+        if (parallel && columns > lu_chunk_columns)
+        {
+            const size_t chunks = (columns + lu_chunk_columns - 1) / lu_chunk_columns;
+
+            parallel_for(chunks, true, [&](size_t chunk) {
+                const size_t first_column = chunk * lu_chunk_columns;
+                kernel(first_column, std::min(lu_chunk_columns, columns - first_column));
+            });
+            return;
+        }
+
+        kernel(static_cast<size_t>(0), columns);
+    }
+
+    //panels narrower than this are factored by unblocked algorithm
+    constexpr size_t lu_recursion_min_columns = 16;
+
+    ///<summary>
+    /// recursive LU factorization of m x n panel (m >= n)
+    /// <para>left half of panel is factored first, then right half is updated (TRSM + GEMM) and factored</para>
+    /// <para>(almost all operations of tall panel go through matrix multiplication kernel)</para>
+    ///</summary>
+    template<class T>
+    bool lu_factorize_recursive(size_t m, size_t n, T* a, size_t lda, size_t* pivots, bool parallel)
+    {
+        if (n <= lu_recursion_min_columns)
+        {
+            return lu_factorize_unblocked(m, n, a, lda, pivots);
+        }
+
+        const size_t n1 = n / 2;
+        const size_t n2 = n - n1;
+
+        bool non_singular = lu_factorize_recursive(m, n1, a, lda, pivots, parallel);
+
+        for (size_t k = 0; k < n1; k++)
+        {
+            lu_swap_rows(a + n1, lda, k, pivots[k], n2);
+        }
+
+        //A12 = L11^-1 * A12
+        lu_forward_substitution(n1, a, lda, a + n1, lda, n2);
+
+        //A22 = A22 - A21 * A12
+        gemm<T>(
+            m - n1, n2, n1,
+            static_cast<T>(-1),
+            a + n1 * lda, lda, 1,
+            a + n1, lda, 1,
+            static_cast<T>(1),
+            a + n1 * lda + n1, lda, 1,
+            parallel && parallel_gemm(m - n1, n2, n1)
+        );
+
+        non_singular = lu_factorize_recursive(m - n1, n2, a + n1 * lda + n1, lda, pivots + n1, parallel) && non_singular;
+
+        //pivots of right half are relative to its first row, swaps have to be applied to left half too
+        for (size_t k = n1; k < n; k++)
+        {
+            pivots[k] += n1;
+            lu_swap_rows(a, lda, k, pivots[k], n1);
+        }
+
+        return non_singular;
+    }
+
+    //columns of single panel of blocked factorization (inner dimension of trailing update)
+    constexpr size_t lu_block_size = 128;
+
+    ///<summary>
+    /// blocked right-looking LU factorization with partial pivoting of n x n row-major matrix
+    /// <para>for every block of columns: panel is factored, row swaps are applied to the rest of the matrix,
+    /// block row of U is computed by triangular solve and trailing matrix is updated by matrix multiplication</para>
+    ///</summary>
+    template<class T>
+    bool lu_factorize_blocked(size_t n, T* a, size_t lda, size_t* pivots, bool parallel)
+    {
+        bool non_singular = true;
+
+        for (size_t k = 0; k < n; k += lu_block_size)
+        {
+            const size_t kb = std::min(lu_block_size, n - k);
+            const size_t rest = n - k - kb;
+
+            T* a11 = a + k * lda + k;
+            T* a12 = a11 + kb;
+            T* a21 = a11 + kb * lda;
+            T* a22 = a21 + kb;
+
+            non_singular = lu_factorize_recursive(n - k, kb, a11, lda, pivots + k, parallel) && non_singular;
+
+            //panel swapped only its own columns, swaps are applied to columns on the left and on the right of it
+            for (size_t i = k; i < k + kb; i++)
+            {
+                pivots[i] += k;
+                lu_swap_rows(a, lda, i, pivots[i], k);
+                lu_swap_rows(a + k + kb, lda, i, pivots[i], rest);
+            }
+
+            if (rest == 0)
+            {
+                break;
+            }
+
+            //U12 = L11^-1 * A12
+            lu_for_each_column_chunk(rest, parallel && parallel_elimination(kb * kb / 2, rest), [&](size_t first_column, size_t columns) {
+                lu_forward_substitution(kb, a11, lda, a12 + first_column, lda, columns);
+            });
+
+            //A22 = A22 - L21 * U12
+            gemm<T>(
+                rest, rest, kb,
+                static_cast<T>(-1),
+                a21, lda, 1,
+                a12, lda, 1,
+                static_cast<T>(1),
+                a22, lda, 1,
+                parallel && parallel_gemm(rest, rest, kb)
+            );
+        }
+
+        return non_singular;
+    }
+
+    //matrices smaller than this are factored by unblocked algorithm
+    constexpr size_t lu_blocked_min_size = 2 * lu_block_size;
+
+    ///<summary>
+    /// in place LU factorization with partial pivoting of n x n row-major matrix (P * A = L * U)
+    /// <para>after factorization strictly lower part of a contains L (without its unit diagonal) and upper part contains U</para>
+    /// <para>pivots[k] is row which was swapped with row k in k-th step (rows have to be swapped in increasing order of k)</para>
+    /// <para>big matrices of types supported by packed matrix multiplication are factored by blocked algorithm</para>
+    ///</summary>
+    /// <param name="parallel"> whether steps expensive enough to go parallel (see parallel_thresholds) may be split over threads </param>
+    /// <returns> false if matrix is singular (zero pivot was found, columns with zero pivot are left unreduced) </returns>
+    template<class T>
+    bool lu_factorize(size_t n, T* a, size_t lda, size_t* pivots, bool parallel = false)
+    {
+        if constexpr (use_gemm_kernel_v<T, T>)
+        {
+            if (n >= lu_blocked_min_size)
+            {
+                return lu_factorize_blocked(n, a, lda, pivots, parallel);
+            }
+        }
+
+        return lu_factorize_unblocked(n, n, a, lda, pivots, parallel);
+    }
+
+    //solves L * U * X = P * B for columns [first_column, first_column + columns) of B
+    template<class T>
+    void lu_solve_columns(size_t n, const T* lu, size_t lda, const size_t* pivots, T* b, size_t ldb, size_t first_column, size_t columns)
+    {
+        b += first_column;
+
+        for (size_t k = 0; k < n; k++)
+        {
+            lu_swap_rows(b, ldb, k, pivots[k], columns);
+        }
+
+        lu_forward_substitution(n, lu, lda, b, ldb, columns);
+        lu_back_substitution(n, lu, lda, b, ldb, columns);
+    }
+
+    //solves L * y = P * b and U * x = y for single right hand side stored contiguously
+    template<class T>
+    void lu_solve_vector(size_t n, const T* lu, size_t lda, const size_t* pivots, T* b)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            std::swap(b[k], b[pivots[k]]);
+        }
+
+        //rows of factors are contiguous so every element of solution is inner product of row and already computed part
+        for (size_t row = 1; row < n; row++)
+        {
+            const T* lu_row = lu + row * lda;
+            T sum = get_additive_identity<T>();
+            for (size_t k = 0; k < row; k++)
+            {
+                sum += lu_row[k] * b[k];
+            }
+            b[row] -= sum;
+        }
+
+        for (size_t row = n; row-- > 0;)
+        {
+            const T* lu_row = lu + row * lda;
+            T sum = get_additive_identity<T>();
+            for (size_t k = row + 1; k < n; k++)
+            {
+                sum += lu_row[k] * b[k];
+            }
+            b[row] = (b[row] - sum) / lu_row[row];
+        }
+    }
+
+    ///<summary>
+    /// solves A * X = B using factors computed by lu_factorize (B is overwritten by X)
+    /// <para>B is n x columns row-major matrix with row stride ldb</para>
+    ///</summary>
+    /// <param name="parallel"> whether independent groups of columns should be solved in parallel </param>
+    template<class T>
+    void lu_solve(size_t n, const T* lu, size_t lda, const size_t* pivots, T* b, size_t ldb, size_t columns, bool parallel = false)
+    {
+        if (columns == 1 && ldb == 1)
+        {
+            lu_solve_vector(n, lu, lda, pivots, b);
+            return;
+        }
+
+        lu_for_each_column_chunk(columns, parallel, [&](size_t first_column, size_t count) {
+            lu_solve_columns(n, lu, lda, pivots, b, ldb, first_column, count);
+        });
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
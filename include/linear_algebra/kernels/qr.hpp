@@ -0,0 +1,452 @@
+#pragma once
+
+#include "lu.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    /*
+        householder QR factorization (A = Q * R) of m x n row-major matrix (m >= n)
+        R is written to upper triangle of A, householder vectors v_k (without their unit first element) below diagonal
+        and scalars tau_k to separate array, so Q = H_0 * H_1 * ... * H_(n-1) where H_k = I - tau_k * v_k * v_k^T
+    */
+
+    ///<summary>
+    /// generates reflector H = I - tau * v * v^T (v[0] = 1) such that H * (alpha, x) = (beta, 0)
+    /// <para>alpha is replaced by beta and n elements of x (with stride incx) by v[1:]</para>
+    ///</summary>
+    /// <returns> tau (0 if x is already zero and H = I) </returns>
+    template<class T>
+    inline T qr_householder(T& alpha, size_t n, T* x, size_t incx)
+    {
+        T norm_squared = get_additive_identity<T>();
+        for (size_t i = 0; i < n; i++)
+        {
+            norm_squared += x[i * incx] * x[i * incx];
+        }
+
+        if (equal(norm_squared, get_additive_identity<T>()))
+        {
+            return get_additive_identity<T>();
+        }
+
+        //sign of beta is opposite to sign of alpha, so alpha - beta does not cancel
+        const T norm = functions_implementation<T>::sqrt(alpha * alpha + norm_squared);
+        const T beta = alpha < get_additive_identity<T>() ? norm : -norm;
+        const T scale = get_multiplicative_identity<T>() / (alpha - beta);
+
+        for (size_t i = 0; i < n; i++)
+        {
+            x[i * incx] *= scale;
+        }
+
+        const T tau = (beta - alpha) / beta;
+        alpha = beta;
+        return tau;
+    }
+
+    //rows of single part of reduction computed by one task of parallel reflector application
+    constexpr size_t qr_reduction_rows = 1024;
+
+    ///<summary>
+    /// C = H * C for m x n row-major matrix C and reflector H = I - tau * v * v^T (v[0] = 1 is not read, v has stride incv)
+    /// <para>if parallel is set parts of v^T * C are computed in parallel by groups of rows and then summed</para>
+    ///</summary>
+    template<class T>
+    void qr_apply_reflector(size_t m, size_t n, const T* v, size_t incv, T tau, T* c, size_t ldc, bool parallel)
+    {
+        if (n == 0 || equal(tau, get_additive_identity<T>()))
+        {
+            return;
+        }
+
+        const size_t parts = parallel ? (m + qr_reduction_rows - 1) / qr_reduction_rows : 1;
+        const size_t part_rows = (m + parts - 1) / parts;
+
+        //w = v^T * C (row of partial sums for every part)
+        storage_vector<T> w(parts * n);
+
+        parallel_for(parts, parallel, [&](size_t part) {
+            T* w_part = w.data() + part * n;
+
+            for (size_t row = part * part_rows; row < std::min(m, (part + 1) * part_rows); row++)
+            {
+                const T factor = row == 0 ? get_multiplicative_identity<T>() : v[row * incv];
+                const T* c_row = c + row * ldc;
+
+                for (size_t column = 0; column < n; column++)
+                {
+                    w_part[column] += factor * c_row[column];
+                }
+            }
+        });
+
+        for (size_t part = 1; part < parts; part++)
+        {
+            for (size_t column = 0; column < n; column++)
+            {
+                w[column] += w[part * n + column];
+            }
+        }
+
+        for (size_t column = 0; column < n; column++)
+        {
+            w[column] *= tau;
+        }
+
+        //C = C - v * (tau * w)
+        parallel_for(m, parallel, [&](size_t row) {
+            const T factor = row == 0 ? get_multiplicative_identity<T>() : v[row * incv];
+            T* c_row = c + row * ldc;
+
+            for (size_t column = 0; column < n; column++)
+            {
+                c_row[column] -= factor * w[column];
+            }
+        });
+    }
+
+    ///<summary>
+    /// unblocked householder factorization of m x n row-major matrix (m >= n), tau must have n elements
+    /// <para>every reflector is applied to trailing columns as soon as it is generated (applications are parallel if parallel is set)</para>
+    ///</summary>
+    template<class T>
+    void qr_factorize_unblocked(size_t m, size_t n, T* a, size_t lda, T* tau, bool parallel = false)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            T* a_k = a + k * lda + k;
+
+            tau[k] = qr_householder(a_k[0], m - k - 1, a_k + lda, lda);
+            qr_apply_reflector(m - k, n - k - 1, a_k, lda, tau[k], a_k + 1, lda, parallel && parallel_elimination(m - k, n - k - 1));
+        }
+    }
+
+    ///<summary>
+    /// upper triangular kb x kb factor T of compact WY representation H_0 * ... * H_(kb-1) = I - V * T * V^T (whole T is written)
+    /// <para>V is explicit rows x kb row-major matrix of householder vectors (with unit diagonal and zeros above it)</para>
+    ///</summary>
+    template<class T>
+    void qr_triangular_factor(size_t rows, size_t kb, const T* v, const T* tau, T* t, bool parallel)
+    {
+        //gram matrix of householder vectors gives all products v_j^T * v_i at once
+        storage_vector<T> gram(kb * kb);
+        gemm<T>(kb, kb, rows, static_cast<T>(1), v, 1, kb, v, kb, 1, static_cast<T>(0), gram.data(), kb, 1, parallel);
+
+        //T[0:i, i] = -tau_i * T[0:i, 0:i] * V[:, 0:i]^T * v_i
+        for (size_t i = 0; i < kb; i++)
+        {
+            std::fill(t + i * kb, t + i * kb + i, get_additive_identity<T>());
+            t[i * kb + i] = tau[i];
+
+            for (size_t j = 0; j < i; j++)
+            {
+                T sum = get_additive_identity<T>();
+                for (size_t l = j; l < i; l++)
+                {
+                    sum += t[j * kb + l] * gram[l * kb + i];
+                }
+
+                t[j * kb + i] = -tau[i] * sum;
+            }
+        }
+    }
+
+    //columns of single panel of blocked factorization
+    constexpr size_t qr_block_size = 32;
+
+    //matrices with less columns than this are factored by unblocked algorithm
+    constexpr size_t qr_blocked_min_size = 2 * qr_block_size;
+
+    ///<summary>
+    /// blocked householder factorization of m x n row-major matrix (see qr_factorize_unblocked)
+    /// <para>for every block of columns: panel is factored by unblocked algorithm, its reflectors are gathered
+    /// to compact WY representation Q_k = I - V * T * V^T and trailing columns are updated by C = C - V * T^T * (V^T * C),
+    /// so most of work is done by three matrix products</para>
+    ///</summary>
+    template<class T>
+    void qr_factorize_blocked(size_t m, size_t n, T* a, size_t lda, T* tau, bool parallel)
+    {
+        storage_vector<T> v(m * qr_block_size);
+        storage_vector<T> t(qr_block_size * qr_block_size);
+        storage_vector<T> w((n - std::min(n, qr_block_size)) * qr_block_size);
+        storage_vector<T> tw(w.size());
+
+        for (size_t k = 0; k < n; k += qr_block_size)
+        {
+            const size_t kb = std::min(qr_block_size, n - k);
+            const size_t rows = m - k;
+            const size_t rest = n - k - kb;
+
+            T* panel = a + k * lda + k;
+            T* c = panel + kb;
+
+            qr_factorize_unblocked(rows, kb, panel, lda, tau + k, parallel);
+
+            if (rest == 0)
+            {
+                break;
+            }
+
+            //explicit V (unit diagonal and zeros above it are not stored in A)
+            parallel_for(rows, parallel && parallel_copy(rows * kb * sizeof(T)), [&](size_t row) {
+                const T* panel_row = panel + row * lda;
+                T* v_row = v.data() + row * kb;
+
+                for (size_t column = 0; column < kb; column++)
+                {
+                    v_row[column] = column < row ? panel_row[column] : (column == row ? get_multiplicative_identity<T>() : get_additive_identity<T>());
+                }
+            });
+
+            qr_triangular_factor(rows, kb, v.data(), tau + k, t.data(), parallel && parallel_gemm(kb, kb, rows));
+
+            //W = V^T * C
+            gemm<T>(kb, rest, rows, static_cast<T>(1), v.data(), 1, kb, c, lda, 1, static_cast<T>(0), w.data(), rest, 1, parallel && parallel_gemm(kb, rest, rows));
+            //W = T^T * W
+            gemm<T>(kb, rest, kb, static_cast<T>(1), t.data(), 1, kb, w.data(), rest, 1, static_cast<T>(0), tw.data(), rest, 1, parallel && parallel_gemm(kb, rest, kb));
+            //C = C - V * W
+            gemm<T>(rows, rest, kb, static_cast<T>(-1), v.data(), kb, 1, tw.data(), rest, 1, static_cast<T>(1), c, lda, 1, parallel && parallel_gemm(rows, rest, kb));
+        }
+    }
+
+    ///<summary>
+    /// in place householder factorization of m x n row-major matrix (m >= n), tau must have n elements
+    /// <para>matrices with many columns of types supported by packed matrix multiplication are factored by blocked algorithm</para>
+    ///</summary>
+    /// <param name="parallel"> whether steps expensive enough to go parallel (see parallel_thresholds) may be split over threads </param>
+    template<class T>
+    void qr_factorize(size_t m, size_t n, T* a, size_t lda, T* tau, bool parallel = false)
+    {
+        assert(m >= n);
+
+        if constexpr (use_gemm_kernel_v<T, T>)
+        {
+            if (n >= qr_blocked_min_size)
+            {
+                qr_factorize_blocked(m, n, a, lda, tau, parallel);
+                return;
+            }
+        }
+
+        qr_factorize_unblocked(m, n, a, lda, tau, parallel);
+    }
+
+    //B = Q^T * B for m x columns row-major matrix B (Q is given by factors computed by qr_factorize)
+    template<class T>
+    void qr_apply_qt(size_t m, size_t n, const T* a, size_t lda, const T* tau, T* b, size_t ldb, size_t columns, bool parallel = false)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            qr_apply_reflector(m - k, columns, a + k * lda + k, lda, tau[k], b + k * ldb, ldb, parallel && parallel_elimination(m - k, columns));
+        }
+    }
+
+    //B = Q * B for m x columns row-major matrix B (reflectors are applied in reverse order)
+    template<class T>
+    void qr_apply_q(size_t m, size_t n, const T* a, size_t lda, const T* tau, T* b, size_t ldb, size_t columns, bool parallel = false)
+    {
+        for (size_t k = n; k-- > 0;)
+        {
+            qr_apply_reflector(m - k, columns, a + k * lda + k, lda, tau[k], b + k * ldb, ldb, parallel && parallel_elimination(m - k, columns));
+        }
+    }
+
+    //solves R * X = B for first n rows of row-major B (R is upper triangle of r), B is overwritten by X
+    template<class T>
+    void qr_back_substitution(size_t n, const T* r, size_t ldr, T* b, size_t ldb, size_t columns)
+    {
+        for (size_t row = n; row-- > 0;)
+        {
+            const T* r_row = r + row * ldr;
+            T* b_row = b + row * ldb;
+
+            for (size_t k = row + 1; k < n; k++)
+            {
+                const T factor = r_row[k];
+                const T* b_k = b + k * ldb;
+                for (size_t column = 0; column < columns; column++)
+                {
+                    b_row[column] -= factor * b_k[column];
+                }
+            }
+
+            for (size_t column = 0; column < columns; column++)
+            {
+                b_row[column] /= r_row[row];
+            }
+        }
+    }
+
+    ///<summary>
+    /// whether upper triangular n x n factor R of m x n matrix has zero on diagonal
+    /// <para>if absolute value and epsilon are available, diagonal elements not larger than
+    /// max(m, n) * epsilon * largest diagonal element are rounding errors of zeros</para>
+    ///</summary>
+    template<class T>
+    bool qr_is_rank_deficient(size_t m, size_t n, const T* r, size_t ldr)
+    {
+        if constexpr (has_abs_implementation_v<T> && has_epsilon_implementation_v<T>)
+        {
+            T tolerance = get_additive_identity<T>();
+            for (size_t diagonal = 0; diagonal < n; diagonal++)
+            {
+                tolerance = std::max(tolerance, functions_implementation<T>::abs(r[diagonal * ldr + diagonal]));
+            }
+            tolerance *= functions_implementation<T>::epsilon() * static_cast<T>(std::max(m, n));
+
+            for (size_t diagonal = 0; diagonal < n; diagonal++)
+            {
+                if (functions_implementation<T>::abs(r[diagonal * ldr + diagonal]) <= tolerance)
+                {
+                    return true;
+                }
+            }
+        }
+        else
+        {
+            for (size_t diagonal = 0; diagonal < n; diagonal++)
+            {
+                if (equal(r[diagonal * ldr + diagonal], get_additive_identity<T>()))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    ///<summary>
+    /// updates triangular factor by count new rows: [R; rows] = Q * [R'; 0] (Q is not stored)
+    /// <para>r is n x columns row-major matrix with upper triangular first n columns, next columns (right-hand sides)
+    /// are transformed by the same reflectors, rows is count x columns row-major matrix used as workspace</para>
+    /// <para>every reflector mixes single row of R with new rows only, so update costs O(count * n * columns)</para>
+    ///</summary>
+    template<class T>
+    void qr_accumulate_rows(size_t n, size_t columns, T* r, size_t ldr, T* rows, size_t ldrows, size_t count)
+    {
+        storage_vector<T> w(columns);
+
+        for (size_t k = 0; k < n; k++)
+        {
+            T* r_k = r + k * ldr;
+
+            const T tau = qr_householder(r_k[k], count, rows + k, ldrows);
+            if (equal(tau, get_additive_identity<T>()))
+            {
+                continue;
+            }
+
+            //w = v^T * [R_k; rows] (v is 1 for row k of R and column k of rows for new rows)
+            for (size_t column = k + 1; column < columns; column++)
+            {
+                w[column] = r_k[column];
+            }
+
+            for (size_t row = 0; row < count; row++)
+            {
+                const T* rows_row = rows + row * ldrows;
+                const T factor = rows_row[k];
+
+                for (size_t column = k + 1; column < columns; column++)
+                {
+                    w[column] += factor * rows_row[column];
+                }
+            }
+
+            for (size_t column = k + 1; column < columns; column++)
+            {
+                w[column] *= tau;
+                r_k[column] -= w[column];
+            }
+
+            for (size_t row = 0; row < count; row++)
+            {
+                T* rows_row = rows + row * ldrows;
+                const T factor = rows_row[k];
+
+                for (size_t column = k + 1; column < columns; column++)
+                {
+                    rows_row[column] -= factor * w[column];
+                }
+            }
+        }
+    }
+
+    //rows copied at once from input of streamed least squares solver (new rows of qr_accumulate_rows)
+    constexpr size_t qr_stream_rows = 256;
+
+    //minimal number of rows reduced to single triangular factor by one task of streamed least squares solver
+    constexpr size_t qr_group_rows = 4096;
+
+    ///<summary>
+    /// minimizes ||A * x - b|| for m x n row-major matrix A (m >= n, b has stride incb), solution is written to x
+    /// <para>rows of [A b] are streamed by small blocks into triangular factor [R Q^T*b] (see qr_accumulate_rows),
+    /// so neither A^T * A nor Q is formed and workspace does not depend on m</para>
+    /// <para>groups of rows are reduced to separate triangular factors (in parallel if parallel is set), which are then merged
+    /// (tall skinny QR), grouping does not depend on parallel, so results are reproducible</para>
+    ///</summary>
+    /// <returns> false if A is rank deficient (x is not written) </returns>
+    template<class T>
+    bool qr_least_squares(size_t m, size_t n, const T* a, size_t lda, const T* b, size_t incb, T* x, bool parallel = false)
+    {
+        assert(m >= n);
+
+        const size_t columns = n + 1;
+        const size_t triangle_size = n * columns;
+
+        //groups are long enough for merging of their factors (n^3 per group) to be negligible
+        const size_t group_rows = std::max(qr_group_rows, 8 * n);
+        const size_t groups = std::max(size_t(1), (m + group_rows - 1) / group_rows);
+
+        storage_vector<T> triangles(groups * triangle_size);
+
+        parallel_for(groups, parallel, [&](size_t group) {
+            T* triangle = triangles.data() + group * triangle_size;
+            storage_vector<T> block(qr_stream_rows * columns);
+
+            const size_t group_end = std::min(m, (group + 1) * group_rows);
+
+            for (size_t first_row = group * group_rows; first_row < group_end; first_row += qr_stream_rows)
+            {
+                const size_t count = std::min(qr_stream_rows, group_end - first_row);
+
+                for (size_t row = 0; row < count; row++)
+                {
+                    const T* a_row = a + (first_row + row) * lda;
+                    T* block_row = block.data() + row * columns;
+
+                    std::copy(a_row, a_row + n, block_row);
+                    block_row[n] = b[(first_row + row) * incb];
+                }
+
+                qr_accumulate_rows(n, columns, triangle, columns, block.data(), columns, count);
+            }
+        });
+
+        T* result = triangles.data();
+
+        for (size_t group = 1; group < groups; group++)
+        {
+            qr_accumulate_rows(n, columns, result, columns, triangles.data() + group * triangle_size, columns, n);
+        }
+
+        if (qr_is_rank_deficient(m, n, result, columns))
+        {
+            return false;
+        }
+
+        qr_back_substitution(n, result, columns, result + n, columns, 1);
+
+        for (size_t row = 0; row < n; row++)
+        {
+            x[row] = result[row * columns + n];
+        }
+
+        return true;
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "../simd/simd.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //kernels on n vectors of dimension D stored as structure of arrays (x[d] points to d-th coordinates of all vectors)
+    //vectors are processed in blocks by loops over contiguous coordinates, which compilers vectorize with full simd width
+    //(every simd lane holds coordinate of different vector), blocks of big collections are processed in parallel
+
+    //temporaries of single block fit in l1 cache
+    constexpr size_t soa_block_bytes = 16384;
+
+    template<class T, size_t D>
+    constexpr size_t soa_block_size_v = std::max<size_t>(16, soa_block_bytes / (D * sizeof(T)) / 16 * 16);
+
+    template<class T, size_t D, class F>
+    inline void soa_for_each_block(size_t n, bool parallel, F&& kernel)
+    {
+        simd_for_each_chunk(n, parallel, [&](size_t offset, size_t count) {
+            for (size_t block = offset; block < offset + count; block += soa_block_size_v<T, D>)
+            {
+                kernel(block, std::min(soa_block_size_v<T, D>, offset + count - block));
+            }
+        });
+    }
+
+    //out = m * x for every vector (m is row-major D x D, out may be the same as x)
+    template<class T, size_t D>
+    inline void soa_transform(size_t n, const T* m, const T* const* x, T* const* out, bool parallel)
+    {
+        soa_for_each_block<T, D>(n, parallel, [&](size_t offset, size_t count) {
+            T result[D][soa_block_size_v<T, D>];
+
+            for (size_t r = 0; r < D; r++)
+            {
+                const T* x0 = x[0] + offset;
+                for (size_t i = 0; i < count; i++)
+                {
+                    result[r][i] = m[r * D] * x0[i];
+                }
+
+                for (size_t c = 1; c < D; c++)
+                {
+                    const T v = m[r * D + c];
+                    const T* xc = x[c] + offset;
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        result[r][i] += v * xc[i];
+                    }
+                }
+            }
+
+            for (size_t r = 0; r < D; r++)
+            {
+                std::copy(result[r], result[r] + count, out[r] + offset);
+            }
+        });
+    }
+
+    //out[i] = x[i] + v for every vector
+    template<class T, size_t D>
+    inline void soa_translate(size_t n, const T* v, const T* const* x, T* const* out, bool parallel)
+    {
+        soa_for_each_block<T, D>(n, parallel, [&](size_t offset, size_t count) {
+            for (size_t d = 0; d < D; d++)
+            {
+                const T vd = v[d];
+                const T* xd = x[d] + offset;
+                T* outd = out[d] + offset;
+                for (size_t i = 0; i < count; i++)
+                {
+                    outd[i] = xd[i] + vd;
+                }
+            }
+        });
+    }
+
+    //out[i] = inner product of x[i] and y[i]
+    template<class T, size_t D>
+    inline void soa_dot(size_t n, const T* const* x, const T* const* y, T* out, bool parallel)
+    {
+        soa_for_each_block<T, D>(n, parallel, [&](size_t offset, size_t count) {
+            T result[soa_block_size_v<T, D>];
+
+            for (size_t i = 0; i < count; i++)
+            {
+                result[i] = x[0][offset + i] * y[0][offset + i];
+            }
+
+            for (size_t d = 1; d < D; d++)
+            {
+                const T* xd = x[d] + offset;
+                const T* yd = y[d] + offset;
+                for (size_t i = 0; i < count; i++)
+                {
+                    result[i] += xd[i] * yd[i];
+                }
+            }
+
+            std::copy(result, result + count, out + offset);
+        });
+    }
+
+    //out[i] = inner product of x[i] and v
+    template<class T, size_t D>
+    inline void soa_dot(size_t n, const T* const* x, const T* v, T* out, bool parallel)
+    {
+        soa_for_each_block<T, D>(n, parallel, [&](size_t offset, size_t count) {
+            T result[soa_block_size_v<T, D>];
+
+            for (size_t i = 0; i < count; i++)
+            {
+                result[i] = x[0][offset + i] * v[0];
+            }
+
+            for (size_t d = 1; d < D; d++)
+            {
+                const T vd = v[d];
+                const T* xd = x[d] + offset;
+                for (size_t i = 0; i < count; i++)
+                {
+                    result[i] += xd[i] * vd;
+                }
+            }
+
+            std::copy(result, result + count, out + offset);
+        });
+    }
+
+    //out[i] = length of x[i]
+    template<class T, size_t D>
+    inline void soa_length(size_t n, const T* const* x, T* out, bool parallel)
+    {
+        soa_for_each_block<T, D>(n, parallel, [&](size_t offset, size_t count) {
+            T* result = out + offset;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                result[i] = x[0][offset + i] * x[0][offset + i];
+            }
+
+            for (size_t d = 1; d < D; d++)
+            {
+                const T* xd = x[d] + offset;
+                for (size_t i = 0; i < count; i++)
+                {
+                    result[i] += xd[i] * xd[i];
+                }
+            }
+
+            for (size_t i = 0; i < count; i++)
+            {
+                result[i] = functions_implementation<T>::sqrt(result[i]);
+            }
+        });
+    }
+
+    //x[i] = x[i] / length of x[i] (as for vector, zero vectors are divided by 0)
+    template<class T, size_t D>
+    inline void soa_normalize(size_t n, T* const* x, bool parallel)
+    {
+        soa_for_each_block<T, D>(n, parallel, [&](size_t offset, size_t count) {
+            T length[soa_block_size_v<T, D>];
+
+            for (size_t i = 0; i < count; i++)
+            {
+                length[i] = x[0][offset + i] * x[0][offset + i];
+            }
+
+            for (size_t d = 1; d < D; d++)
+            {
+                const T* xd = x[d] + offset;
+                for (size_t i = 0; i < count; i++)
+                {
+                    length[i] += xd[i] * xd[i];
+                }
+            }
+
+            for (size_t i = 0; i < count; i++)
+            {
+                length[i] = functions_implementation<T>::sqrt(length[i]);
+            }
+
+            for (size_t d = 0; d < D; d++)
+            {
+                T* xd = x[d] + offset;
+                for (size_t i = 0; i < count; i++)
+                {
+                    xd[i] /= length[i];
+                }
+            }
+        });
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
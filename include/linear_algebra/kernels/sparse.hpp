@@ -0,0 +1,484 @@
+#pragma once
+
+#include "../parallel/parallel_for.hpp"
+#include "../memory/storage_allocator.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    /*
+        kernels of compressed sparse matrices (CSR stores rows, CSC stores columns, both are called lines here)
+        offsets (lines + 1 elements) delimit nonzeros of every line, indices hold their positions along line
+        (sorted, without duplicates) and values hold their elements
+        lines are split between tasks by numbers of nonzeros (not by numbers of lines), so dense rows do not stall parallel loops
+    */
+
+    //nonzeros processed by one task of parallel loops over lines
+    constexpr size_t sparse_chunk_non_zeros = 16384;
+
+    ///<summary>
+    /// splits [0, lines) into contiguous ranges with about sparse_chunk_non_zeros nonzeros each (lines are never split)
+    ///</summary>
+    /// <returns> boundaries of ranges (range i is [boundaries[i], boundaries[i + 1])) </returns>
+    inline storage_vector<size_t> sparse_partition(size_t lines, const size_t* offsets)
+    {
+        const size_t non_zeros = offsets[lines];
+        const size_t parts = std::max(static_cast<size_t>(1), (non_zeros + sparse_chunk_non_zeros - 1) / sparse_chunk_non_zeros);
+
+        storage_vector<size_t> boundaries(parts + 1);
+        boundaries[parts] = lines;
+
+        for (size_t part = 1; part < parts; part++)
+        {
+            const size_t first_non_zero = part * sparse_chunk_non_zeros;
+            const size_t line = std::upper_bound(offsets, offsets + lines + 1, first_non_zero) - offsets - 1;
+            boundaries[part] = std::max(boundaries[part - 1], std::min(line, lines));
+        }
+
+        return boundaries;
+    }
+
+    //calls body(line) for every line in [0, lines), ranges of lines with similar numbers of nonzeros are run in parallel if parallel is set
+    template<class F>
+    inline void sparse_for_each_line(size_t lines, const size_t* offsets, bool parallel, F&& body)
+    {
+        if (!parallel)
+        {
+            for (size_t line = 0; line < lines; line++)
+            {
+                body(line);
+            }
+            return;
+        }
+
+        const storage_vector<size_t> boundaries = sparse_partition(lines, offsets);
+
+        parallel_for(boundaries.size() - 1, true, [&](size_t part) {
+            for (size_t line = boundaries[part]; line < boundaries[part + 1]; line++)
+            {
+                body(line);
+            }
+        });
+    }
+
+    ///<summary>
+    /// compresses entries given in coordinate format (major_indices[i], minor_indices[i], entry_values[i]) to lines of major dimension
+    /// <para>entries of every line are sorted by minor index and duplicated entries are summed</para>
+    ///</summary>
+    template<class T>
+    void sparse_compress(
+        size_t lines, size_t entries,
+        const size_t* major_indices, const size_t* minor_indices, const T* entry_values,
+        storage_vector<size_t>& offsets, storage_vector<size_t>& indices, storage_vector<T>& values,
+        bool parallel)
+    {
+        //counting sort of entries by line
+        storage_vector<size_t> starts(lines + 1);
+        for (size_t entry = 0; entry < entries; entry++)
+        {
+            assert(major_indices[entry] < lines);
+            starts[major_indices[entry] + 1]++;
+        }
+
+        std::partial_sum(starts.begin(), starts.end(), starts.begin());
+
+        storage_vector<std::pair<size_t, T>> sorted(entries);
+        {
+            storage_vector<size_t> positions(starts.begin(), starts.end() - 1);
+            for (size_t entry = 0; entry < entries; entry++)
+            {
+                sorted[positions[major_indices[entry]]++] = std::make_pair(minor_indices[entry], entry_values[entry]);
+            }
+        }
+
+        //lines are sorted (stable, so duplicates are summed in order of insertion) and duplicates are merged at their beginnings
+        storage_vector<size_t> counts(lines + 1);
+
+        sparse_for_each_line(lines, starts.data(), parallel, [&](size_t line) {
+            auto first = sorted.begin() + starts[line];
+            auto last = sorted.begin() + starts[line + 1];
+
+            std::stable_sort(first, last, [](const std::pair<size_t, T>& x, const std::pair<size_t, T>& y) { return x.first < y.first; });
+
+            size_t unique = 0;
+            for (auto it = first; it != last; ++it)
+            {
+                if (unique != 0 && (first + unique - 1)->first == it->first)
+                {
+                    (first + unique - 1)->second += it->second;
+                }
+                else
+                {
+                    *(first + unique) = *it;
+                    unique++;
+                }
+            }
+
+            counts[line + 1] = unique;
+        });
+
+        std::partial_sum(counts.begin(), counts.end(), counts.begin());
+
+        offsets.assign(counts.begin(), counts.end());
+        indices.resize(offsets[lines]);
+        values.resize(offsets[lines]);
+
+        sparse_for_each_line(lines, offsets.data(), parallel, [&](size_t line) {
+            const auto first = sorted.begin() + starts[line];
+
+            for (size_t element = 0; element < offsets[line + 1] - offsets[line]; element++)
+            {
+                indices[offsets[line] + element] = (first + element)->first;
+                values[offsets[line] + element] = (first + element)->second;
+            }
+        });
+    }
+
+    ///<summary>
+    /// compressed storage of transposition (CSR of A becomes CSC of A and the other way around)
+    /// <para>lines are visited in order, so indices of transposed lines are sorted without sorting</para>
+    ///</summary>
+    template<class T>
+    void sparse_transpose(
+        size_t lines, size_t minor,
+        const size_t* offsets, const size_t* indices, const T* values,
+        storage_vector<size_t>& transposed_offsets, storage_vector<size_t>& transposed_indices, storage_vector<T>& transposed_values)
+    {
+        const size_t non_zeros = offsets[lines];
+
+        transposed_offsets.assign(minor + 1, 0);
+        transposed_indices.resize(non_zeros);
+        transposed_values.resize(non_zeros);
+
+        for (size_t element = 0; element < non_zeros; element++)
+        {
+            transposed_offsets[indices[element] + 1]++;
+        }
+
+        std::partial_sum(transposed_offsets.begin(), transposed_offsets.end(), transposed_offsets.begin());
+
+        storage_vector<size_t> positions(transposed_offsets.begin(), transposed_offsets.end() - 1);
+
+        for (size_t line = 0; line < lines; line++)
+        {
+            for (size_t element = offsets[line]; element < offsets[line + 1]; element++)
+            {
+                const size_t position = positions[indices[element]]++;
+                transposed_indices[position] = line;
+                transposed_values[position] = values[element];
+            }
+        }
+    }
+
+    ///<summary>
+    /// Y = alpha * A * X + beta * Y where lines of A are rows of product (CSR matrix times dense matrix, A^T * X for CSC matrix)
+    /// <para>X is row-major matrix with columns columns (row stride ldx), Y is lines x columns row-major matrix (row stride ldy),
+    /// every row of Y is computed by single task from contiguous rows of X (rows are split between tasks by nonzeros)</para>
+    /// <para>if beta is 0, previous content of Y is ignored</para>
+    ///</summary>
+    template<class T>
+    void sparse_gather_multiply(
+        size_t lines, size_t columns,
+        const T& alpha, const size_t* offsets, const size_t* indices, const T* values,
+        const T* x, size_t ldx,
+        const T& beta, T* y, size_t ldy,
+        bool parallel)
+    {
+        const bool accumulate = !equal(beta, get_additive_identity<T>());
+
+        sparse_for_each_line(lines, offsets, parallel, [&](size_t line) {
+            T* y_row = y + line * ldy;
+
+            if (columns == 1)
+            {
+                T sum = get_additive_identity<T>();
+                for (size_t element = offsets[line]; element < offsets[line + 1]; element++)
+                {
+                    sum += values[element] * x[indices[element] * ldx];
+                }
+
+                y_row[0] = accumulate ? alpha * sum + beta * y_row[0] : alpha * sum;
+                return;
+            }
+
+            for (size_t column = 0; column < columns; column++)
+            {
+                y_row[column] = accumulate ? beta * y_row[column] : get_additive_identity<T>();
+            }
+
+            for (size_t element = offsets[line]; element < offsets[line + 1]; element++)
+            {
+                const T factor = alpha * values[element];
+                const T* x_row = x + indices[element] * ldx;
+
+                for (size_t column = 0; column < columns; column++)
+                {
+                    y_row[column] += factor * x_row[column];
+                }
+            }
+        });
+    }
+
+    ///<summary>
+    /// Y = alpha * A * X + beta * Y where lines of A are columns of product (CSC matrix times dense matrix, A^T * X for CSR matrix)
+    /// <para>X is lines x columns row-major matrix (row stride ldx), Y is rows x columns row-major matrix (row stride ldy),
+    /// every line scatters its contribution to rows of Y, so parallel tasks accumulate into private copies of Y which are summed afterwards</para>
+    /// <para>if beta is 0, previous content of Y is ignored</para>
+    ///</summary>
+    template<class T>
+    void sparse_scatter_multiply(
+        size_t lines, size_t rows, size_t columns,
+        const T& alpha, const size_t* offsets, const size_t* indices, const T* values,
+        const T* x, size_t ldx,
+        const T& beta, T* y, size_t ldy,
+        bool parallel)
+    {
+        const bool accumulate = !equal(beta, get_additive_identity<T>());
+
+        for (size_t row = 0; row < rows; row++)
+        {
+            for (size_t column = 0; column < columns; column++)
+            {
+                y[row * ldy + column] = accumulate ? beta * y[row * ldy + column] : get_additive_identity<T>();
+            }
+        }
+
+        auto scatter = [&](size_t first_line, size_t last_line, T* result, size_t ldr) {
+            for (size_t line = first_line; line < last_line; line++)
+            {
+                const T* x_row = x + line * ldx;
+
+                for (size_t element = offsets[line]; element < offsets[line + 1]; element++)
+                {
+                    const T factor = alpha * values[element];
+                    T* result_row = result + indices[element] * ldr;
+
+                    for (size_t column = 0; column < columns; column++)
+                    {
+                        result_row[column] += factor * x_row[column];
+                    }
+                }
+            }
+        };
+
+        const storage_vector<size_t> boundaries = parallel ? sparse_partition(lines, offsets) : storage_vector<size_t>{ 0, lines };
+        const size_t parts = std::min(boundaries.size() - 1, get_executor()->concurrency());
+
+        if (parts < 2)
+        {
+            scatter(0, lines, y, ldy);
+            return;
+        }
+
+        //every task scatters its group of ranges to its own copy of Y (only one copy per thread, ranges are dealt out cyclically)
+        storage_vector<T> partial(parts * rows * columns);
+
+        parallel_for(parts, true, [&](size_t part) {
+            for (size_t range = part; range + 1 < boundaries.size(); range += parts)
+            {
+                scatter(boundaries[range], boundaries[range + 1], partial.data() + part * rows * columns, columns);
+            }
+        });
+
+        parallel_for(rows, parallel_elementwise(parts * rows * columns), [&](size_t row) {
+            for (size_t part = 0; part < parts; part++)
+            {
+                const T* partial_row = partial.data() + (part * rows + row) * columns;
+
+                for (size_t column = 0; column < columns; column++)
+                {
+                    y[row * ldy + column] += partial_row[column];
+                }
+            }
+        });
+    }
+
+    /*
+        incomplete factorizations keep sparsity pattern of factored matrix (no fill-in), so they cost about as much as few products
+        and are used as preconditioners of iterative solvers (rows must be sorted, which holds for every compressed sparse_matrix)
+        substitutions with their factors are sequential (every row depends on previous ones)
+    */
+
+    //sparse_npos marks absence of element (e.g missing diagonal)
+    constexpr size_t sparse_npos = std::numeric_limits<size_t>::max();
+
+    //positions of diagonal elements of n rows (sparse_npos for rows without stored diagonal element)
+    inline storage_vector<size_t> sparse_diagonal_positions(size_t n, const size_t* offsets, const size_t* indices)
+    {
+        storage_vector<size_t> positions(n, sparse_npos);
+
+        for (size_t row = 0; row < n; row++)
+        {
+            const size_t* found = std::lower_bound(indices + offsets[row], indices + offsets[row + 1], row);
+            if (found != indices + offsets[row + 1] && *found == row)
+            {
+                positions[row] = found - indices;
+            }
+        }
+
+        return positions;
+    }
+
+    ///<summary>
+    /// incomplete LU factorization without fill-in (ILU(0)) of n x n CSR matrix in place
+    /// <para>strictly lower part of row becomes L (unit diagonal is not stored), remaining part becomes U</para>
+    ///</summary>
+    /// <returns> false if some diagonal element is missing or becomes 0 (factors must not be used) </returns>
+    template<class T>
+    bool sparse_ilu0(size_t n, const size_t* offsets, const size_t* indices, T* values, const size_t* diagonal)
+    {
+        //marker[column] is position of element (row, column) of currently factored row
+        storage_vector<size_t> marker(n, sparse_npos);
+
+        for (size_t row = 0; row < n; row++)
+        {
+            if (diagonal[row] == sparse_npos)
+            {
+                return false;
+            }
+
+            for (size_t element = offsets[row]; element < offsets[row + 1]; element++)
+            {
+                marker[indices[element]] = element;
+            }
+
+            //row -= l(row, k) * row k for every k < row (only elements within pattern of row are updated)
+            for (size_t element = offsets[row]; element < diagonal[row]; element++)
+            {
+                const size_t k = indices[element];
+                values[element] /= values[diagonal[k]];
+
+                for (size_t k_element = diagonal[k] + 1; k_element < offsets[k + 1]; k_element++)
+                {
+                    const size_t position = marker[indices[k_element]];
+                    if (position != sparse_npos)
+                    {
+                        values[position] -= values[element] * values[k_element];
+                    }
+                }
+            }
+
+            for (size_t element = offsets[row]; element < offsets[row + 1]; element++)
+            {
+                marker[indices[element]] = sparse_npos;
+            }
+
+            if (equal(values[diagonal[row]], get_additive_identity<T>()))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    ///<summary>
+    /// incomplete Cholesky factorization without fill-in (IC(0)) in place, rows hold lower triangle of symmetric n x n matrix
+    /// (diagonal is last element of every row) which becomes L of A ~ L * L^T
+    ///</summary>
+    /// <returns> false if some diagonal element is missing or not positive (factors must not be used) </returns>
+    template<class T>
+    bool sparse_ic0(size_t n, const size_t* offsets, const size_t* indices, T* values)
+    {
+        //inner product of rows i and k of L restricted to columns smaller than k (both rows are sorted, so they are merged)
+        auto partial_inner_product = [&](size_t i, size_t k) {
+            T result = get_additive_identity<T>();
+
+            size_t i_element = offsets[i];
+            size_t k_element = offsets[k];
+
+            while (i_element < offsets[i + 1] && k_element < offsets[k + 1] && indices[i_element] < k && indices[k_element] < k)
+            {
+                if (indices[i_element] == indices[k_element])
+                {
+                    result += values[i_element++] * values[k_element++];
+                }
+                else if (indices[i_element] < indices[k_element])
+                {
+                    i_element++;
+                }
+                else
+                {
+                    k_element++;
+                }
+            }
+
+            return result;
+        };
+
+        for (size_t row = 0; row < n; row++)
+        {
+            const size_t last = offsets[row + 1];
+            if (last == offsets[row] || indices[last - 1] != row)
+            {
+                return false;
+            }
+
+            for (size_t element = offsets[row]; element + 1 < last; element++)
+            {
+                const size_t k = indices[element];
+                values[element] = (values[element] - partial_inner_product(row, k)) / values[offsets[k + 1] - 1];
+            }
+
+            const T pivot = values[last - 1] - partial_inner_product(row, row);
+            if (!(pivot > get_additive_identity<T>()))
+            {
+                return false;
+            }
+
+            values[last - 1] = functions_implementation<T>::sqrt(pivot);
+        }
+
+        return true;
+    }
+
+    //x = L^-1 * x for lower triangular CSR matrix (elements with column < row, diagonal is given by positions or is unit if diagonal is null)
+    template<class T>
+    void sparse_lower_solve(size_t n, const size_t* offsets, const size_t* indices, const T* values, const size_t* diagonal, T* x)
+    {
+        for (size_t row = 0; row < n; row++)
+        {
+            T sum = x[row];
+            for (size_t element = offsets[row]; element < offsets[row + 1] && indices[element] < row; element++)
+            {
+                sum -= values[element] * x[indices[element]];
+            }
+
+            x[row] = diagonal ? sum / values[diagonal[row]] : sum;
+        }
+    }
+
+    //x = U^-1 * x for upper triangular CSR matrix (elements with column >= row, diagonal is given by positions)
+    template<class T>
+    void sparse_upper_solve(size_t n, const size_t* offsets, const size_t* indices, const T* values, const size_t* diagonal, T* x)
+    {
+        for (size_t row = n; row-- > 0;)
+        {
+            T sum = x[row];
+            for (size_t element = diagonal[row] + 1; element < offsets[row + 1]; element++)
+            {
+                sum -= values[element] * x[indices[element]];
+            }
+
+            x[row] = sum / values[diagonal[row]];
+        }
+    }
+
+    //x = L^-T * x for lower triangular CSR matrix whose diagonal is last element of every row (rows of L are columns of L^T)
+    template<class T>
+    void sparse_transposed_lower_solve(size_t n, const size_t* offsets, const size_t* indices, const T* values, T* x)
+    {
+        for (size_t row = n; row-- > 0;)
+        {
+            x[row] /= values[offsets[row + 1] - 1];
+
+            for (size_t element = offsets[row]; element + 1 < offsets[row + 1]; element++)
+            {
+                x[indices[element]] -= values[element] * x[row];
+            }
+        }
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
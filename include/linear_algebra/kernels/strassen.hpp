@@ -0,0 +1,284 @@
+#pragma once
+
+#include "gemm.hpp"
+#include "../memory/scratch_arena.hpp"
+
+#include <atomic>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// settings of Strassen-Winograd multiplication of very large row-major floating point matrices
+/// <para>fast multiplication needs fewer operations, but its rounding errors differ from (and grow with depth of recursion above) those of regular product,
+/// set enabled to false to compute all products with packed gemm kernel</para>
+///</summary>
+struct strassen_settings
+{
+    //whether products with every dimension at least min_size are computed by strassen-winograd recursion
+    bool enabled = true;
+    size_t min_size = 2048;
+    //recursion stops (blocks are multiplied by packed gemm kernel) when any dimension of block is below crossover
+    //(see crossover benchmark in main.cpp, below it 7 products instead of 8 do not pay for additional additions, values below 2 are treated as 2)
+    size_t crossover = 1024;
+};
+
+namespace detail
+{
+    struct atomic_strassen_settings
+    {
+        std::atomic<bool> enabled;
+        std::atomic<size_t> min_size;
+        std::atomic<size_t> crossover;
+    };
+
+    inline atomic_strassen_settings& current_strassen_settings()
+    {
+        static atomic_strassen_settings settings{
+            strassen_settings().enabled,
+            strassen_settings().min_size,
+            strassen_settings().crossover
+        };
+        return settings;
+    }
+}
+
+//settings currently used by library
+inline strassen_settings get_strassen_settings()
+{
+    const detail::atomic_strassen_settings& current = detail::current_strassen_settings();
+
+    strassen_settings settings;
+    settings.enabled = current.enabled.load(std::memory_order_relaxed);
+    settings.min_size = current.min_size.load(std::memory_order_relaxed);
+    settings.crossover = current.crossover.load(std::memory_order_relaxed);
+    return settings;
+}
+
+//replaces settings used by products started from now on (by all threads)
+inline void set_strassen_settings(const strassen_settings& settings)
+{
+    detail::atomic_strassen_settings& current = detail::current_strassen_settings();
+
+    current.enabled.store(settings.enabled, std::memory_order_relaxed);
+    current.min_size.store(settings.min_size, std::memory_order_relaxed);
+    current.crossover.store(settings.crossover, std::memory_order_relaxed);
+}
+
+namespace detail
+{
+    //fast multiplication changes rounding errors (they grow with depth of recursion), so it is used only for floating point numbers
+    template<class T, class TO, class TR>
+    constexpr bool use_strassen_v = std::is_floating_point_v<T> && use_gemm_kernel_v<T, TO> && std::is_same_v<TR, T>;
+
+    //out = x + y or out = x - y for rows x columns row-major blocks (rows are processed in parallel if parallel is set)
+    template<bool Subtract, class T>
+    inline void strassen_combine(size_t rows, size_t columns, const T* x, size_t ldx, const T* y, size_t ldy, T* out, size_t ldo, bool parallel)
+    {
+        auto combine_row = [&](size_t row) {
+            const T* x_row = x + row * ldx;
+            const T* y_row = y + row * ldy;
+            T* out_row = out + row * ldo;
+
+            for (size_t column = 0; column < columns; column++)
+            {
+                out_row[column] = Subtract ? x_row[column] - y_row[column] : x_row[column] + y_row[column];
+            }
+        };
+
+        parallel_for(rows, parallel && parallel_elementwise(rows * columns), combine_row);
+    }
+
+    //number of elements of workspace used by strassen_multiply for m x k times k x n product
+    inline size_t strassen_workspace_size(size_t m, size_t n, size_t k, size_t crossover)
+    {
+        if (m < crossover || n < crossover || k < crossover)
+        {
+            return 0;
+        }
+
+        const size_t m2 = m / 2;
+        const size_t n2 = n / 2;
+        const size_t k2 = k / 2;
+
+        return m2 * k2 + k2 * n2 + m2 * n2 + strassen_workspace_size(m2, n2, k2, crossover);
+    }
+
+    ///<summary>
+    /// C = A * B for m x k row-major A, k x n row-major B and m x n row-major C (Strassen-Winograd algorithm)
+    /// <para>matrices are split into quadrants, product is computed with 7 products of quadrants (instead of 8) and 15 additions,
+    /// products of quadrants are computed recursively until block is smaller than crossover</para>
+    /// <para>odd row or column of operands is peeled off and its contribution is added by gemm kernel</para>
+    /// <para>workspace must have strassen_workspace_size(m, n, k, crossover) elements, C must not overlap A or B</para>
+    ///</summary>
+    template<class T>
+    void strassen_multiply(
+        size_t m, size_t n, size_t k,
+        const T* a, size_t lda,
+        const T* b, size_t ldb,
+        T* c, size_t ldc,
+        T* workspace, size_t crossover, bool parallel)
+    {
+        const T one = static_cast<T>(1);
+        const T zero = static_cast<T>(0);
+
+        if (m < crossover || n < crossover || k < crossover)
+        {
+            gemm<T>(m, n, k, one, a, lda, 1, b, ldb, 1, zero, c, ldc, 1, parallel);
+            return;
+        }
+
+        const size_t m2 = m / 2;
+        const size_t n2 = n / 2;
+        const size_t k2 = k / 2;
+
+        const T* a11 = a;
+        const T* a12 = a + k2;
+        const T* a21 = a + m2 * lda;
+        const T* a22 = a21 + k2;
+
+        const T* b11 = b;
+        const T* b12 = b + n2;
+        const T* b21 = b + k2 * ldb;
+        const T* b22 = b21 + n2;
+
+        T* c11 = c;
+        T* c12 = c + n2;
+        T* c21 = c + m2 * ldc;
+        T* c22 = c21 + n2;
+
+        //x holds sums of quadrants of A, y sums of quadrants of B, z product P1
+        T* x = workspace;
+        T* y = x + m2 * k2;
+        T* z = y + k2 * n2;
+        T* next_workspace = z + m2 * n2;
+
+        auto multiply = [&](const T* l, size_t ldl, const T* r, size_t ldr, T* out, size_t ldout) {
+            strassen_multiply(m2, n2, k2, l, ldl, r, ldr, out, ldout, next_workspace, crossover, parallel);
+        };
+
+        //schedule of Boyer, Dumas, Pernet and Zhou (quadrants of C hold intermediate products)
+
+        strassen_combine<true>(m2, k2, a11, lda, a21, lda, x, k2, parallel);     //S3 = A11 - A21
+        strassen_combine<true>(k2, n2, b22, ldb, b12, ldb, y, n2, parallel);     //T3 = B22 - B12
+        multiply(x, k2, y, n2, c21, ldc);                                        //P7 = S3 * T3
+
+        strassen_combine<false>(m2, k2, a21, lda, a22, lda, x, k2, parallel);    //S1 = A21 + A22
+        strassen_combine<true>(k2, n2, b12, ldb, b11, ldb, y, n2, parallel);     //T1 = B12 - B11
+        multiply(x, k2, y, n2, c22, ldc);                                        //P5 = S1 * T1
+
+        strassen_combine<true>(m2, k2, x, k2, a11, lda, x, k2, parallel);        //S2 = S1 - A11
+        strassen_combine<true>(k2, n2, b22, ldb, y, n2, y, n2, parallel);        //T2 = B22 - T1
+        multiply(x, k2, y, n2, c12, ldc);                                        //P6 = S2 * T2
+
+        strassen_combine<true>(m2, k2, a12, lda, x, k2, x, k2, parallel);        //S4 = A12 - S2
+        multiply(x, k2, b22, ldb, c11, ldc);                                     //P3 = S4 * B22
+
+        multiply(a11, lda, b11, ldb, z, n2);                                     //P1 = A11 * B11
+
+        strassen_combine<false>(m2, n2, z, n2, c12, ldc, c12, ldc, parallel);    //U2 = P1 + P6
+        strassen_combine<false>(m2, n2, c12, ldc, c21, ldc, c21, ldc, parallel); //U3 = U2 + P7
+        strassen_combine<false>(m2, n2, c12, ldc, c22, ldc, c12, ldc, parallel); //U4 = U2 + P5
+        strassen_combine<false>(m2, n2, c21, ldc, c22, ldc, c22, ldc, parallel); //U7 = U3 + P5 = C22
+        strassen_combine<false>(m2, n2, c12, ldc, c11, ldc, c12, ldc, parallel); //U5 = U4 + P3 = C12
+
+        strassen_combine<true>(k2, n2, y, n2, b21, ldb, y, n2, parallel);        //T4 = T2 - B21
+        multiply(a22, lda, y, n2, c11, ldc);                                     //P4 = A22 * T4
+        strassen_combine<true>(m2, n2, c21, ldc, c11, ldc, c21, ldc, parallel);  //U6 = U3 - P4 = C21
+
+        multiply(a12, lda, b21, ldb, c11, ldc);                                  //P2 = A12 * B21
+        strassen_combine<false>(m2, n2, z, n2, c11, ldc, c11, ldc, parallel);    //U1 = P1 + P2 = C11
+
+        //peeling of odd dimensions
+
+        if (k != 2 * k2)
+        {
+            //C[0:2m2, 0:2n2] += last column of A * last row of B
+            gemm<T>(2 * m2, 2 * n2, 1, one, a + 2 * k2, lda, 1, b + 2 * k2 * ldb, ldb, 1, one, c, ldc, 1, parallel);
+        }
+
+        if (n != 2 * n2)
+        {
+            //last column of C
+            gemm<T>(2 * m2, 1, k, one, a, lda, 1, b + 2 * n2, ldb, 1, zero, c + 2 * n2, ldc, 1, parallel);
+        }
+
+        if (m != 2 * m2)
+        {
+            //last row of C
+            gemm<T>(1, n, k, one, a + 2 * m2 * lda, lda, 1, b, ldb, 1, zero, c + 2 * m2 * ldc, ldc, 1, parallel);
+        }
+    }
+
+    //whether m x k times k x n product is computed with strassen_multiply_add under given settings
+    inline bool use_strassen(const strassen_settings& settings, size_t m, size_t n, size_t k)
+    {
+        return settings.enabled && m >= settings.min_size && n >= settings.min_size && k >= settings.min_size;
+    }
+
+    ///<summary>
+    /// C = alpha * A * B + beta * C for row-major matrices computed with Strassen-Winograd algorithm (see strassen_multiply)
+    /// <para>workspace (and product, if beta is not 0) is allocated from storage resource of caller, or from aligned_storage_resource
+    /// if caller allocates from scratch arena (buffers of hundreds of megabytes would stay reserved by arena of thread)</para>
+    ///</summary>
+    template<class T>
+    void strassen_multiply_add(
+        size_t m, size_t n, size_t k,
+        T alpha,
+        const T* a, size_t lda,
+        const T* b, size_t ldb,
+        T beta,
+        T* c, size_t ldc,
+        bool parallel,
+        size_t crossover)
+    {
+        crossover = std::max<size_t>(crossover, 2);
+
+        std::pmr::memory_resource* resource = get_storage_resource();
+        if (resource == &thread_scratch_arena())
+        {
+            resource = aligned_storage_resource();
+        }
+
+        //packing buffers of gemm kernel used for blocks below crossover are taken from the same resource
+        storage_resource_scope strassen_storage(resource);
+
+        storage_vector<T> workspace(strassen_workspace_size(m, n, k, crossover));
+
+        if (beta == static_cast<T>(0))
+        {
+            strassen_multiply(m, n, k, a, lda, b, ldb, c, ldc, workspace.data(), crossover, parallel);
+
+            if (alpha != static_cast<T>(1))
+            {
+                auto scale_row = [&](size_t row) {
+                    T* c_row = c + row * ldc;
+
+                    for (size_t column = 0; column < n; column++)
+                    {
+                        c_row[column] *= alpha;
+                    }
+                };
+
+                parallel_for(m, parallel && parallel_elementwise(m * n), scale_row);
+            }
+            return;
+        }
+
+        storage_vector<T> product(m * n);
+        strassen_multiply(m, n, k, a, lda, b, ldb, product.data(), n, workspace.data(), crossover, parallel);
+
+        auto add_row = [&](size_t row) {
+            const T* product_row = product.data() + row * n;
+            T* c_row = c + row * ldc;
+
+            for (size_t column = 0; column < n; column++)
+            {
+                c_row[column] = alpha * product_row[column] + beta * c_row[column];
+            }
+        };
+
+        parallel_for(m, parallel && parallel_elementwise(m * n), add_row);
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,612 @@
+#pragma once
+
+#include "symmetric_eigen.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    /*
+        singular value decomposition (A = U * diag(values) * V^T) of m x n row-major matrix, k = min(m, n)
+        U is m x k and V is n x k row-major matrix with orthonormal columns, singular values are in descending order
+        matrices with few columns are orthogonalized by one-sided jacobi rotations, bigger ones are reduced to bidiagonal form
+        by householder reflectors and diagonalized by implicit QR iterations (Golub-Kahan)
+        wide matrices (m < n) are decomposed as their transpositions (U and V swap their roles)
+    */
+
+    //matrices with up to this many columns (after transposition of wide ones) are decomposed by one-sided jacobi rotations
+    constexpr size_t svd_jacobi_max_size = 16;
+
+    //sorts k singular values in descending order and permutes columns of u (m rows) and v (n rows) in the same way (if given)
+    template<class T>
+    void svd_sort(size_t k, T* values, size_t m, T* u, size_t ldu, size_t n, T* v, size_t ldv)
+    {
+        for (size_t i = 0; i + 1 < k; i++)
+        {
+            const size_t largest = std::max_element(values + i, values + k) - values;
+            if (largest == i)
+            {
+                continue;
+            }
+
+            std::swap(values[i], values[largest]);
+
+            if (u)
+            {
+                for (size_t row = 0; row < m; row++)
+                {
+                    std::swap(u[row * ldu + i], u[row * ldu + largest]);
+                }
+
+                for (size_t row = 0; row < n; row++)
+                {
+                    std::swap(v[row * ldv + i], v[row * ldv + largest]);
+                }
+            }
+        }
+    }
+
+    //replaces columns [first, k) of m x k row-major matrix u by unit vectors orthogonal to all other columns (first columns must be orthonormal)
+    template<class T>
+    void svd_complete_basis(size_t m, size_t k, size_t first, T* u, size_t ldu)
+    {
+        storage_vector<T> candidate(m);
+
+        size_t unit = 0;
+        for (size_t column = first; column < k; column++)
+        {
+            //unit vectors are orthogonalized (twice, to remove rounding errors) until one of them keeps large enough norm
+            for (; unit < m; unit++)
+            {
+                std::fill(candidate.begin(), candidate.end(), get_additive_identity<T>());
+                candidate[unit] = get_multiplicative_identity<T>();
+
+                for (size_t pass = 0; pass < 2; pass++)
+                {
+                    for (size_t other = 0; other < column; other++)
+                    {
+                        T projection = get_additive_identity<T>();
+                        for (size_t row = 0; row < m; row++)
+                        {
+                            projection += u[row * ldu + other] * candidate[row];
+                        }
+
+                        for (size_t row = 0; row < m; row++)
+                        {
+                            candidate[row] -= projection * u[row * ldu + other];
+                        }
+                    }
+                }
+
+                T norm_squared = get_additive_identity<T>();
+                for (size_t row = 0; row < m; row++)
+                {
+                    norm_squared += candidate[row] * candidate[row];
+                }
+
+                if (norm_squared > static_cast<T>(0.25))
+                {
+                    const T norm = functions_implementation<T>::sqrt(norm_squared);
+                    for (size_t row = 0; row < m; row++)
+                    {
+                        u[row * ldu + column] = candidate[row] / norm;
+                    }
+
+                    unit++;
+                    break;
+                }
+            }
+        }
+    }
+
+    ///<summary>
+    /// one-sided jacobi method (Hestenes) for m x n row-major matrix (m >= n, matrix is read only)
+    /// <para>pairs of columns are rotated until all of them are orthogonal, then their norms are singular values
+    /// and normalized columns are left singular vectors, rotations accumulated from identity are right singular vectors
+    /// (singular values are computed with high relative accuracy)</para>
+    /// <para>u (m x n) and v (n x n) are computed only if they are given</para>
+    ///</summary>
+    template<class T>
+    void svd_jacobi(size_t m, size_t n, const T* a, size_t lda, T* values, T* u, size_t ldu, T* v, size_t ldv)
+    {
+        constexpr size_t max_sweeps = 64;
+
+        const T zero = get_additive_identity<T>();
+        const T one = get_multiplicative_identity<T>();
+        const T eps = functions_implementation<T>::epsilon();
+
+        //columns of A are stored as rows of transposition, so rotations and inner products read them contiguously
+        storage_vector<T> columns(n * m);
+        for (size_t row = 0; row < m; row++)
+        {
+            for (size_t column = 0; column < n; column++)
+            {
+                columns[column * m + row] = a[row * lda + column];
+            }
+        }
+
+        if (v)
+        {
+            for (size_t row = 0; row < n; row++)
+            {
+                for (size_t column = 0; column < n; column++)
+                {
+                    v[row * ldv + column] = row == column ? one : zero;
+                }
+            }
+        }
+
+        for (size_t sweep = 0; sweep < max_sweeps; sweep++)
+        {
+            bool rotated = false;
+
+            for (size_t p = 0; p + 1 < n; p++)
+            {
+                for (size_t q = p + 1; q < n; q++)
+                {
+                    T* column_p = columns.data() + p * m;
+                    T* column_q = columns.data() + q * m;
+
+                    T alpha = zero;
+                    T beta = zero;
+                    T gamma = zero;
+                    for (size_t row = 0; row < m; row++)
+                    {
+                        alpha += column_p[row] * column_p[row];
+                        beta += column_q[row] * column_q[row];
+                        gamma += column_p[row] * column_q[row];
+                    }
+
+                    if (functions_implementation<T>::abs(gamma) <= eps * functions_implementation<T>::sqrt(alpha * beta))
+                    {
+                        continue;
+                    }
+
+                    rotated = true;
+
+                    //tangent of rotation angle making columns orthogonal is smaller root of t^2 + 2 * zeta * t - 1 = 0
+                    const T zeta = (beta - alpha) / (static_cast<T>(2) * gamma);
+                    const T t = (zeta < zero ? -one : one) / (functions_implementation<T>::abs(zeta) + symmetric_eigen_hypot(zeta, one));
+                    const T c = one / symmetric_eigen_hypot(t, one);
+                    const T s = t * c;
+
+                    for (size_t row = 0; row < m; row++)
+                    {
+                        const T x = column_p[row];
+                        const T y = column_q[row];
+                        column_p[row] = c * x - s * y;
+                        column_q[row] = s * x + c * y;
+                    }
+
+                    if (v)
+                    {
+                        for (size_t row = 0; row < n; row++)
+                        {
+                            const T x = v[row * ldv + p];
+                            const T y = v[row * ldv + q];
+                            v[row * ldv + p] = c * x - s * y;
+                            v[row * ldv + q] = s * x + c * y;
+                        }
+                    }
+                }
+            }
+
+            if (!rotated)
+            {
+                break;
+            }
+        }
+
+        for (size_t column = 0; column < n; column++)
+        {
+            const T* column_data = columns.data() + column * m;
+
+            T norm_squared = zero;
+            for (size_t row = 0; row < m; row++)
+            {
+                norm_squared += column_data[row] * column_data[row];
+            }
+
+            values[column] = functions_implementation<T>::sqrt(norm_squared);
+
+            if (u)
+            {
+                const bool nonzero = !equal(values[column], zero);
+                for (size_t row = 0; row < m; row++)
+                {
+                    u[row * ldu + column] = nonzero ? column_data[row] / values[column] : zero;
+                }
+            }
+        }
+
+        svd_sort(n, values, m, u, ldu, n, v, ldv);
+
+        if (u)
+        {
+            //zero singular values have zero columns, their left singular vectors are any completion of orthonormal basis
+            size_t nonzero = 0;
+            while (nonzero < n && !equal(values[nonzero], zero))
+            {
+                nonzero++;
+            }
+
+            svd_complete_basis(m, n, nonzero, u, ldu);
+        }
+    }
+
+    //C = C * H for rows x n row-major matrix C and reflector H = I - tau * v * v^T (v[0] = 1 is not read, v is contiguous), rows are updated in parallel if parallel is set
+    template<class T>
+    void svd_apply_reflector_right(size_t rows, size_t n, const T* v, T tau, T* c, size_t ldc, bool parallel)
+    {
+        if (n == 0 || equal(tau, get_additive_identity<T>()))
+        {
+            return;
+        }
+
+        parallel_for(rows, parallel, [&](size_t row) {
+            T* c_row = c + row * ldc;
+
+            T w = c_row[0];
+            for (size_t column = 1; column < n; column++)
+            {
+                w += c_row[column] * v[column];
+            }
+            w *= tau;
+
+            c_row[0] -= w;
+            for (size_t column = 1; column < n; column++)
+            {
+                c_row[column] -= w * v[column];
+            }
+        });
+    }
+
+    ///<summary>
+    /// reduces m x n row-major matrix (m >= n) to upper bidiagonal form B = Q^T * A * P by householder reflectors
+    /// <para>diagonal of B is written to d, its superdiagonal to e (e[n - 1] = 0), Q = H_0 * ... * H_(n-1) is stored
+    /// as in qr_factorize (vectors below diagonal, scalars in tau_left), P = G_0 * ... * G_(n-2) as in symmetric_tridiagonalize
+    /// (vectors in rows of A right of superdiagonal, scalars in tau_right)</para>
+    /// <para>every reflector is applied to trailing matrix as soon as it is generated (rows are updated in parallel if parallel is set)</para>
+    ///</summary>
+    template<class T>
+    void svd_bidiagonalize(size_t m, size_t n, T* a, size_t lda, T* d, T* e, T* tau_left, T* tau_right, bool parallel)
+    {
+        for (size_t k = 0; k < n; k++)
+        {
+            T* a_k = a + k * lda + k;
+
+            //column reflector annihilates elements below diagonal
+            tau_left[k] = qr_householder(a_k[0], m - k - 1, a_k + lda, lda);
+            d[k] = a_k[0];
+            qr_apply_reflector(m - k, n - k - 1, a_k, lda, tau_left[k], a_k + 1, lda, parallel && parallel_elimination(m - k, n - k - 1));
+
+            if (k + 1 == n)
+            {
+                tau_right[k] = get_additive_identity<T>();
+                e[k] = get_additive_identity<T>();
+                break;
+            }
+
+            //row reflector annihilates elements right of superdiagonal
+            tau_right[k] = qr_householder(a_k[1], n - k - 2, a_k + 2, static_cast<size_t>(1));
+            e[k] = a_k[1];
+            svd_apply_reflector_right(m - k - 1, n - k - 1, a_k + 1, tau_right[k], a_k + lda + 1, lda, parallel && parallel_elimination(m - k - 1, n - k - 1));
+        }
+    }
+
+    ///<summary>
+    /// singular values of upper bidiagonal n x n matrix by implicit QR iterations with Wilkinson-like shifts (Golub-Kahan-Reinsch)
+    /// <para>d is diagonal (overwritten by singular values in descending order), e is superdiagonal (e must have n elements, it is destroyed)</para>
+    /// <para>if u and v are given, their columns (n rows) are rotated by left and right plane rotations (u = v = I gives singular vectors of B)</para>
+    ///</summary>
+    template<class T>
+    void bidiagonal_qr(size_t n, T* d, T* e, T* u, size_t ldu, T* v, size_t ldv)
+    {
+        constexpr size_t max_iterations = 75;
+
+        const T zero = get_additive_identity<T>();
+        const T eps = functions_implementation<T>::epsilon();
+        //elements below this are negligible even if they are not small relative to their neighbours (e.g underflowing ones)
+        const T tiny = std::numeric_limits<T>::min() / eps;
+
+        auto abs = [](const T& x) { return functions_implementation<T>::abs(x); };
+
+        //columns i and j of x (n rows) are replaced by c * x_i + s * x_j and c * x_j - s * x_i
+        auto rotate = [n](T* x, size_t ldx, size_t i, size_t j, T c, T s) {
+            if (!x)
+            {
+                return;
+            }
+
+            for (size_t row = 0; row < n; row++)
+            {
+                const T x_i = x[row * ldx + i];
+                const T x_j = x[row * ldx + j];
+                x[row * ldx + i] = c * x_i + s * x_j;
+                x[row * ldx + j] = c * x_j - s * x_i;
+            }
+        };
+
+        if (n == 0)
+        {
+            return;
+        }
+
+        e[n - 1] = zero;
+
+        size_t p = n;
+        size_t iterations = 0;
+
+        while (p > 0)
+        {
+            //k is last index (searching upwards from p - 2) of negligible superdiagonal element, or -1 if there is none
+            ptrdiff_t k = static_cast<ptrdiff_t>(p) - 2;
+            for (; k >= 0; k--)
+            {
+                if (abs(e[k]) <= tiny + eps * (abs(d[k]) + abs(d[k + 1])))
+                {
+                    e[k] = zero;
+                    break;
+                }
+            }
+
+            //1: d[p - 1] is negligible, 2: d[k] is negligible, 3: QR step on d[k + 1 .. p), 4: d[p - 1] has converged
+            int action;
+
+            if (k == static_cast<ptrdiff_t>(p) - 2)
+            {
+                action = 4;
+            }
+            else
+            {
+                ptrdiff_t ks = static_cast<ptrdiff_t>(p) - 1;
+                for (; ks > k; ks--)
+                {
+                    const T t = abs(e[ks]) + (ks != k + 1 ? abs(e[ks - 1]) : zero);
+                    if (abs(d[ks]) <= tiny + eps * t)
+                    {
+                        d[ks] = zero;
+                        break;
+                    }
+                }
+
+                if (ks == k)
+                {
+                    action = 3;
+                }
+                else if (ks == static_cast<ptrdiff_t>(p) - 1)
+                {
+                    action = 1;
+                }
+                else
+                {
+                    action = 2;
+                    k = ks;
+                }
+            }
+
+            const size_t first = static_cast<size_t>(k + 1);
+
+            switch (action)
+            {
+            case 1:
+            {
+                //zero on diagonal: e[p - 2] is chased up by right rotations
+                T f = e[p - 2];
+                e[p - 2] = zero;
+
+                for (size_t j = p - 1; j-- > first;)
+                {
+                    const T t = symmetric_eigen_hypot(d[j], f);
+                    const T c = d[j] / t;
+                    const T s = f / t;
+                    d[j] = t;
+
+                    if (j != first)
+                    {
+                        f = -s * e[j - 1];
+                        e[j - 1] = c * e[j - 1];
+                    }
+
+                    rotate(v, ldv, j, p - 1, c, s);
+                }
+                break;
+            }
+            case 2:
+            {
+                //zero on diagonal: e[first - 1] is chased down by left rotations, which splits matrix
+                T f = e[first - 1];
+                e[first - 1] = zero;
+
+                for (size_t j = first; j < p; j++)
+                {
+                    const T t = symmetric_eigen_hypot(d[j], f);
+                    const T c = d[j] / t;
+                    const T s = f / t;
+                    d[j] = t;
+                    f = -s * e[j];
+                    e[j] = c * e[j];
+
+                    rotate(u, ldu, j, first - 1, c, s);
+                }
+                break;
+            }
+            case 3:
+            {
+                //shift is eigenvalue of trailing 2x2 block of B^T * B closer to its last diagonal element (values are scaled against overflow)
+                const T scale = std::max({ abs(d[p - 1]), abs(d[p - 2]), abs(e[p - 2]), abs(d[first]), abs(e[first]) });
+                const T sp = d[p - 1] / scale;
+                const T spm1 = d[p - 2] / scale;
+                const T epm1 = e[p - 2] / scale;
+                const T sk = d[first] / scale;
+                const T ek = e[first] / scale;
+                const T b = ((spm1 + sp) * (spm1 - sp) + epm1 * epm1) / static_cast<T>(2);
+                const T c = (sp * epm1) * (sp * epm1);
+
+                T shift = zero;
+                if (!equal(b, zero) || !equal(c, zero))
+                {
+                    shift = functions_implementation<T>::sqrt(b * b + c);
+                    if (b < zero)
+                    {
+                        shift = -shift;
+                    }
+                    shift = c / (b + shift);
+                }
+
+                T f = (sk + sp) * (sk - sp) + shift;
+                T g = sk * ek;
+
+                //bulge is chased down by alternating right and left rotations
+                for (size_t j = first; j + 1 < p; j++)
+                {
+                    T t = symmetric_eigen_hypot(f, g);
+                    T cs = f / t;
+                    T sn = g / t;
+
+                    if (j != first)
+                    {
+                        e[j - 1] = t;
+                    }
+
+                    f = cs * d[j] + sn * e[j];
+                    e[j] = cs * e[j] - sn * d[j];
+                    g = sn * d[j + 1];
+                    d[j + 1] = cs * d[j + 1];
+
+                    rotate(v, ldv, j, j + 1, cs, sn);
+
+                    t = symmetric_eigen_hypot(f, g);
+                    cs = f / t;
+                    sn = g / t;
+                    d[j] = t;
+                    f = cs * e[j] + sn * d[j + 1];
+                    d[j + 1] = -sn * e[j] + cs * d[j + 1];
+                    g = sn * e[j + 1];
+                    e[j + 1] = cs * e[j + 1];
+
+                    rotate(u, ldu, j, j + 1, cs, sn);
+                }
+
+                e[p - 2] = f;
+
+                //singular value which does not converge is accepted as it is
+                if (++iterations >= max_iterations)
+                {
+                    e[p - 2] = zero;
+                }
+                break;
+            }
+            default:
+            {
+                //singular value is made positive and moved down to its place in descending order
+                size_t j = first;
+
+                if (d[j] < zero)
+                {
+                    d[j] = -d[j];
+
+                    if (v)
+                    {
+                        for (size_t row = 0; row < n; row++)
+                        {
+                            v[row * ldv + j] = -v[row * ldv + j];
+                        }
+                    }
+                }
+
+                while (j + 1 < n && d[j] < d[j + 1])
+                {
+                    std::swap(d[j], d[j + 1]);
+
+                    if (u)
+                    {
+                        for (size_t row = 0; row < n; row++)
+                        {
+                            std::swap(u[row * ldu + j], u[row * ldu + j + 1]);
+                            std::swap(v[row * ldv + j], v[row * ldv + j + 1]);
+                        }
+                    }
+
+                    j++;
+                }
+
+                iterations = 0;
+                p--;
+                break;
+            }
+            }
+        }
+    }
+
+    ///<summary>
+    /// singular values (in descending order) and, if u and v are given, singular vectors of m x n row-major matrix
+    /// (matrix is destroyed), u is m x k and v is n x k row-major matrix where k = min(m, n)
+    /// <para>matrices with up to svd_jacobi_max_size columns (rows for wide ones) are decomposed by one-sided jacobi method,
+    /// bigger ones are bidiagonalized and diagonalized by implicit QR iterations, rotations are accumulated on k x k matrices
+    /// and multiplied by reflectors afterwards (reflectors of P in blocks by matrix products)</para>
+    ///</summary>
+    /// <param name="parallel"> whether steps expensive enough to go parallel (see parallel_thresholds) may be split over threads </param>
+    template<class T>
+    void svd_solve(size_t m, size_t n, T* a, size_t lda, T* values, T* u, size_t ldu, T* v, size_t ldv, bool parallel = false)
+    {
+        assert((u == nullptr) == (v == nullptr));
+
+        if (m < n)
+        {
+            //A^T = V * diag(values) * U^T
+            storage_vector<T> transposition(n * m);
+
+            parallel_for(n, parallel && parallel_copy(n * m * sizeof(T)), [&](size_t row) {
+                for (size_t column = 0; column < m; column++)
+                {
+                    transposition[row * m + column] = a[column * lda + row];
+                }
+            });
+
+            svd_solve(n, m, transposition.data(), m, values, v, ldv, u, ldu, parallel);
+            return;
+        }
+
+        if (n <= svd_jacobi_max_size)
+        {
+            svd_jacobi(m, n, a, lda, values, u, ldu, v, ldv);
+            return;
+        }
+
+        storage_vector<T> e(n);
+        storage_vector<T> tau_left(n);
+        storage_vector<T> tau_right(n);
+
+        svd_bidiagonalize(m, n, a, lda, values, e.data(), tau_left.data(), tau_right.data(), parallel);
+
+        if (!u)
+        {
+            bidiagonal_qr(n, values, e.data(), static_cast<T*>(nullptr), n, static_cast<T*>(nullptr), n);
+            return;
+        }
+
+        //U = Q * [W; 0] and V = P * Z, where W and Z are singular vectors of B accumulated in first n rows of u and in v
+        for (size_t row = 0; row < m; row++)
+        {
+            std::fill(u + row * ldu, u + row * ldu + n, get_additive_identity<T>());
+            if (row < n)
+            {
+                u[row * ldu + row] = get_multiplicative_identity<T>();
+            }
+        }
+
+        for (size_t row = 0; row < n; row++)
+        {
+            std::fill(v + row * ldv, v + row * ldv + n, get_additive_identity<T>());
+            v[row * ldv + row] = get_multiplicative_identity<T>();
+        }
+
+        bidiagonal_qr(n, values, e.data(), u, ldu, v, ldv);
+
+        qr_apply_q(m, n, a, lda, tau_left.data(), u, ldu, n, parallel);
+        symmetric_tridiagonal_back_transform(n, a, lda, tau_right.data(), v, ldv, n, parallel);
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
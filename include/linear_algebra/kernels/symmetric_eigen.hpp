@@ -0,0 +1,828 @@
+#pragma once
+
+#include "qr.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    /*
+        eigenvalue decomposition of symmetric matrices (A = V * diag(values) * V^T)
+        matrix is reduced to tridiagonal form T = Q^T * A * Q by householder reflectors, eigenpairs of T are computed
+        by implicit QL iterations (eigenvalues only) or by divide and conquer (eigenvectors), eigenvectors of A are Q * eigenvectors of T
+        eigenvalues are returned in ascending order, eigenvectors are columns of row-major matrix V
+    */
+
+    //sqrt(x * x + y * y) without overflow of squares
+    template<class T>
+    inline T symmetric_eigen_hypot(T x, T y)
+    {
+        x = functions_implementation<T>::abs(x);
+        y = functions_implementation<T>::abs(y);
+
+        const T larger = std::max(x, y);
+        if (equal(larger, get_additive_identity<T>()))
+        {
+            return get_additive_identity<T>();
+        }
+
+        const T ratio = std::min(x, y) / larger;
+        return larger * functions_implementation<T>::sqrt(get_multiplicative_identity<T>() + ratio * ratio);
+    }
+
+    //sorts n eigenvalues in ascending order and permutes columns of n x n row-major eigenvectors (if given) in the same way
+    template<class T>
+    void symmetric_eigen_sort(size_t n, T* values, T* vectors, size_t ldv)
+    {
+        for (size_t i = 0; i + 1 < n; i++)
+        {
+            const size_t smallest = std::min_element(values + i, values + n) - values;
+            if (smallest == i)
+            {
+                continue;
+            }
+
+            std::swap(values[i], values[smallest]);
+
+            if (vectors)
+            {
+                for (size_t row = 0; row < n; row++)
+                {
+                    std::swap(vectors[row * ldv + i], vectors[row * ldv + smallest]);
+                }
+            }
+        }
+    }
+
+    //symmetric matrices up to this size are diagonalized directly by jacobi rotations (closed-form formula if only eigenvalues are needed)
+    constexpr size_t symmetric_eigen_jacobi_max_size = 3;
+
+    ///<summary>
+    /// cyclic jacobi method for small symmetric n x n row-major matrix (both triangles are read and destroyed)
+    /// <para>off-diagonal elements are annihilated by plane rotations until they are negligible relative to diagonal ones,
+    /// which gives eigenvalues with high relative accuracy, eigenvectors are accumulated only if vectors is given</para>
+    ///</summary>
+    template<class T>
+    void symmetric_eigen_jacobi(size_t n, T* a, size_t lda, T* values, T* vectors, size_t ldv)
+    {
+        constexpr size_t max_sweeps = 64;
+
+        const T zero = get_additive_identity<T>();
+        const T one = get_multiplicative_identity<T>();
+        const T eps = functions_implementation<T>::epsilon();
+
+        if (vectors)
+        {
+            for (size_t row = 0; row < n; row++)
+            {
+                for (size_t column = 0; column < n; column++)
+                {
+                    vectors[row * ldv + column] = row == column ? one : zero;
+                }
+            }
+        }
+
+        for (size_t sweep = 0; sweep < max_sweeps; sweep++)
+        {
+            bool rotated = false;
+
+            for (size_t p = 0; p + 1 < n; p++)
+            {
+                for (size_t q = p + 1; q < n; q++)
+                {
+                    const T a_pq = a[p * lda + q];
+                    const T a_pp = a[p * lda + p];
+                    const T a_qq = a[q * lda + q];
+
+                    if (functions_implementation<T>::abs(a_pq) <= eps * functions_implementation<T>::sqrt(functions_implementation<T>::abs(a_pp * a_qq)))
+                    {
+                        continue;
+                    }
+
+                    rotated = true;
+
+                    //tangent of rotation angle is smaller root of t^2 + 2 * theta * t - 1 = 0
+                    const T theta = (a_qq - a_pp) / (static_cast<T>(2) * a_pq);
+                    const T t = (theta < zero ? -one : one) / (functions_implementation<T>::abs(theta) + symmetric_eigen_hypot(theta, one));
+                    const T c = one / symmetric_eigen_hypot(t, one);
+                    const T s = t * c;
+
+                    a[p * lda + p] = a_pp - t * a_pq;
+                    a[q * lda + q] = a_qq + t * a_pq;
+                    a[p * lda + q] = zero;
+                    a[q * lda + p] = zero;
+
+                    for (size_t r = 0; r < n; r++)
+                    {
+                        if (r == p || r == q)
+                        {
+                            continue;
+                        }
+
+                        const T a_rp = a[r * lda + p];
+                        const T a_rq = a[r * lda + q];
+                        a[r * lda + p] = a[p * lda + r] = c * a_rp - s * a_rq;
+                        a[r * lda + q] = a[q * lda + r] = s * a_rp + c * a_rq;
+                    }
+
+                    if (vectors)
+                    {
+                        for (size_t r = 0; r < n; r++)
+                        {
+                            const T v_rp = vectors[r * ldv + p];
+                            const T v_rq = vectors[r * ldv + q];
+                            vectors[r * ldv + p] = c * v_rp - s * v_rq;
+                            vectors[r * ldv + q] = s * v_rp + c * v_rq;
+                        }
+                    }
+                }
+            }
+
+            if (!rotated)
+            {
+                break;
+            }
+        }
+
+        for (size_t diagonal = 0; diagonal < n; diagonal++)
+        {
+            values[diagonal] = a[diagonal * lda + diagonal];
+        }
+
+        symmetric_eigen_sort(n, values, vectors, ldv);
+    }
+
+    ///<summary>
+    /// reduces symmetric n x n row-major matrix (both triangles are read) to tridiagonal form T = Q^T * A * Q
+    /// <para>diagonal of T is written to d, its off-diagonal to e (n - 1 elements), Q = H_0 * ... * H_(n-2) is stored as
+    /// householder vectors v_k in rows of strictly upper triangle of A (v_k[0] = 1 is not stored) and scalars tau (n - 1 elements)</para>
+    /// <para>every reflector is applied to trailing matrix by symmetric rank 2 update (rows are updated in parallel if parallel is set)</para>
+    ///</summary>
+    template<class T>
+    void symmetric_tridiagonalize(size_t n, T* a, size_t lda, T* d, T* e, T* tau, bool parallel)
+    {
+        storage_vector<T> w(n);
+
+        for (size_t k = 0; k < n; k++)
+        {
+            d[k] = a[k * lda + k];
+
+            if (k + 1 == n)
+            {
+                break;
+            }
+
+            //row k right of diagonal is column k below diagonal, it becomes householder vector
+            T* v = a + k * lda + k + 1;
+            const size_t rows = n - k - 1;
+
+            tau[k] = qr_householder(v[0], rows - 1, v + 1, static_cast<size_t>(1));
+            e[k] = v[0];
+
+            if (equal(tau[k], get_additive_identity<T>()))
+            {
+                continue;
+            }
+
+            T* a22 = a + (k + 1) * lda + k + 1;
+            const bool parallel_step = parallel && parallel_elimination(rows, rows);
+
+            auto v_at = [&](size_t i) { return i == 0 ? get_multiplicative_identity<T>() : v[i]; };
+
+            //p = tau * A22 * v
+            parallel_for(rows, parallel_step, [&](size_t row) {
+                const T* a_row = a22 + row * lda;
+
+                T sum = a_row[0];
+                for (size_t column = 1; column < rows; column++)
+                {
+                    sum += a_row[column] * v[column];
+                }
+
+                w[row] = tau[k] * sum;
+            });
+
+            //w = p - (tau / 2) * (p^T * v) * v
+            T inner_product = w[0];
+            for (size_t i = 1; i < rows; i++)
+            {
+                inner_product += w[i] * v[i];
+            }
+
+            const T scale = tau[k] * inner_product / static_cast<T>(2);
+            for (size_t i = 0; i < rows; i++)
+            {
+                w[i] -= scale * v_at(i);
+            }
+
+            //A22 = A22 - v * w^T - w * v^T
+            parallel_for(rows, parallel_step, [&](size_t row) {
+                T* a_row = a22 + row * lda;
+                const T v_row = v_at(row);
+                const T w_row = w[row];
+
+                a_row[0] -= v_row * w[0] + w_row;
+                for (size_t column = 1; column < rows; column++)
+                {
+                    a_row[column] -= v_row * w[column] + w_row * v[column];
+                }
+            });
+        }
+    }
+
+    ///<summary>
+    /// V = Q * V for n x columns row-major matrix V, where Q is given by reflectors stored by symmetric_tridiagonalize
+    /// <para>for types supported by packed matrix multiplication blocks of reflectors are gathered to compact WY representation
+    /// (see qr_factorize_blocked) and applied by matrix products</para>
+    ///</summary>
+    template<class T>
+    void symmetric_tridiagonal_back_transform(size_t n, const T* a, size_t lda, const T* tau, T* v, size_t ldv, size_t columns, bool parallel)
+    {
+        const size_t reflectors = n > 1 ? n - 1 : 0;
+
+        if constexpr (use_gemm_kernel_v<T, T>)
+        {
+            if (reflectors >= qr_blocked_min_size)
+            {
+                storage_vector<T> householder(n * qr_block_size);
+                storage_vector<T> t(qr_block_size * qr_block_size);
+                storage_vector<T> w(qr_block_size * columns);
+                storage_vector<T> tw(qr_block_size * columns);
+
+                //blocks are applied in reverse order, Q_block = H_k * ... * H_(k+kb-1) = I - V * T * V^T
+                for (size_t block = (reflectors + qr_block_size - 1) / qr_block_size; block-- > 0;)
+                {
+                    const size_t k = block * qr_block_size;
+                    const size_t kb = std::min(qr_block_size, reflectors - k);
+                    const size_t rows = n - k - 1;
+
+                    parallel_for(rows, parallel && parallel_copy(rows * kb * sizeof(T)), [&](size_t row) {
+                        T* householder_row = householder.data() + row * kb;
+
+                        for (size_t column = 0; column < kb; column++)
+                        {
+                            householder_row[column] = column < row ? a[(k + column) * lda + k + 1 + row] : (column == row ? get_multiplicative_identity<T>() : get_additive_identity<T>());
+                        }
+                    });
+
+                    qr_triangular_factor(rows, kb, householder.data(), tau + k, t.data(), parallel && parallel_gemm(kb, kb, rows));
+
+                    T* c = v + (k + 1) * ldv;
+
+                    //W = V^T * C
+                    gemm<T>(kb, columns, rows, static_cast<T>(1), householder.data(), 1, kb, c, ldv, 1, static_cast<T>(0), w.data(), columns, 1, parallel && parallel_gemm(kb, columns, rows));
+                    //W = T * W
+                    gemm<T>(kb, columns, kb, static_cast<T>(1), t.data(), kb, 1, w.data(), columns, 1, static_cast<T>(0), tw.data(), columns, 1, parallel && parallel_gemm(kb, columns, kb));
+                    //C = C - V * W
+                    gemm<T>(rows, columns, kb, static_cast<T>(-1), householder.data(), kb, 1, tw.data(), columns, 1, static_cast<T>(1), c, ldv, 1, parallel && parallel_gemm(rows, columns, kb));
+                }
+
+                return;
+            }
+        }
+
+        for (size_t k = reflectors; k-- > 0;)
+        {
+            qr_apply_reflector(n - k - 1, columns, a + k * lda + k + 1, static_cast<size_t>(1), tau[k], v + (k + 1) * ldv, ldv, parallel && parallel_elimination(n - k - 1, columns));
+        }
+    }
+
+    ///<summary>
+    /// eigenvalues (and eigenvectors) of symmetric tridiagonal n x n matrix by implicit QL iterations with Wilkinson shifts
+    /// <para>d is diagonal (overwritten by eigenvalues in ascending order), e is off-diagonal (e must have n elements, it is destroyed)</para>
+    /// <para>if z is given, its columns (n rows) are rotated by the same plane rotations (z = I gives eigenvectors of T)</para>
+    ///</summary>
+    template<class T>
+    void tridiagonal_ql(size_t n, T* d, T* e, T* z, size_t ldz)
+    {
+        constexpr size_t max_iterations = 64;
+
+        const T zero = get_additive_identity<T>();
+        const T one = get_multiplicative_identity<T>();
+        const T eps = functions_implementation<T>::epsilon();
+
+        if (n == 0)
+        {
+            return;
+        }
+
+        e[n - 1] = zero;
+
+        T shift = zero;
+        T norm = zero;
+
+        for (size_t l = 0; l < n; l++)
+        {
+            norm = std::max(norm, functions_implementation<T>::abs(d[l]) + functions_implementation<T>::abs(e[l]));
+
+            //looking for small off-diagonal element splitting matrix
+            size_t m = l;
+            while (m + 1 < n && functions_implementation<T>::abs(e[m]) > eps * norm)
+            {
+                m++;
+            }
+
+            if (m > l)
+            {
+                for (size_t iteration = 0; iteration < max_iterations && functions_implementation<T>::abs(e[l]) > eps * norm; iteration++)
+                {
+                    //shift is eigenvalue of leading 2x2 block closer to d[l]
+                    T g = d[l];
+                    T p = (d[l + 1] - g) / (static_cast<T>(2) * e[l]);
+                    T r = symmetric_eigen_hypot(p, one);
+                    if (p < zero)
+                    {
+                        r = -r;
+                    }
+
+                    d[l] = e[l] / (p + r);
+                    d[l + 1] = e[l] * (p + r);
+
+                    const T d_l1 = d[l + 1];
+                    T h = g - d[l];
+
+                    for (size_t i = l + 2; i < n; i++)
+                    {
+                        d[i] -= h;
+                    }
+
+                    shift += h;
+
+                    //implicit QL step (chasing of bulge by plane rotations from bottom to top)
+                    p = d[m];
+
+                    T c = one;
+                    T c2 = c;
+                    T c3 = c;
+                    T s = zero;
+                    T s2 = zero;
+                    const T e_l1 = e[l + 1];
+
+                    for (size_t i = m; i-- > l;)
+                    {
+                        c3 = c2;
+                        c2 = c;
+                        s2 = s;
+
+                        g = c * e[i];
+                        h = c * p;
+                        r = symmetric_eigen_hypot(p, e[i]);
+                        e[i + 1] = s * r;
+                        s = e[i] / r;
+                        c = p / r;
+                        p = c * d[i] - s * g;
+                        d[i + 1] = h + s * (c * g + s * d[i]);
+
+                        if (z)
+                        {
+                            for (size_t row = 0; row < n; row++)
+                            {
+                                T* z_row = z + row * ldz;
+                                h = z_row[i + 1];
+                                z_row[i + 1] = s * z_row[i] + c * h;
+                                z_row[i] = c * z_row[i] - s * h;
+                            }
+                        }
+                    }
+
+                    p = -s * s2 * c3 * e_l1 * e[l] / d_l1;
+                    e[l] = s * p;
+                    d[l] = c * p;
+                }
+            }
+
+            d[l] += shift;
+            e[l] = zero;
+        }
+
+        symmetric_eigen_sort(n, d, z, ldz);
+    }
+
+    ///<summary>
+    /// eigenpairs of D + rho * z * z^T (rho > 0, ||z|| = 1) for diagonal k x k matrix D with ascending, well separated d
+    /// and components of z which are not negligible (see tridiagonal_merge)
+    /// <para>roots of secular equation 1 + rho * sum(z_i^2 / (d_i - lambda)) = 0 are found by bisection relative to nearest pole,
+    /// so differences d_i - lambda_j are accurate, z is recomputed from roots (Gu and Eisenstat), so eigenvectors are orthogonal</para>
+    /// <para>eigenvalues are written to values, eigenvectors to columns of k x k row-major u</para>
+    ///</summary>
+    template<class T>
+    void tridiagonal_secular_solve(size_t k, const T* d, const T* z, T rho, T* values, T* u, bool parallel)
+    {
+        constexpr size_t max_bisections = 256;
+
+        const T zero = get_additive_identity<T>();
+        const T one = get_multiplicative_identity<T>();
+
+        //delta[i * k + j] = d_i - lambda_j
+        storage_vector<T> delta(k * k);
+        storage_vector<T> z_hat(k);
+
+        const bool parallel_roots = parallel && parallel_elimination(k, k);
+
+        parallel_for(k, parallel_roots, [&](size_t j) {
+            //lambda = d[origin] + shift
+            auto secular = [&](size_t origin, T shift) {
+                T sum = one;
+                for (size_t i = 0; i < k; i++)
+                {
+                    sum += rho * z[i] * z[i] / ((d[i] - d[origin]) - shift);
+                }
+                return sum;
+            };
+
+            //root is in (d_j, d_(j+1)) or in (d_(k-1), d_(k-1) + rho) for the last one, secular function increases there
+            size_t origin = j;
+            T lower = zero;
+            T upper = j + 1 < k ? d[j + 1] - d[j] : rho;
+
+            if (j + 1 < k)
+            {
+                const T middle = upper / static_cast<T>(2);
+
+                if (secular(j, middle) >= zero)
+                {
+                    upper = middle;
+                }
+                else
+                {
+                    origin = j + 1;
+                    lower = -middle;
+                    upper = zero;
+                }
+            }
+
+            for (size_t bisection = 0; bisection < max_bisections; bisection++)
+            {
+                const T middle = (lower + upper) / static_cast<T>(2);
+                if (middle == lower || middle == upper)
+                {
+                    break;
+                }
+
+                if (secular(origin, middle) < zero)
+                {
+                    lower = middle;
+                }
+                else
+                {
+                    upper = middle;
+                }
+            }
+
+            //bound further from pole is never equal to it
+            const T shift = origin == j ? upper : lower;
+
+            values[j] = d[origin] + shift;
+
+            for (size_t i = 0; i < k; i++)
+            {
+                delta[i * k + j] = (d[i] - d[origin]) - shift;
+            }
+        });
+
+        //z_i^2 = prod_j(lambda_j - d_i) / (rho * prod_(j != i)(d_j - d_i)), factors are paired so every ratio is positive
+        parallel_for(k, parallel_roots, [&](size_t i) {
+            const T* delta_i = delta.data() + i * k;
+
+            T product = -delta_i[k - 1] / rho;
+
+            for (size_t j = 0; j < i; j++)
+            {
+                product *= delta_i[j] / (d[i] - d[j]);
+            }
+
+            for (size_t j = i; j + 1 < k; j++)
+            {
+                product *= -delta_i[j] / (d[j + 1] - d[i]);
+            }
+
+            const T magnitude = functions_implementation<T>::sqrt(functions_implementation<T>::abs(product));
+            z_hat[i] = z[i] < zero ? -magnitude : magnitude;
+        });
+
+        //u_j = (D - lambda_j * I)^-1 * z_hat (normalized)
+        parallel_for(k, parallel_roots, [&](size_t j) {
+            T norm = zero;
+
+            for (size_t i = 0; i < k; i++)
+            {
+                const T element = z_hat[i] / delta[i * k + j];
+                u[i * k + j] = element;
+                norm += element * element;
+            }
+
+            norm = functions_implementation<T>::sqrt(norm);
+
+            for (size_t i = 0; i < k; i++)
+            {
+                u[i * k + j] /= norm;
+            }
+        });
+    }
+
+    ///<summary>
+    /// merges eigen decompositions of halves [0, m) and [m, n) of torn tridiagonal matrix (see tridiagonal_divide_and_conquer)
+    /// <para>n x n block q holds eigenvectors of halves on its diagonal blocks, d their eigenvalues, rho is off-diagonal element
+    /// which was removed, so T = diag(Q1, Q2) * (diag(d) + rho * z * z^T) * diag(Q1, Q2)^T with z = (last row of Q1, first row of Q2)</para>
+    /// <para>eigenpairs with negligible z_i or with (almost) equal d are deflated, the remaining ones are computed by secular equation
+    /// and eigenvectors are multiplied by q with single matrix product</para>
+    ///</summary>
+    template<class T>
+    void tridiagonal_merge(size_t n, size_t m, T rho, T* d, T* q, size_t ldq, bool parallel)
+    {
+        const T zero = get_additive_identity<T>();
+        const T one = get_multiplicative_identity<T>();
+        const T eps = functions_implementation<T>::epsilon();
+
+        storage_vector<T> z(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            z[i] = i < m ? q[(m - 1) * ldq + i] : q[m * ldq + i];
+        }
+
+        //for negative rho eigenpairs are computed for -D - rho * z * z^T and then negated
+        const bool negated = rho < zero;
+        if (negated)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                d[i] = -d[i];
+            }
+            rho = -rho;
+        }
+
+        T z_norm = zero;
+        for (size_t i = 0; i < n; i++)
+        {
+            z_norm += z[i] * z[i];
+        }
+
+        rho *= z_norm;
+        z_norm = functions_implementation<T>::sqrt(z_norm);
+
+        for (size_t i = 0; i < n; i++)
+        {
+            z[i] /= z_norm;
+        }
+
+        std::vector<size_t> order(n);
+        std::iota(order.begin(), order.end(), size_t(0));
+        std::stable_sort(order.begin(), order.end(), [&](size_t x, size_t y) { return d[x] < d[y]; });
+
+        T largest = rho;
+        for (size_t i = 0; i < n; i++)
+        {
+            largest = std::max(largest, functions_implementation<T>::abs(d[i]));
+        }
+
+        const T tolerance = static_cast<T>(8) * eps * largest;
+
+        //deflation (kept and deflated columns of q in ascending order of d)
+        std::vector<size_t> kept;
+        std::vector<size_t> deflated;
+        kept.reserve(n);
+        deflated.reserve(n);
+
+        for (size_t i : order)
+        {
+            if (rho * functions_implementation<T>::abs(z[i]) <= tolerance)
+            {
+                deflated.push_back(i);
+                continue;
+            }
+
+            if (!kept.empty() && d[i] - d[kept.back()] <= tolerance)
+            {
+                //plane rotation of columns p and i zeroes z_p, p becomes eigenvector (eigenvalues differ less than tolerance)
+                const size_t p = kept.back();
+
+                const T r = symmetric_eigen_hypot(z[p], z[i]);
+                const T c = z[i] / r;
+                const T s = z[p] / r;
+
+                for (size_t row = 0; row < n; row++)
+                {
+                    T* q_row = q + row * ldq;
+                    const T q_p = q_row[p];
+                    const T q_i = q_row[i];
+                    q_row[p] = c * q_p - s * q_i;
+                    q_row[i] = s * q_p + c * q_i;
+                }
+
+                const T d_p = d[p];
+                d[p] = c * c * d_p + s * s * d[i];
+                d[i] = s * s * d_p + c * c * d[i];
+
+                z[i] = r;
+                z[p] = zero;
+
+                kept.back() = i;
+                deflated.push_back(p);
+                continue;
+            }
+
+            kept.push_back(i);
+        }
+
+        const size_t k = kept.size();
+
+        storage_vector<T> values(n);
+        storage_vector<T> result(n * n);
+
+        //result holds eigenvectors of merged matrix in order: secular ones, then deflated ones
+        if (k != 0)
+        {
+            storage_vector<T> d_kept(k);
+            storage_vector<T> z_kept(k);
+            storage_vector<T> u(k * k);
+            storage_vector<T> gathered(n * k);
+
+            for (size_t j = 0; j < k; j++)
+            {
+                d_kept[j] = d[kept[j]];
+                z_kept[j] = z[kept[j]];
+            }
+
+            tridiagonal_secular_solve(k, d_kept.data(), z_kept.data(), rho, values.data(), u.data(), parallel);
+
+            parallel_for(n, parallel && parallel_copy(n * k * sizeof(T)), [&](size_t row) {
+                const T* q_row = q + row * ldq;
+                T* gathered_row = gathered.data() + row * k;
+
+                for (size_t j = 0; j < k; j++)
+                {
+                    gathered_row[j] = q_row[kept[j]];
+                }
+            });
+
+            multiply_add(n, k, k, one, gathered.data(), k, static_cast<size_t>(1), u.data(), k, static_cast<size_t>(1), zero, result.data(), n, static_cast<size_t>(1), true);
+        }
+
+        for (size_t j = 0; j < deflated.size(); j++)
+        {
+            values[k + j] = d[deflated[j]];
+
+            for (size_t row = 0; row < n; row++)
+            {
+                result[row * n + k + j] = q[row * ldq + deflated[j]];
+            }
+        }
+
+        if (negated)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                values[i] = -values[i];
+            }
+        }
+
+        //eigenpairs in ascending order are written back to d and q
+        std::vector<size_t> sorted(n);
+        std::iota(sorted.begin(), sorted.end(), size_t(0));
+        std::stable_sort(sorted.begin(), sorted.end(), [&](size_t x, size_t y) { return values[x] < values[y]; });
+
+        for (size_t i = 0; i < n; i++)
+        {
+            d[i] = values[sorted[i]];
+        }
+
+        parallel_for(n, parallel && parallel_copy(n * n * sizeof(T)), [&](size_t row) {
+            const T* result_row = result.data() + row * n;
+            T* q_row = q + row * ldq;
+
+            for (size_t column = 0; column < n; column++)
+            {
+                q_row[column] = result_row[sorted[column]];
+            }
+        });
+    }
+
+    //tridiagonal matrices up to this size (and subproblems of divide and conquer) are solved by QL iterations
+    constexpr size_t tridiagonal_dc_min_size = 32;
+
+    ///<summary>
+    /// eigenvalues and eigenvectors of symmetric tridiagonal n x n matrix by divide and conquer (Cuppen, Gu and Eisenstat)
+    /// <para>matrix is recursively torn into halves by rank 1 modifications until they are small enough for QL iterations,
+    /// then pairs of halves are merged bottom up (see tridiagonal_merge), most of work is done by products of eigenvector matrices</para>
+    /// <para>d is diagonal (overwritten by ascending eigenvalues), e is off-diagonal (e must have n elements, it is destroyed),
+    /// eigenvectors are written to columns of n x n row-major q</para>
+    /// <para>if parallel is set, independent subproblems of every level of recursion are solved in parallel
+    /// (top merges, which are not independent, use parallel loops and matrix products)</para>
+    ///</summary>
+    template<class T>
+    void tridiagonal_divide_and_conquer(size_t n, T* d, T* e, T* q, size_t ldq, bool parallel)
+    {
+        struct node
+        {
+            size_t begin;
+            size_t middle;
+            size_t end;
+            size_t depth;
+            T rho;
+        };
+
+        std::vector<node> nodes;
+        std::vector<std::pair<size_t, size_t>> leaves;
+        size_t max_depth = 0;
+
+        //tearing: T = diag(T1, T2) + rho * u * u^T with u having ones at positions middle - 1 and middle
+        auto tear = [&](auto& self, size_t begin, size_t end, size_t depth) -> void {
+            if (end - begin <= tridiagonal_dc_min_size)
+            {
+                leaves.emplace_back(begin, end);
+                return;
+            }
+
+            const size_t middle = begin + (end - begin) / 2;
+            const T rho = e[middle - 1];
+
+            d[middle - 1] -= rho;
+            d[middle] -= rho;
+
+            nodes.push_back(node{ begin, middle, end, depth, rho });
+            max_depth = std::max(max_depth, depth);
+
+            self(self, begin, middle, depth + 1);
+            self(self, middle, end, depth + 1);
+        };
+
+        tear(tear, 0, n, 0);
+
+        for (size_t row = 0; row < n; row++)
+        {
+            std::fill(q + row * ldq, q + row * ldq + n, get_additive_identity<T>());
+        }
+
+        parallel_for(leaves.size(), parallel, [&](size_t leaf) {
+            const size_t begin = leaves[leaf].first;
+            const size_t size = leaves[leaf].second - begin;
+            T* q_leaf = q + begin * ldq + begin;
+
+            for (size_t diagonal = 0; diagonal < size; diagonal++)
+            {
+                q_leaf[diagonal * ldq + diagonal] = get_multiplicative_identity<T>();
+            }
+
+            tridiagonal_ql(size, d + begin, e + begin, q_leaf, ldq);
+        });
+
+        for (size_t depth = max_depth + 1; depth-- > 0;)
+        {
+            std::vector<const node*> level;
+            for (const node& merged : nodes)
+            {
+                if (merged.depth == depth)
+                {
+                    level.push_back(&merged);
+                }
+            }
+
+            parallel_for(level.size(), parallel, [&](size_t index) {
+                const node& merged = *level[index];
+                tridiagonal_merge(merged.end - merged.begin, merged.middle - merged.begin, merged.rho, d + merged.begin, q + merged.begin * ldq + merged.begin, ldq, parallel);
+            });
+        }
+    }
+
+    ///<summary>
+    /// eigenvalues (in ascending order) and, if vectors is given, eigenvectors (columns of n x n row-major matrix)
+    /// of symmetric n x n row-major matrix (only lower triangle is read, matrix is destroyed)
+    /// <para>matrices up to 3x3 are diagonalized by jacobi rotations (also if only eigenvalues are needed: trigonometric formula for roots
+    /// of characteristic polynomial loses about half of digits of close eigenvalues, so eigenvalues would depend on whether eigenvectors are computed),
+    /// bigger ones are tridiagonalized and solved by QL iterations (eigenvalues only) or divide and conquer</para>
+    ///</summary>
+    /// <param name="parallel"> whether steps expensive enough to go parallel (see parallel_thresholds) may be split over threads </param>
+    template<class T>
+    void symmetric_eigen_solve(size_t n, T* a, size_t lda, T* values, T* vectors, size_t ldv, bool parallel = false)
+    {
+        for (size_t row = 0; row < n; row++)
+        {
+            for (size_t column = 0; column < row; column++)
+            {
+                a[column * lda + row] = a[row * lda + column];
+            }
+        }
+
+        if (n <= symmetric_eigen_jacobi_max_size)
+        {
+            symmetric_eigen_jacobi(n, a, lda, values, vectors, ldv);
+            return;
+        }
+
+        storage_vector<T> e(n);
+        storage_vector<T> tau(n);
+
+        symmetric_tridiagonalize(n, a, lda, values, e.data(), tau.data(), parallel);
+
+        if (!vectors)
+        {
+            tridiagonal_ql(n, values, e.data(), static_cast<T*>(nullptr), n);
+            return;
+        }
+
+        tridiagonal_divide_and_conquer(n, values, e.data(), vectors, ldv, parallel);
+        symmetric_tridiagonal_back_transform(n, a, lda, tau.data(), vectors, ldv, n, parallel);
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
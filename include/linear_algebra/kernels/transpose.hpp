@@ -0,0 +1,195 @@
+#pragma once
+
+#include "../simd/simd.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //blocks smaller than this are transposed by regular loops (call through kernel table is not worth it)
+    constexpr size_t transpose_kernel_min_size = 4;
+
+    ///<summary>
+    /// out = transpose of rows x columns block of row-major a (out is columns x rows with row stride ldo)
+    /// <para>single and double precision numbers are transposed in registers, out must not overlap with a</para>
+    ///</summary>
+    template<class T>
+    inline void transpose_block(size_t rows, size_t columns, const T* a, size_t lda, T* out, size_t ldo)
+    {
+        if constexpr (has_simd_kernels_v<T>)
+        {
+            if (rows >= transpose_kernel_min_size && columns >= transpose_kernel_min_size)
+            {
+                get_simd_kernels<T>().transpose(rows, columns, a, lda, out, ldo);
+                return;
+            }
+        }
+
+        for (size_t i = 0; i < rows; i++)
+        {
+            for (size_t j = 0; j < columns; j++)
+            {
+                out[j * ldo + i] = a[i * lda + j];
+            }
+        }
+    }
+
+    //blocks with at most this many rows and columns are transposed directly (block and its transposition fit in l1 cache)
+    constexpr size_t transpose_leaf_size = 32;
+
+    //out = transpose of rows x columns block of a, larger dimension is halved until block is small enough
+    //(cache oblivious: at some level of recursion block fits in every level of cache, whatever its size is)
+    template<class T>
+    inline void transpose_recursive(size_t rows, size_t columns, const T* a, size_t lda, T* out, size_t ldo)
+    {
+        if (rows <= transpose_leaf_size && columns <= transpose_leaf_size)
+        {
+            transpose_block(rows, columns, a, lda, out, ldo);
+        }
+        else if (rows >= columns)
+        {
+            const size_t half = rows / 2;
+            transpose_recursive(half, columns, a, lda, out, ldo);
+            transpose_recursive(rows - half, columns, a + half * lda, lda, out + half, ldo);
+        }
+        else
+        {
+            const size_t half = columns / 2;
+            transpose_recursive(rows, half, a, lda, out, ldo);
+            transpose_recursive(rows, columns - half, a + half, lda, out + half * ldo, ldo);
+        }
+    }
+
+    ///<summary>
+    /// out = transpose of rows x columns row-major matrix a (out is columns x rows with row stride ldo)
+    /// <para>matrix is split into panels of rows which are transposed recursively, panels are transposed in parallel if parallel is set</para>
+    /// <para>out must not overlap with a</para>
+    ///</summary>
+    template<class T>
+    inline void transpose_matrix(size_t rows, size_t columns, const T* a, size_t lda, T* out, size_t ldo, bool parallel)
+    {
+        const size_t panels = (rows + transpose_leaf_size - 1) / transpose_leaf_size;
+
+        auto transpose_panel = [&](size_t panel)
+        {
+            const size_t row = panel * transpose_leaf_size;
+            transpose_recursive(std::min(transpose_leaf_size, rows - row), columns, a + row * lda, lda, out + row, ldo);
+        };
+
+        if (parallel)
+        {
+            parallel_for(panels, true, transpose_panel);
+        }
+        else
+        {
+            transpose_recursive(rows, columns, a, lda, out, ldo);
+        }
+    }
+
+    //a = transpose of b and b = transpose of a (a is rows x columns, b is columns x rows, blocks must not overlap)
+    //blocks are exchanged through stack buffer of single leaf, so nothing is allocated
+    template<class T>
+    inline void swap_transposed_blocks(size_t rows, size_t columns, T* a, size_t lda, T* b, size_t ldb)
+    {
+        T buffer[transpose_leaf_size * transpose_leaf_size];
+
+        for (size_t i = 0; i < rows; i += transpose_leaf_size)
+        {
+            for (size_t j = 0; j < columns; j += transpose_leaf_size)
+            {
+                const size_t leaf_rows = std::min(transpose_leaf_size, rows - i);
+                const size_t leaf_columns = std::min(transpose_leaf_size, columns - j);
+
+                T* a_leaf = a + i * lda + j;
+                T* b_leaf = b + j * ldb + i;
+
+                transpose_block(leaf_rows, leaf_columns, a_leaf, lda, buffer, transpose_leaf_size);
+                transpose_block(leaf_columns, leaf_rows, b_leaf, ldb, a_leaf, lda);
+
+                for (size_t row = 0; row < leaf_columns; row++)
+                {
+                    std::copy(buffer + row * transpose_leaf_size, buffer + row * transpose_leaf_size + leaf_rows, b_leaf + row * ldb);
+                }
+            }
+        }
+    }
+
+    //transposes n x n block of a in place by swapping elements symmetric to diagonal
+    template<class T>
+    inline void transpose_diagonal_block(size_t n, T* a, size_t lda)
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            for (size_t j = i + 1; j < n; j++)
+            {
+                std::swap(a[i * lda + j], a[j * lda + i]);
+            }
+        }
+    }
+
+    ///<summary>
+    /// transposes n x n row-major matrix a in place (nothing is allocated)
+    /// <para>leaves above diagonal are exchanged with their transposed mirrors below diagonal, leaves on diagonal are transposed in place</para>
+    /// <para>rows of leaves are processed in parallel if parallel is set</para>
+    ///</summary>
+    template<class T>
+    inline void transpose_in_place(size_t n, T* a, size_t lda, bool parallel)
+    {
+        const size_t leaves = (n + transpose_leaf_size - 1) / transpose_leaf_size;
+
+        auto transpose_leaf_row = [&](size_t leaf_row)
+        {
+            const size_t i = leaf_row * transpose_leaf_size;
+            const size_t rows = std::min(transpose_leaf_size, n - i);
+
+            transpose_diagonal_block(rows, a + i * lda + i, lda);
+
+            for (size_t j = i + transpose_leaf_size; j < n; j += transpose_leaf_size)
+            {
+                swap_transposed_blocks(rows, std::min(transpose_leaf_size, n - j), a + i * lda + j, lda, a + j * lda + i, lda);
+            }
+        };
+
+        //rows of leaves near top hold more leaves above diagonal, threads which finish short rows steal remaining ones
+        parallel_for(leaves, parallel, transpose_leaf_row);
+    }
+
+    //out = transpose of matrix stored in row_tiles x column_tiles tiles of S x S elements (see tiled layout)
+    //tile (i, j) of a becomes transposed tile (j, i) of out, tile rows are processed in parallel if parallel is set
+    template<size_t S, class T>
+    inline void transpose_tiles(size_t row_tiles, size_t column_tiles, const T* a, T* out, bool parallel)
+    {
+        constexpr size_t tile_elements = S * S;
+
+        auto transpose_tile_row = [&](size_t i)
+        {
+            for (size_t j = 0; j < column_tiles; j++)
+            {
+                transpose_block(S, S, a + (i * column_tiles + j) * tile_elements, S, out + (j * row_tiles + i) * tile_elements, S);
+            }
+        };
+
+        parallel_for(row_tiles, parallel, transpose_tile_row);
+    }
+
+    //transposes matrix stored in tiles x tiles tiles of S x S elements in place
+    template<size_t S, class T>
+    inline void transpose_tiles_in_place(size_t tiles, T* a, bool parallel)
+    {
+        constexpr size_t tile_elements = S * S;
+
+        auto transpose_tile_row = [&](size_t i)
+        {
+            transpose_in_place(S, a + (i * tiles + i) * tile_elements, S, false);
+
+            for (size_t j = i + 1; j < tiles; j++)
+            {
+                swap_transposed_blocks(S, S, a + (i * tiles + j) * tile_elements, S, a + (j * tiles + i) * tile_elements, S);
+            }
+        };
+
+        parallel_for(tiles, parallel, transpose_tile_row);
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
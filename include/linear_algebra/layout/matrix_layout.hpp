@@ -0,0 +1,170 @@
+#pragma once
+
+#include "../linear_algebra_common.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+//layouts of matrix storage (last template argument of matrix)
+//every layout maps element (row, column) of rows x columns matrix to offset in its storage
+
+///<summary>
+/// elements are stored row by row (i.e row|row|row|...|row), default layout of matrix
+///</summary>
+struct row_major
+{
+    //element (row, column) is placed at row * row_stride + column * column_stride
+    static constexpr bool is_strided = true;
+
+    static constexpr size_t storage_size(size_t rows, size_t columns)
+    {
+        return rows * columns;
+    }
+
+    static constexpr size_t row_stride(size_t, size_t columns)
+    {
+        return columns;
+    }
+
+    static constexpr size_t column_stride(size_t, size_t)
+    {
+        return 1;
+    }
+
+    static constexpr size_t offset(size_t row, size_t column, size_t, size_t columns)
+    {
+        return row * columns + column;
+    }
+
+    //number of leading storage elements in which rows x columns and other_rows x other_columns matrices
+    //hold the same elements of their common block (0 if common block is not a prefix of both storages)
+    static constexpr size_t common_storage_size(size_t rows, size_t columns, size_t other_rows, size_t other_columns)
+    {
+        return columns == other_columns ? std::min(rows, other_rows) * columns : 0;
+    }
+};
+
+///<summary>
+/// elements are stored column by column (i.e column|column|...|column), as in Fortran, BLAS and LAPACK buffers
+/// <para>storage of column-major matrix is the same as storage of its row-major transposition</para>
+///</summary>
+struct column_major
+{
+    static constexpr bool is_strided = true;
+
+    static constexpr size_t storage_size(size_t rows, size_t columns)
+    {
+        return rows * columns;
+    }
+
+    static constexpr size_t row_stride(size_t, size_t)
+    {
+        return 1;
+    }
+
+    static constexpr size_t column_stride(size_t rows, size_t)
+    {
+        return rows;
+    }
+
+    static constexpr size_t offset(size_t row, size_t column, size_t rows, size_t)
+    {
+        return column * rows + row;
+    }
+
+    static constexpr size_t common_storage_size(size_t rows, size_t columns, size_t other_rows, size_t other_columns)
+    {
+        return rows == other_rows ? std::min(columns, other_columns) * rows : 0;
+    }
+};
+
+//size of tiles of tiled layout (32 x 32 tile of doubles occupies 8KB, so tiles of three operands of multiplication fit in l1 cache)
+constexpr size_t default_tile_size = 32;
+
+///<summary>
+/// elements are stored in square tiles of B x B elements, tiles are stored row by row and elements of every tile are stored row by row
+/// <para>neighbouring elements in both directions are close in memory, so row and column access and multiplication of big matrices
+/// (which is done tile by tile) are cache friendly</para>
+/// <para>edges of matrices with dimensions which are not multiples of B are padded with 0-oes (whole tiles are stored)</para>
+///</summary>
+template<size_t B = default_tile_size>
+struct tiled
+{
+    static_assert(B != 0, "Tile size must be at least 1!");
+
+    static constexpr bool is_strided = false;
+    static constexpr size_t tile_size = B;
+
+    static constexpr size_t tiles(size_t elements)
+    {
+        return (elements + B - 1) / B;
+    }
+
+    static constexpr size_t storage_size(size_t rows, size_t columns)
+    {
+        return tiles(rows) * tiles(columns) * B * B;
+    }
+
+    static constexpr size_t offset(size_t row, size_t column, size_t rows, size_t columns)
+    {
+        return ((row / B) * tiles(columns) + column / B) * B * B + (row % B) * B + column % B;
+    }
+
+    static constexpr size_t common_storage_size(size_t rows, size_t columns, size_t other_rows, size_t other_columns)
+    {
+        return rows == other_rows && columns == other_columns ? storage_size(rows, columns) : 0;
+    }
+};
+
+namespace detail
+{
+    template<class L>
+    struct is_tiled_layout : std::false_type {};
+
+    template<size_t B>
+    struct is_tiled_layout<tiled<B>> : std::true_type {};
+
+    template<class L>
+    constexpr bool is_tiled_layout_v = is_tiled_layout<L>::value;
+
+    ///<summary>
+    /// row of matrix with layout other than row-major (row[column] is element (row, column))
+    /// <para>returned by operator[] of such matrices instead of pointer to row, so matrix[row][column] works for every layout</para>
+    ///</summary>
+    template<class T, class L, size_t N, size_t M>
+    class layout_row
+    {
+    private:
+        T* _data;
+        size_t _row;
+    public:
+        layout_row(T* data, size_t row) :
+            _data(data),
+            _row(row)
+        {
+        }
+
+        T& operator[](size_t column) const
+        {
+            return _data[L::offset(_row, column, N, M)];
+        }
+    };
+
+    //rows of row-major matrices are pointers to their first elements
+    template<class T, class L, size_t N, size_t M>
+    using layout_row_t = std::conditional_t<std::is_same_v<L, row_major>, T*, layout_row<T, L, N, M>>;
+
+    template<class T, class L, size_t N, size_t M>
+    inline layout_row_t<T, L, N, M> make_layout_row(T* data, size_t row)
+    {
+        if constexpr (std::is_same_v<L, row_major>)
+        {
+            return data + row * M;
+        }
+        else
+        {
+            return layout_row<T, L, N, M>(data, row);
+        }
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -1,7 +1,56 @@
 #pragma once
 
+#include "parallel/executor.hpp"
+#include "parallel/work_stealing_executor.hpp"
+#include "parallel/parallel_thresholds.hpp"
+#include "parallel/parallel_for.hpp"
+#include "parallel/parallel_tuning.hpp"
+#include "memory/storage_allocator.hpp"
+#include "memory/scratch_arena.hpp"
+#include "layout/matrix_layout.hpp"
 #include "vector/vector.hpp"
 #include "vector/vector.inl"
+#include "expressions/vector_expression.hpp"
+#include "expressions/vector_expression.inl"
 #include "matrix/matrix.hpp"
 #include "matrix/matrix.inl"
-#include "equation_system/equation_system.hpp"
\ No newline at end of file
+#include "expressions/matrix_expression.hpp"
+#include "expressions/matrix_expression.inl"
+#include "expressions/matrix_product_expression.hpp"
+#include "expressions/matrix_product_expression.inl"
+#include "decompositions/lu_decomposition.hpp"
+#include "decompositions/lu_decomposition.inl"
+#include "decompositions/cholesky_decomposition.hpp"
+#include "decompositions/cholesky_decomposition.inl"
+#include "decompositions/ldlt_decomposition.hpp"
+#include "decompositions/ldlt_decomposition.inl"
+#include "decompositions/qr_decomposition.hpp"
+#include "decompositions/qr_decomposition.inl"
+#include "decompositions/symmetric_eigen.hpp"
+#include "decompositions/symmetric_eigen.inl"
+#include "decompositions/singular_value_decomposition.hpp"
+#include "decompositions/singular_value_decomposition.inl"
+#include "dynamic_vector/dynamic_vector.hpp"
+#include "dynamic_vector/dynamic_vector.inl"
+#include "dynamic_matrix/dynamic_matrix.hpp"
+#include "dynamic_matrix/dynamic_matrix.inl"
+#include "decompositions/dynamic_lu_decomposition.hpp"
+#include "decompositions/dynamic_lu_decomposition.inl"
+#include "sparse_matrix/sparse_matrix.hpp"
+#include "sparse_matrix/sparse_matrix.inl"
+#include "sparse_matrix/sparse_matrix_builder.hpp"
+#include "sparse_matrix/sparse_matrix_builder.inl"
+#include "views/vector_view.hpp"
+#include "views/vector_view.inl"
+#include "views/matrix_view.hpp"
+#include "views/matrix_view.inl"
+#include "batch/batch_span.hpp"
+#include "batch/batch_operations.hpp"
+#include "batch/batch_operations.inl"
+#include "vector_soa/vector_soa.hpp"
+#include "vector_soa/vector_soa.inl"
+#include "equation_system/equation_system.hpp"
+#include "equation_system/least_squares.hpp"
+#include "equation_system/preconditioners.hpp"
+#include "equation_system/preconditioners.inl"
+#include "equation_system/iterative_solvers.hpp"
\ No newline at end of file
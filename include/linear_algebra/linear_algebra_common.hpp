@@ -11,6 +11,7 @@
 #include <array>
 #include <tuple>
 #include <cmath>
+#include <cassert>
 
 #define LINEAR_ALGEBRA linear_algebra
 #define NAMESPACE_LINEAR_ALGEBRA_BEGIN namespace LINEAR_ALGEBRA{
@@ -23,21 +24,94 @@
 NAMESPACE_LINEAR_ALGEBRA_BEGIN
 
 //redeclaration of defined constants
-constexpr bool use_openmp = USE_OPENMP;
+constexpr bool use_threads = USE_THREADS;
 
 //constant used to determine type of storage based on size of vector/matrix data
+//(whether operations go parallel is decided at runtime by cost models, see parallel/parallel_thresholds.hpp)
 constexpr size_t static_storage_max_size = sizeof(double)*10000;
 
+//default layout of matrix storage (see layout/matrix_layout.hpp)
+struct row_major;
+
+namespace detail
+{
+    //element-wise operations on big matrices (vectors) of equal dimensions are evaluated lazily by expression templates,
+    //operations on small ones return results immediately
+    //expressions index row-major storage, so operations on matrices with other layouts always return results immediately
+    template<class T, size_t N, size_t M, size_t NO, size_t MO, class L = row_major>
+    constexpr bool use_matrix_expression_v = std::is_same_v<L, row_major> && N == NO && M == MO && N * M * sizeof(T) >= static_storage_max_size;
+
+    template<class T, size_t D, size_t DO>
+    constexpr bool use_vector_expression_v = D == DO && D * sizeof(T) >= static_storage_max_size;
+}
+
 //type declaration
 template<class T, size_t D>
 class vector;
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L = row_major>
 class matrix;
 
 template<class... MS>
 class matrix_multiplication_proxy;
 
+template<class T, size_t D, class E>
+class vector_expression;
+
+template<class T, size_t N, size_t M, class E>
+class matrix_expression;
+
+template<class P, class E>
+class matrix_product_expression;
+
+template<class T, size_t N>
+class lu_decomposition;
+
+template<class T, size_t N>
+class cholesky_decomposition;
+
+template<class T, size_t N>
+class ldlt_decomposition;
+
+template<class T, size_t N, size_t M>
+class qr_decomposition;
+
+template<class T, size_t N>
+class symmetric_eigen;
+
+template<class T, size_t N, size_t M>
+class singular_value_decomposition;
+
+template<class T>
+class dynamic_vector;
+
+template<class T>
+class dynamic_matrix;
+
+template<class T>
+class dynamic_lu_decomposition;
+
+template<class T, class L = row_major>
+class sparse_matrix;
+
+template<class T>
+class sparse_matrix_builder;
+
+template<class T>
+class vector_view;
+
+template<class T>
+class matrix_view;
+
+template<class T>
+class batch_span;
+
+template<class T, size_t D>
+class vector_soa;
+
+template<class T, size_t D>
+class vector_soa_reference;
+
 enum class equation_system_type
 {
     determinate,
@@ -48,4 +122,22 @@ enum class equation_system_type
 template<class T, size_t M>
 class equation_system_solution;
 
+template<class T>
+class identity_preconditioner;
+
+template<class T>
+class jacobi_preconditioner;
+
+template<class T>
+class ilu0_preconditioner;
+
+template<class T>
+class ic0_preconditioner;
+
+template<class T>
+struct iterative_solver_settings;
+
+template<class T>
+struct iterative_solver_result;
+
 NAMESPACE_LINEAR_ALGEBRA_END
\ No newline at end of file
@@ -76,7 +76,7 @@ template<class T>
 constexpr bool has_sqrt_implementation_v = std::is_same_v<decltype(functions_implementation<T>::sqrt(std::declval<T>())), T>;
 
 template<class T>
-constexpr bool has_abs_implementation_v = std::is_same_v<decltype(functions_implementation<T>::sqrt(std::declval<T>())), T>;
+constexpr bool has_abs_implementation_v = std::is_same_v<decltype(functions_implementation<T>::abs(std::declval<T>())), T>;
 
 template<class T>
 constexpr bool has_epsilon_implementation_v = std::is_same_v<decltype(functions_implementation<T>::epsilon()), T>;
@@ -1,13 +1,15 @@
 #pragma once
 
 #include "../linear_algebra_common_functions.hpp"
+#include "../memory/storage_allocator.hpp"
+#include "../layout/matrix_layout.hpp"
 
 NAMESPACE_LINEAR_ALGEBRA_BEGIN
 
 NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
 
-template<class TO, size_t NO, size_t MO>
-std::ostream& operator<<(std::ostream& os, const matrix<TO, NO, MO>& m);
+template<class TO, size_t NO, size_t MO, class LO>
+std::ostream& operator<<(std::ostream& os, const matrix<TO, NO, MO, LO>& m);
 
 NAMESPACE_LINEAR_ALGEBRA_IO_END
 
@@ -17,8 +19,8 @@ class matrix_multiplication_proxy
 	template<class TS>
 	struct is_matrix_specialization : std::false_type {};
 
-	template<class T, size_t N, size_t M>
-	struct is_matrix_specialization<matrix<T, N, M>> : std::true_type {};
+	template<class T, size_t N, size_t M, class L>
+	struct is_matrix_specialization<matrix<T, N, M, L>> : std::true_type {};
 
 	template<class TS>
 	static constexpr bool is_matrix_specialization_v = is_matrix_specialization<TS>::value;
@@ -30,8 +32,10 @@ class matrix_multiplication_proxy
 
     template<class... MSO>
     friend class matrix_multiplication_proxy;
-    template<class T, size_t N, size_t M>
+    template<class T, size_t N, size_t M, class L>
     friend class matrix;
+    template<class P, class E>
+    friend class matrix_product_expression;
 private:
     template<class... TS>
     struct matrix_multiplication_result_mathematical_field_type {};
@@ -51,13 +55,36 @@ public:
     static constexpr size_t result_rows = std::tuple_element_t<0, std::tuple<MS...>>::rows;
     static constexpr size_t result_columns = std::tuple_element_t<sizeof...(MS) - 1, std::tuple<MS...>>::columns;
     using result_mathematical_field_type = typename matrix_multiplication_result_mathematical_field_type<typename MS::mathematical_field_type...>::type;
+
+    //same names as in matrix and matrix_expression
+    static constexpr size_t rows = result_rows;
+    static constexpr size_t columns = result_columns;
+    using mathematical_field_type = result_mathematical_field_type;
 private:
     std::tuple<const MS&...> _matrices;
+    //scalar factor of whole product (alpha in alpha * A * B), it is applied by final multiplication of chain
+    result_mathematical_field_type _scale = get_multiplicative_identity<result_mathematical_field_type>();
 
     matrix_multiplication_proxy(std::tuple<const MS&...> matrices) :
         _matrices(matrices)
     {
     }
+
+    matrix_multiplication_proxy(std::tuple<const MS&...> matrices, const result_mathematical_field_type& scale) :
+        _matrices(matrices),
+        _scale(scale)
+    {
+    }
+
+    //checks if given matrix is one of factors of product
+    template<class T, class L>
+    bool is_factor(const matrix<T, result_rows, result_columns, L>& m) const;
+
+    //result = scale * product + beta * result
+    //final multiplication of chain writes directly to result (if beta is not 0 it accumulates into it)
+    //factors and result may have different layouts (strided layouts are passed to GEMM by their strides)
+    template<class T, class L>
+    void multiply_add(matrix<T, result_rows, result_columns, L>& result, const result_mathematical_field_type& beta) const;
 public:
     matrix_multiplication_proxy() = delete;
     template<class... MOS>
@@ -72,11 +99,18 @@ public:
 public:
     template<class... MSO, typename = typename std::enable_if_t<result_columns == matrix_multiplication_proxy<MSO...>::result_rows && can_calculate_inner_product_v<result_mathematical_field_type, typename matrix_multiplication_proxy<MSO...>::result_mathematical_field_type>>>
     matrix_multiplication_proxy<MS..., MSO...> operator*(const matrix_multiplication_proxy<MSO...>& other) const;
-    template<class TO, size_t P, typename = typename std::enable_if_t<can_calculate_inner_product_v<TO, result_mathematical_field_type>>>
-    matrix_multiplication_proxy<MS..., matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, P>> operator*(const matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, P>& other) const;
+    template<class TO, size_t P, class LO, typename = typename std::enable_if_t<can_calculate_inner_product_v<TO, result_mathematical_field_type>>>
+    matrix_multiplication_proxy<MS..., matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, P, LO>> operator*(const matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, P, LO>& other) const;
 
     template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<TO, result_mathematical_field_type>>>
     vector<inner_product_result_t<typename matrix_multiplication_proxy<MS...>::result_mathematical_field_type, TO>, matrix_multiplication_proxy<MS...>::result_rows> operator*(const vector<TO, matrix_multiplication_proxy<MS...>::result_columns>& other) const;
+
+    //scalar factors are absorbed by proxy, they do not require additional pass over result
+
+    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<result_mathematical_field_type, TO> && std::is_convertible_v<TO, result_mathematical_field_type>>>
+    matrix_multiplication_proxy<MS...> operator*(const TO& v) const;
+
+    matrix_multiplication_proxy<MS...> operator-() const;
 public:
     matrix<typename matrix_multiplication_proxy<MS...>::result_mathematical_field_type, matrix_multiplication_proxy<MS...>::result_rows, matrix_multiplication_proxy<MS...>::result_columns> operator()() const;
     matrix<typename matrix_multiplication_proxy<MS...>::result_mathematical_field_type, matrix_multiplication_proxy<MS...>::result_rows, matrix_multiplication_proxy<MS...>::result_columns> operator*() const;
@@ -85,43 +119,57 @@ public:
 template<>
 class matrix_multiplication_proxy<> {};
 
-template<class T, size_t N, size_t M>
+///<summary>
+/// NxM matrix with elements stored in given layout (row_major, column_major or tiled<B>, see layout/matrix_layout.hpp)
+/// <para>element-wise operators take matrices with the same layout, matrices with different layouts are converted by constructors,
+/// products accept factors with any layouts</para>
+///</summary>
+template<class T, size_t N, size_t M, class L>
 class matrix
 {
     static_assert(N != 0 && M != 0, "Matrix dimensions must be at least 1!");
     static_assert(is_valid_mathematical_field_v<T>, "Matrix element type must satisfy valid_mathematical_field concept!");
 
-    template<class TO, size_t NO, size_t MO>
+    template<class TO, size_t NO, size_t MO, class LO>
     friend class matrix;
     template<class TO, size_t D>
     friend class vector;
 public:
-	static constexpr bool is_big_matrix = N * M * sizeof(T) >= static_storage_max_size;
+    //number of elements in storage (bigger than N * M for padded layouts)
+    static constexpr size_t storage_size = L::storage_size(N, M);
+
+	static constexpr bool is_big_matrix = storage_size * sizeof(T) >= static_storage_max_size;
+
+    //matrix[row] is pointer to row for row-major layout, for other layouts it is an object with operator[] (see layout_row)
+    using row_type = detail::layout_row_t<T, L, N, M>;
+    using const_row_type = detail::layout_row_t<const T, L, N, M>;
 private:
     class matrix_storage_static
     {
     private:
-        T _mat[N][M];
+        T _mat[storage_size];
     public:
-        inline T* operator[](size_t row);
-        inline const T* operator[](size_t row) const;
+        inline row_type operator[](size_t row);
+        inline const_row_type operator[](size_t row) const;
         
         inline T* data();
         inline const T* data() const;
     };
 
+    //memory is taken from storage_allocator (aligned to storage_alignment bytes, resource can be replaced by set_storage_resource)
     class matrix_storage_dynamic
     {
     private:
+        storage_allocator<T> _allocator;
         T* _mat = nullptr;
     public:
         inline matrix_storage_dynamic();
-        inline matrix_storage_dynamic(matrix<T,N,M>::matrix_storage_dynamic&& other) noexcept;
+        inline matrix_storage_dynamic(matrix<T, N, M, L>::matrix_storage_dynamic&& other) noexcept;
         inline matrix_storage_dynamic& operator=(matrix_storage_dynamic&& other) noexcept;
         inline ~matrix_storage_dynamic();
     public:
-        inline T* operator[](size_t row);
-        inline const T* operator[](size_t row) const;
+        inline row_type operator[](size_t row);
+        inline const_row_type operator[](size_t row) const;
         
         inline T* data();
         inline const T* data() const;
@@ -132,6 +180,7 @@ private:
 	storage_type _mat{};
 public:
     using mathematical_field_type = T;
+    using layout_type = L;
 
     static constexpr size_t rows = N;
     static constexpr size_t columns = M;
@@ -144,41 +193,41 @@ public:
 
     //same type, same dimensions
 
-    matrix(const matrix<T, N, M>& other);
+    matrix(const matrix<T, N, M, L>& other);
 
-    matrix(matrix<T, N, M>&& other);
+    matrix(matrix<T, N, M, L>&& other);
 
-    matrix<T, N, M>& operator=(const matrix<T, N, M>& other);
+    matrix<T, N, M, L>& operator=(const matrix<T, N, M, L>& other);
 
-    matrix<T, N, M>& operator=(matrix<T, N, M>&& other);
+    matrix<T, N, M, L>& operator=(matrix<T, N, M, L>&& other);
 
     //different type, same dimension
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix(const matrix<TO, N, M>& other);
+    matrix(const matrix<TO, N, M, L>& other);
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix(matrix<TO, N, M>&& other);
+    matrix(matrix<TO, N, M, L>&& other);
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator=(const matrix<TO, N, M>& other);
+    matrix<T, N, M, L>& operator=(const matrix<TO, N, M, L>& other);
     
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator=(matrix<TO, N, M>&& other);
+    matrix<T, N, M, L>& operator=(matrix<TO, N, M, L>&& other);
 
-    //different type, different dimensions
+    //different type, different dimensions or different layout (elements are copied to their places in layout of this matrix)
 
-    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix(const matrix<TO, NO, MO>& other);
+    template<class TO, size_t NO, size_t MO, class LO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    matrix(const matrix<TO, NO, MO, LO>& other);
 
-    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix(matrix<TO, NO, MO>&& other);
+    template<class TO, size_t NO, size_t MO, class LO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    matrix(matrix<TO, NO, MO, LO>&& other);
 
-    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator=(const matrix<TO, NO, MO>& other);
+    template<class TO, size_t NO, size_t MO, class LO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    matrix<T, N, M, L>& operator=(const matrix<TO, NO, MO, LO>& other);
 
-    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator=(matrix<TO, NO, MO>&& other);
+    template<class TO, size_t NO, size_t MO, class LO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    matrix<T, N, M, L>& operator=(matrix<TO, NO, MO, LO>&& other);
 
     //regular constructors
 
@@ -207,20 +256,20 @@ public:
     //regular operators
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator=(const TO& v);
+    matrix<T, N, M, L>& operator=(const TO& v);
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator=(TO&& v);
+    matrix<T, N, M, L>& operator=(TO&& v);
     
-    matrix<T, N, M>& operator=(std::initializer_list<T> vs);
+    matrix<T, N, M, L>& operator=(std::initializer_list<T> vs);
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator=(std::initializer_list<TO> vs);
+    matrix<T, N, M, L>& operator=(std::initializer_list<TO> vs);
 
-    matrix<T, N, M>& operator=(std::initializer_list<std::initializer_list<T>> vs);
+    matrix<T, N, M, L>& operator=(std::initializer_list<std::initializer_list<T>> vs);
     
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator=(std::initializer_list<std::initializer_list<TO>> vs);
+    matrix<T, N, M, L>& operator=(std::initializer_list<std::initializer_list<TO>> vs);
 
     //from proxy
     template<class... MOS, typename = typename std::enable_if_t<std::is_convertible_v<typename matrix_multiplication_proxy<MOS...>::result_mathematical_field_type, T>>>
@@ -229,48 +278,79 @@ public:
     matrix(matrix_multiplication_proxy<MOS...>&& proxy);
 
     template<class... MOS, typename = typename std::enable_if_t<std::is_convertible_v<typename matrix_multiplication_proxy<MOS...>::result_mathematical_field_type, T>>>
-    matrix<T, N, M>& operator=(const matrix_multiplication_proxy<MOS...>& proxy);
+    matrix<T, N, M, L>& operator=(const matrix_multiplication_proxy<MOS...>& proxy);
     template<class... MOS, typename = typename std::enable_if_t<std::is_convertible_v<typename matrix_multiplication_proxy<MOS...>::result_mathematical_field_type, T>>>
-    matrix<T, N, M>& operator=(matrix_multiplication_proxy<MOS...>&& proxy);
+    matrix<T, N, M, L>& operator=(matrix_multiplication_proxy<MOS...>&& proxy);
+
+    //from element-wise expression (expression is evaluated in single pass)
+    template<class TO, class E, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    matrix(const matrix_expression<TO, N, M, E>& expression);
+
+    template<class TO, class E, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    matrix<T, N, M, L>& operator=(const matrix_expression<TO, N, M, E>& expression);
+
+    //from product with added matrix or expression (e.g alpha * A * B + beta * C)
+    template<class P, class E, typename = typename std::enable_if_t<P::rows == N && P::columns == M && std::is_convertible_v<typename matrix_product_expression<P, E>::mathematical_field_type, T>>>
+    matrix(const matrix_product_expression<P, E>& expression);
+
+    template<class P, class E, typename = typename std::enable_if_t<P::rows == N && P::columns == M && std::is_convertible_v<typename matrix_product_expression<P, E>::mathematical_field_type, T>>>
+    matrix<T, N, M, L>& operator=(const matrix_product_expression<P, E>& expression);
 public:
     //matrix-matrix operators
 
-    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<can_be_added_v<T, TO>>>
-    matrix<addition_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>> operator+(const matrix<TO, NO, MO>& other) const;
+    //element-wise operators of big row-major matrices with equal dimensions return matrix_expression (see expressions/matrix_expression.inl)
+
+    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<can_be_added_v<T, TO> && !detail::use_matrix_expression_v<T, N, M, NO, MO, L>>>
+    matrix<addition_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>, L> operator+(const matrix<TO, NO, MO, L>& other) const;
     
-    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<can_be_subtracted_v<T, TO>>>
-    matrix<subtraction_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>> operator-(const matrix<TO, NO, MO>& other) const;
+    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<can_be_subtracted_v<T, TO> && !detail::use_matrix_expression_v<T, N, M, NO, MO, L>>>
+    matrix<subtraction_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>, L> operator-(const matrix<TO, NO, MO, L>& other) const;
 
-    template<class TO, size_t P, typename = typename std::enable_if_t<can_calculate_inner_product_v<T, TO>>>
-    matrix_multiplication_proxy<matrix<T, N, M>, matrix<TO, M, P>> operator*(const matrix<TO, M, P>& other) const;
+    //factors may have any layouts (e.g row-major matrix multiplied by column-major one is multiplied without transposition)
+    template<class TO, size_t P, class LO, typename = typename std::enable_if_t<can_calculate_inner_product_v<T, TO>>>
+    matrix_multiplication_proxy<matrix<T, N, M, L>, matrix<TO, M, P, LO>> operator*(const matrix<TO, M, P, LO>& other) const;
     
-    template<class... MOS, typename = typename std::enable_if_t<matrix_multiplication_proxy<MOS...>::result_rows == N && matrix_multiplication_proxy<MOS...>::result_rows == N>>
-    matrix_multiplication_proxy<matrix<T, N, M>, MOS...> operator*(const matrix_multiplication_proxy<MOS...>& other) const;
+    template<class... MOS, typename = typename std::enable_if_t<matrix_multiplication_proxy<MOS...>::result_rows == M && can_calculate_inner_product_v<T, typename matrix_multiplication_proxy<MOS...>::result_mathematical_field_type>>>
+    matrix_multiplication_proxy<matrix<T, N, M, L>, MOS...> operator*(const matrix_multiplication_proxy<MOS...>& other) const;
 
     template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator+=(const matrix<TO, NO, MO>& other);
+    matrix<T, N, M, L>& operator+=(const matrix<TO, NO, MO, L>& other);
     
     template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator-=(const matrix<TO, NO, MO>& other);
+    matrix<T, N, M, L>& operator-=(const matrix<TO, NO, MO, L>& other);
     
-    template<class TO, size_t P, typename = typename std::enable_if_t<M == P && can_calculate_inner_product_v<T, TO> && std::is_convertible_v<inner_product_result_t<T, TO>, T>>>
-    matrix<T, N, M>& operator*=(const matrix<TO, M, P>& other);
+    template<class TO, size_t P, class LO, typename = typename std::enable_if_t<M == P && can_calculate_inner_product_v<T, TO> && std::is_convertible_v<inner_product_result_t<T, TO>, T>>>
+    matrix<T, N, M, L>& operator*=(const matrix<TO, M, P, LO>& other);
+
+    template<class TO, class E, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    matrix<T, N, M, L>& operator+=(const matrix_expression<TO, N, M, E>& expression);
+
+    template<class TO, class E, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    matrix<T, N, M, L>& operator-=(const matrix_expression<TO, N, M, E>& expression);
+
+    //product is accumulated directly into matrix (C += A * B is single GEMM with beta = 1)
+    template<class... MOS, typename = typename std::enable_if_t<matrix_multiplication_proxy<MOS...>::result_rows == N && matrix_multiplication_proxy<MOS...>::result_columns == M && std::is_convertible_v<typename matrix_multiplication_proxy<MOS...>::result_mathematical_field_type, T>>>
+    matrix<T, N, M, L>& operator+=(const matrix_multiplication_proxy<MOS...>& proxy);
+
+    template<class... MOS, typename = typename std::enable_if_t<matrix_multiplication_proxy<MOS...>::result_rows == N && matrix_multiplication_proxy<MOS...>::result_columns == M && std::is_convertible_v<typename matrix_multiplication_proxy<MOS...>::result_mathematical_field_type, T>>>
+    matrix<T, N, M, L>& operator-=(const matrix_multiplication_proxy<MOS...>& proxy);
 
     //matrix-scalar operators
 
-    matrix<T, N, M> operator-() const;
+    //returns matrix_expression for big row-major matrices
+    auto operator-() const;
 
-    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
-    matrix<multiplication_result_t<T, TO>, N, M> operator*(const TO& v) const;
+    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T> && !detail::use_matrix_expression_v<T, N, M, N, M, L>>>
+    matrix<multiplication_result_t<T, TO>, N, M, L> operator*(const TO& v) const;
     
-    template<class TO, typename = typename std::enable_if_t<can_be_divided_v<T, TO> && std::is_convertible_v<TO, T>>>
-    matrix<division_result_t<T, TO>, N, M> operator/(const TO& v) const;
+    template<class TO, typename = typename std::enable_if_t<can_be_divided_v<T, TO> && std::is_convertible_v<TO, T> && !detail::use_matrix_expression_v<T, N, M, N, M, L>>>
+    matrix<division_result_t<T, TO>, N, M, L> operator/(const TO& v) const;
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator*=(const TO& v);
+    matrix<T, N, M, L>& operator*=(const TO& v);
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
-    matrix<T, N, M>& operator/=(const TO& v);
+    matrix<T, N, M, L>& operator/=(const TO& v);
 
     //matrix-vector operators
 
@@ -278,11 +358,11 @@ public:
     vector<inner_product_result_t<T, TO>, N> operator*(const vector<TO, M>& vec) const;
 public:
     //matrix info and accessors
-    T* operator[](size_t x);
-    const T* operator[](size_t x) const;
+    row_type operator[](size_t x);
+    const_row_type operator[](size_t x) const;
 
-    //matrix data is ordered row by row (i.e row|row|row|...|row)
-    //same rule applies for iterators
+    //matrix data is ordered according to layout (row by row for row_major, i.e row|row|row|...|row)
+    //same rule applies for iterators (they iterate over storage_size elements, padding of tiled layout included)
 
     T* data();
     const T* data() const;
@@ -292,6 +372,27 @@ public:
 
     T* end();
     const T* end() const;
+
+    //views of matrix memory (no elements are copied, views must not outlive matrix)
+    //views are available for strided layouts only (row_major and column_major)
+
+    matrix_view<T> view();
+    matrix_view<const T> view() const;
+
+    template<size_t R, size_t C, typename = typename std::enable_if_t<R <= N && C <= M>>
+    matrix_view<T> block(size_t row, size_t column);
+
+    template<size_t R, size_t C, typename = typename std::enable_if_t<R <= N && C <= M>>
+    matrix_view<const T> block(size_t row, size_t column) const;
+
+    vector_view<T> row(size_t row);
+    vector_view<const T> row(size_t row) const;
+
+    vector_view<T> column(size_t column);
+    vector_view<const T> column(size_t column) const;
+
+    vector_view<T> diagonal();
+    vector_view<const T> diagonal() const;
 public:
     //comparison operators
 
@@ -299,19 +400,21 @@ public:
     //and inequal if there is one element that is not equal to corresponding one
     //else matrices are always inequal
 
-    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<use_high_quality_equality_comparison ? high_quality_equality_comparable_v<T, TO> || equality_comparable_v<T, TO> : equality_comparable_v<T, TO>>>
-    bool operator==(const matrix<TO, NO, MO>& other) const;
+    //elements are compared by their positions, so matrices with different layouts can be compared
+
+    template<class TO, size_t NO, size_t MO, class LO, typename = typename std::enable_if_t<use_high_quality_equality_comparison ? high_quality_equality_comparable_v<T, TO> || equality_comparable_v<T, TO> : equality_comparable_v<T, TO>>>
+    bool operator==(const matrix<TO, NO, MO, LO>& other) const;
     
-    template<class TO, size_t NO, size_t MO, typename = typename std::enable_if_t<use_high_quality_equality_comparison ? high_quality_inequality_comparable_v<T, TO> || inequality_comparable_v<T, TO> : inequality_comparable_v<T, TO>>>
-    bool operator!=(const matrix<TO, NO, MO>& other) const;
+    template<class TO, size_t NO, size_t MO, class LO, typename = typename std::enable_if_t<use_high_quality_equality_comparison ? high_quality_inequality_comparable_v<T, TO> || inequality_comparable_v<T, TO> : inequality_comparable_v<T, TO>>>
+    bool operator!=(const matrix<TO, NO, MO, LO>& other) const;
 private:
     //helpers
 
-    template<class TO, size_t NO, size_t MO>
-    static inline void swap_rows(matrix<TO, NO, MO>& matrix, size_t r1, size_t r2, size_t start_column = 0, size_t end_column = MO);
+    template<class TO, size_t NO, size_t MO, class LO>
+    static inline void swap_rows(matrix<TO, NO, MO, LO>& matrix, size_t r1, size_t r2, size_t start_column = 0, size_t end_column = MO);
 
-    template<class TO, size_t NO, size_t MO>
-    static inline void swap_columns(matrix<TO, NO, MO>& matrix, size_t c1, size_t c2, size_t start_row = 0, size_t end_row = NO);
+    template<class TO, size_t NO, size_t MO, class LO>
+    static inline void swap_columns(matrix<TO, NO, MO, LO>& matrix, size_t c1, size_t c2, size_t start_row = 0, size_t end_row = NO);
 public:
     //matrix operations
 
@@ -319,22 +422,35 @@ public:
     T determinant() const;
 
     template<typename = typename std::enable_if_t<N == M>>
-    std::optional<matrix<T, N, M>> inverted() const;
+    std::optional<matrix<T, N, M, L>> inverted() const;
 
+    //number of linearly independent rows, for fields with square root, absolute value and epsilon it is number of singular values
+    //larger than max(N, M) * epsilon * largest singular value (rounding errors of dependent rows are not counted as independence)
     size_t rank() const;
 
-    matrix<T, M, N> transposed() const;
+    //singular value based operations below require square root, absolute value and epsilon of mathematical field
+
+    //number of singular values larger than tolerance (e.g expected error of coefficents)
+    size_t rank(const T& tolerance) const;
+
+    //moore-penrose pseudo-inverse (see singular_value_decomposition::pseudo_inverse), it is inverse of non-singular square matrix
+    matrix<T, M, N, L> pseudo_inverse() const;
+
+    //ratio of largest and smallest singular value (infinity if matrix does not have full rank)
+    T condition_number() const;
+
+    matrix<T, M, N, L> transposed() const;
     
     template<typename = typename std::enable_if_t<N == M>>
-    matrix<T, M, N>& transpose();
+    matrix<T, M, N, L>& transpose();
 public:
     template<typename = typename std::enable_if_t<N == M>>
-    static const matrix<T, N, M>& MULTIPLICATIVE_IDENTITY();
+    static const matrix<T, N, M, L>& MULTIPLICATIVE_IDENTITY();
 
-    static const matrix<T, N, M>& ADDITIVE_IDENTITY();
+    static const matrix<T, N, M, L>& ADDITIVE_IDENTITY();
 public:
-    template<class TO, size_t NO, size_t MO>
-    friend std::ostream& LINEAR_ALGEBRA_IO::operator<<(std::ostream& os, const matrix<TO, NO, MO>& m);
+    template<class TO, size_t NO, size_t MO, class LO>
+    friend std::ostream& LINEAR_ALGEBRA_IO::operator<<(std::ostream& os, const matrix<TO, NO, MO, LO>& m);
 
     template<class TO, size_t NO, size_t MO>
     friend equation_system_solution<TO, MO> solve_equation_system(matrix<TO, NO, MO>&& coefficents, vector<TO, NO>&& constant_terms);
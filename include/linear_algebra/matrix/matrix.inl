@@ -3,6 +3,19 @@
 #include "matrix.hpp"
 #include "../vector/vector.hpp"
 #include "../vector/vector.inl"
+#include "../kernels/gemm.hpp"
+#include "../kernels/strassen.hpp"
+#include "../kernels/closed_form.hpp"
+#include "../kernels/transpose.hpp"
+#include "../memory/scratch_arena.hpp"
+#include "../expressions/matrix_expression.hpp"
+#include "../expressions/matrix_expression.inl"
+#include "../expressions/matrix_product_expression.hpp"
+#include "../expressions/matrix_product_expression.inl"
+#include "../decompositions/lu_decomposition.hpp"
+#include "../decompositions/lu_decomposition.inl"
+#include "../views/vector_view.hpp"
+#include "../views/matrix_view.hpp"
 
 NAMESPACE_LINEAR_ALGEBRA_BEGIN
 
@@ -10,69 +23,66 @@ NAMESPACE_LINEAR_ALGEBRA_BEGIN
 
 namespace detail
 {
-    template<class T, class TO, size_t N, size_t M, size_t P>
-    matrix<inner_product_result_t<T, TO>, N, P> multiply_matrices(const matrix<T, N, M>& m1, const matrix<TO, M, P>& m2)
+    //result = alpha * m1 * m2 + beta * result (if beta is 0, previous content of result is ignored)
+    //result must not be one of multiplied matrices
+    //very large row-major floating point matrices are multiplied with strassen-winograd algorithm (see strassen_settings),
+    //matrices with strided layouts are passed to GEMM by their strides, tiled matrices with equal tiles are multiplied tile by tile,
+    //other tiled operands are converted to row-major layout first
+    template<class T, class TO, class TR, class TS, size_t N, size_t M, size_t P, class L, class LO, class LR>
+    void multiply_add_matrices(const matrix<T, N, M, L>& m1, const matrix<TO, M, P, LO>& m2, const TS& alpha, const TS& beta, matrix<TR, N, P, LR>& result)
     {
-        matrix<inner_product_result_t<T, TO>, N, P> result;
+        const bool big = matrix<T, N, M, L>::is_big_matrix || matrix<TO, M, P, LO>::is_big_matrix;
+        const bool parallel = parallel_gemm(N, P, M);
 
-#if USE_OPENMP
-        if (matrix<T, N, M>::is_big_matrix || matrix<TO, M, P>::is_big_matrix)
+        if constexpr (use_strassen_v<T, TO, TR> && std::is_same_v<L, row_major> && std::is_same_v<LO, row_major> && std::is_same_v<LR, row_major>)
         {
-#pragma omp parallel for
-            for (int row = 0; row < static_cast<int>(N); row++)
+            const strassen_settings settings = get_strassen_settings();
+            if (use_strassen(settings, N, P, M))
             {
-                for (size_t column = 0; column < P; column++)
-                {
-                    //calculating column-row inner product
-
-                    auto inner_product = get_additive_identity<inner_product_result_t<T, TO>>();
-
-                    for (size_t k = 0; k < M; k++)
-                    {
-                        inner_product += m1[row][k] * m2[k][column];
-                    }
-
-                    result[row][column] = inner_product;
-                }
+                strassen_multiply_add<T>(N, P, M, static_cast<T>(alpha), m1.data(), M, m2.data(), P, static_cast<T>(beta), result.data(), P, parallel, settings.crossover);
+                return;
             }
         }
-        else
-        {
-            for (size_t row = 0; row < N; row++)
-            {
-                for (size_t column = 0; column < P; column++)
-                {
-                    //calculating column-row inner product
-
-                    auto inner_product = get_additive_identity<inner_product_result_t<T, TO>>();
 
-                    for (size_t k = 0; k < M; k++)
-                    {
-                        inner_product += m1[row][k] * m2[k][column];
-                    }
-
-                    result[row][column] = inner_product;
-                }
-            }
+        if constexpr (L::is_strided && LO::is_strided && LR::is_strided)
+        {
+            multiply_add(N, P, M, alpha,
+                m1.data(), L::row_stride(N, M), L::column_stride(N, M),
+                m2.data(), LO::row_stride(M, P), LO::column_stride(M, P),
+                beta,
+                result.data(), LR::row_stride(N, P), LR::column_stride(N, P),
+                big);
         }
-#else
-        for (size_t row = 0; row < N; row++)
+        else if constexpr (is_tiled_layout_v<L> && std::is_same_v<L, LO> && std::is_same_v<L, LR>)
         {
-            for (size_t column = 0; column < P; column++)
-            {
-                //calculating column-row inner product
+            multiply_add_tiled<L::tile_size>(L::tiles(N), L::tiles(P), L::tiles(M), alpha, m1.data(), m2.data(), beta, result.data(), parallel);
+        }
+        else if constexpr (!L::is_strided)
+        {
+            multiply_add_matrices(matrix<T, N, M>(m1), m2, alpha, beta, result);
+        }
+        else if constexpr (!LO::is_strided)
+        {
+            multiply_add_matrices(m1, matrix<TO, M, P>(m2), alpha, beta, result);
+        }
+        else
+        {
+            //tiled result of strided factors
+            matrix<TR, N, P> product = beta != get_additive_identity<TS>() ? matrix<TR, N, P>(result) : matrix<TR, N, P>();
+            multiply_add_matrices(m1, m2, alpha, beta, product);
+            result = product;
+        }
+    }
 
-                auto inner_product = additive_identity<inner_product_result_t<T, TO>>();
+    //product has layout of first factor
+    template<class T, class TO, size_t N, size_t M, size_t P, class L, class LO>
+    matrix<inner_product_result_t<T, TO>, N, P, L> multiply_matrices(const matrix<T, N, M, L>& m1, const matrix<TO, M, P, LO>& m2)
+    {
+        using result_type = inner_product_result_t<T, TO>;
 
-                for (size_t k = 0; k < M; k++)
-                {
-                    inner_product += m1[row][k] * m2[k][column];
-                }
+        matrix<result_type, N, P, L> result;
 
-                result._mat[row][column] = inner_product;
-            }
-        }
-#endif
+        multiply_add_matrices(m1, m2, get_multiplicative_identity<result_type>(), get_additive_identity<result_type>(), result);
 
         return result;
     }
@@ -121,11 +131,104 @@ namespace detail
         return s;
     }
 
-    template<size_t b, size_t e, class... TS, size_t... NS, size_t... MS>
-    auto multiply_in_bracketed_order(const std::tuple<const matrix<TS, NS, MS>&...>& matrices)
+    ///<summary>
+    /// time of multiplication of subchain [b, e] in bracketing s (measured in multiply-adds)
+    /// <para>products with at least parallel_work multiply-adds are split over threads, other ones run on single thread</para>
+    ///</summary>
+    template<size_t S>
+    constexpr size_t get_multiplication_time(
+        const std::array<matrix_size, S>& sizes, const std::array<std::array<size_t, S>, S>& s,
+        size_t b, size_t e,
+        size_t parallel_work, size_t threads)
+    {
+        if (b == e)
+        {
+            return 0;
+        }
+
+        const size_t split = s[b][e];
+        const size_t work = sizes[b].rows * sizes[split - 1].columns * sizes[e].columns;
+
+        return
+            get_multiplication_time(sizes, s, b, split - 1, parallel_work, threads) +
+            get_multiplication_time(sizes, s, split, e, parallel_work, threads) +
+            (work >= parallel_work ? work / threads : work);
+    }
+
+    ///<summary>
+    /// whether subchains [b, split - 1] and [split, e] should be multiplied concurrently (as two tasks of executor)
+    /// <para>products inside of task run on its thread only, so tasks pay off when products of subchains
+    /// are too small to be split over threads on their own (they would be computed one after another by single thread)</para>
+    ///</summary>
+    template<size_t S>
+    inline bool multiply_subchains_concurrently(const std::array<matrix_size, S>& sizes, const std::array<std::array<size_t, S>, S>& s, size_t b, size_t split, size_t e)
+    {
+        if (!use_threads || inside_parallel_task())
+        {
+            return false;
+        }
+
+        const size_t threads = get_executor()->concurrency();
+        const size_t parallel_work = get_parallel_thresholds().gemm;
+
+        if (threads < 2)
+        {
+            return false;
+        }
+
+        const size_t left = get_multiplication_time(sizes, s, b, split - 1, parallel_thresholds::never, 1);
+        const size_t right = get_multiplication_time(sizes, s, split, e, parallel_thresholds::never, 1);
+
+        const size_t sequential =
+            get_multiplication_time(sizes, s, b, split - 1, parallel_work, threads) +
+            get_multiplication_time(sizes, s, split, e, parallel_work, threads);
+
+        //tasks are not worth it for chains of small matrices
+        return left + right >= parallel_work && std::max(left, right) < sequential;
+    }
+
+    template<size_t b, size_t e, class... TS, size_t... NS, size_t... MS, class... LS>
+    decltype(auto) multiply_in_bracketed_order(const std::tuple<const matrix<TS, NS, MS, LS>&...>& matrices);
+
+    //calls f(product of subchain [b, split - 1], product of subchain [split, e]),
+    //if both subchains have to be multiplied, they may be multiplied concurrently
+    template<size_t b, size_t split, size_t e, class... TS, size_t... NS, size_t... MS, class... LS, class F>
+    decltype(auto) with_multiplied_subchains(const std::tuple<const matrix<TS, NS, MS, LS>&...>& matrices, F&& f)
+    {
+        constexpr auto arr = std::array<matrix_size, sizeof...(TS)>({ matrix_size{ matrix<TS, NS, MS, LS>::rows,  matrix<TS, NS, MS, LS>::columns}... });
+        constexpr auto s = get_multiplication_bracketing(arr);
+
+        if constexpr (b < split - 1 && split < e)
+        {
+            if (multiply_subchains_concurrently(arr, s, b, split, e))
+            {
+                std::optional<decltype(multiply_in_bracketed_order<b, split - 1>(matrices))> left;
+                std::optional<decltype(multiply_in_bracketed_order<split, e>(matrices))> right;
+
+                parallel_for(2, true, [&](size_t subchain) {
+                    if (subchain == 0)
+                    {
+                        left.emplace(multiply_in_bracketed_order<b, split - 1>(matrices));
+                    }
+                    else
+                    {
+                        right.emplace(multiply_in_bracketed_order<split, e>(matrices));
+                    }
+                });
+
+                return f(*left, *right);
+            }
+        }
+
+        return f(multiply_in_bracketed_order<b, split - 1>(matrices), multiply_in_bracketed_order<split, e>(matrices));
+    }
+
+    //single matrices are returned by reference (they are not copied), products of subchains are returned by value
+    template<size_t b, size_t e, class... TS, size_t... NS, size_t... MS, class... LS>
+    decltype(auto) multiply_in_bracketed_order(const std::tuple<const matrix<TS, NS, MS, LS>&...>& matrices)
     {
         constexpr size_t S = sizeof...(TS);
-        constexpr auto arr = std::array<matrix_size, sizeof...(TS)>({ matrix_size{ matrix<TS, NS, MS>::rows,  matrix<TS, NS, MS>::columns}... });
+        constexpr auto arr = std::array<matrix_size, sizeof...(TS)>({ matrix_size{ matrix<TS, NS, MS, LS>::rows,  matrix<TS, NS, MS, LS>::columns}... });
         constexpr auto s = get_multiplication_bracketing(arr);
 
         if constexpr (b == e)
@@ -134,23 +237,89 @@ namespace detail
         }
         if constexpr (s[b][e] > b && s[b][e] <= e)
         {
-            return multiply_matrices(multiply_in_bracketed_order<b, s[b][e] - 1>(matrices), multiply_in_bracketed_order<s[b][e], e>(matrices));
+            return with_multiplied_subchains<b, s[b][e], e>(matrices, [](const auto& left, const auto& right) {
+                return multiply_matrices(left, right);
+            });
+        }
+    }
+
+    //same as above, but final multiplication of chain is done directly into result (result = alpha * product + beta * result)
+    template<class... TS, size_t... NS, size_t... MS, class... LS, class TR, size_t N, size_t P, class LR, class TA>
+    void multiply_add_in_bracketed_order(const std::tuple<const matrix<TS, NS, MS, LS>&...>& matrices, const TA& alpha, const TA& beta, matrix<TR, N, P, LR>& result)
+    {
+        constexpr size_t e = sizeof...(TS) - 1;
+        constexpr auto arr = std::array<matrix_size, sizeof...(TS)>({ matrix_size{ matrix<TS, NS, MS, LS>::rows,  matrix<TS, NS, MS, LS>::columns}... });
+        constexpr auto s = get_multiplication_bracketing(arr);
+
+        if constexpr (e == 0 && !std::is_same_v<typename std::decay_t<decltype(std::get<0>(matrices))>::layout_type, LR>)
+        {
+            //scaled matrix with layout different from layout of result is converted first
+            using source_type = std::decay_t<decltype(std::get<0>(matrices))>;
+            const matrix<typename source_type::mathematical_field_type, N, P, LR> copy(std::get<0>(matrices));
+
+            multiply_add_in_bracketed_order(std::tuple<const matrix<typename source_type::mathematical_field_type, N, P, LR>&>(copy), alpha, beta, result);
+        }
+        else if constexpr (e == 0)
+        {
+            //scaled matrix without multiplication
+            const auto& m = std::get<0>(matrices);
+            const bool accumulate = beta != get_additive_identity<TA>();
+
+            simd_for_each_chunk(matrix<TR, N, P, LR>::storage_size, parallel_elementwise(matrix<TR, N, P, LR>::storage_size), [&](size_t offset, size_t count) {
+                for (size_t index = offset; index < offset + count; index++)
+                {
+                    result.data()[index] = accumulate ?
+                        static_cast<TR>(alpha * m.data()[index] + beta * result.data()[index]) :
+                        static_cast<TR>(alpha * m.data()[index]);
+                }
+            });
+        }
+        else
+        {
+            with_multiplied_subchains<0, s[0][e], e>(matrices, [&](const auto& left, const auto& right) {
+                multiply_add_matrices(left, right, alpha, beta, result);
+            });
         }
     }
 }
 
+template<class... MS>
+template<class T, class L>
+bool matrix_multiplication_proxy<MS...>::is_factor(const matrix<T, result_rows, result_columns, L>& m) const
+{
+    return std::apply([&m](const auto&... factors) {
+        return ((static_cast<const void*>(&factors) == static_cast<const void*>(&m)) || ...);
+    }, _matrices);
+}
+
+template<class... MS>
+template<class T, class L>
+void matrix_multiplication_proxy<MS...>::multiply_add(matrix<T, result_rows, result_columns, L>& result, const result_mathematical_field_type& beta) const
+{
+    if (is_factor(result))
+    {
+        //result cannot be overwritten before product is calculated
+        matrix<result_mathematical_field_type, result_rows, result_columns> product = (*this)();
+
+        detail::multiply_add_in_bracketed_order(std::tuple<const matrix<result_mathematical_field_type, result_rows, result_columns>&>(product), get_multiplicative_identity<result_mathematical_field_type>(), beta, result);
+        return;
+    }
+
+    detail::multiply_add_in_bracketed_order(_matrices, _scale, beta, result);
+}
+
 template<class... MS>
 template<class... MSO, typename>
 matrix_multiplication_proxy<MS..., MSO...> matrix_multiplication_proxy<MS...>::operator*(const matrix_multiplication_proxy<MSO...>& other) const
 {
-    return matrix_multiplication_proxy<MS..., MSO...>(std::tuple_cat(_matrices, other._matrices));
+    return matrix_multiplication_proxy<MS..., MSO...>(std::tuple_cat(_matrices, other._matrices), _scale * other._scale);
 }
 
 template<class... MS>
-template<class TO, size_t P, typename>
-matrix_multiplication_proxy<MS..., matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, P>> matrix_multiplication_proxy<MS...>::operator*(const matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, P>& other) const
+template<class TO, size_t P, class LO, typename>
+matrix_multiplication_proxy<MS..., matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, P, LO>> matrix_multiplication_proxy<MS...>::operator*(const matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, P, LO>& other) const
 {
-    return matrix_multiplication_proxy<MS..., matrix<TO, result_columns, P>>(std::tuple_cat(_matrices, std::tuple<const matrix<TO, result_columns, P>&>(other)));
+    return matrix_multiplication_proxy<MS..., matrix<TO, result_columns, P, LO>>(std::tuple_cat(_matrices, std::tuple<const matrix<TO, result_columns, P, LO>&>(other)), _scale);
 }
 
 template<class... MS>
@@ -164,7 +333,7 @@ vector<inner_product_result_t<typename matrix_multiplication_proxy<MS...>::resul
         vector_copy[d][0] = other[d];
     }
 
-    auto result_matrix = *matrix_multiplication_proxy<MS..., matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, 1>>(std::tuple_cat(_matrices, std::tuple<const matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, 1>&>(vector_copy)));
+    auto result_matrix = *matrix_multiplication_proxy<MS..., matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, 1>>(std::tuple_cat(_matrices, std::tuple<const matrix<TO, matrix_multiplication_proxy<MS...>::result_columns, 1>&>(vector_copy)), _scale);
 
     vector<inner_product_result_t<typename matrix_multiplication_proxy<MS...>::result_mathematical_field_type, TO>, matrix_multiplication_proxy<MS...>::result_rows> result_vector;
 
@@ -176,182 +345,163 @@ vector<inner_product_result_t<typename matrix_multiplication_proxy<MS...>::resul
     return result_vector;
 }
 
+template<class... MS>
+template<class TO, typename>
+matrix_multiplication_proxy<MS...> matrix_multiplication_proxy<MS...>::operator*(const TO& v) const
+{
+    return matrix_multiplication_proxy<MS...>(_matrices, _scale * static_cast<result_mathematical_field_type>(v));
+}
+
+template<class... MS, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<typename matrix_multiplication_proxy<MS...>::result_mathematical_field_type, TO> && std::is_convertible_v<TO, typename matrix_multiplication_proxy<MS...>::result_mathematical_field_type>>>
+matrix_multiplication_proxy<MS...> operator*(const TO& v, const matrix_multiplication_proxy<MS...>& proxy)
+{
+    return proxy * v;
+}
+
+template<class... MS>
+matrix_multiplication_proxy<MS...> matrix_multiplication_proxy<MS...>::operator-() const
+{
+    return matrix_multiplication_proxy<MS...>(_matrices, -_scale);
+}
+
 template<class... MS>
 matrix<typename matrix_multiplication_proxy<MS...>::result_mathematical_field_type, matrix_multiplication_proxy<MS...>::result_rows, matrix_multiplication_proxy<MS...>::result_columns> matrix_multiplication_proxy<MS...>::operator()() const
 {
-    return detail::multiply_in_bracketed_order<0, sizeof...(MS) - 1>(_matrices);
+    matrix<result_mathematical_field_type, result_rows, result_columns> result;
+
+    detail::multiply_add_in_bracketed_order(_matrices, _scale, get_additive_identity<result_mathematical_field_type>(), result);
+
+    return result;
 }
 
 template<class... MS>
 matrix<typename matrix_multiplication_proxy<MS...>::result_mathematical_field_type, matrix_multiplication_proxy<MS...>::result_rows, matrix_multiplication_proxy<MS...>::result_columns> matrix_multiplication_proxy<MS...>::operator*() const
 {
-    return detail::multiply_in_bracketed_order<0, sizeof...(MS) - 1>(_matrices);
+    return (*this)();
 }
 
 //static storage
 
-template<class T, size_t N, size_t M>
-inline T* matrix<T, N, M>::matrix_storage_static::operator[](size_t row)
+template<class T, size_t N, size_t M, class L>
+inline typename matrix<T, N, M, L>::row_type matrix<T, N, M, L>::matrix_storage_static::operator[](size_t row)
 {
-    return _mat[row];
+    return detail::make_layout_row<T, L, N, M>(_mat, row);
 }
 
-template<class T, size_t N, size_t M>
-inline const T* matrix<T, N, M>::matrix_storage_static::operator[](size_t row) const
+template<class T, size_t N, size_t M, class L>
+inline typename matrix<T, N, M, L>::const_row_type matrix<T, N, M, L>::matrix_storage_static::operator[](size_t row) const
 {
-    return _mat[row];
+    return detail::make_layout_row<const T, L, N, M>(_mat, row);
 }
 
-template<class T, size_t N, size_t M>
-inline T* matrix<T, N, M>::matrix_storage_static::data()
+template<class T, size_t N, size_t M, class L>
+inline T* matrix<T, N, M, L>::matrix_storage_static::data()
 {
     return _mat;
 }
 
-template<class T, size_t N, size_t M>
-inline const T* matrix<T, N, M>::matrix_storage_static::data() const
+template<class T, size_t N, size_t M, class L>
+inline const T* matrix<T, N, M, L>::matrix_storage_static::data() const
 {
     return _mat;
 }
 
 //dynamic storage
 
-template<class T, size_t N, size_t M>
-inline matrix<T, N, M>::matrix_storage_dynamic::matrix_storage_dynamic()
+template<class T, size_t N, size_t M, class L>
+inline matrix<T, N, M, L>::matrix_storage_dynamic::matrix_storage_dynamic()
 {
-    _mat = new T[N*M];
+    _mat = detail::storage_allocate(_allocator, storage_size);
+
+    if constexpr (storage_size != N * M)
+    {
+        //padding of layout is never written by element loops, it must hold 0-oes for kernels working on whole storage
+        std::fill(_mat, _mat + storage_size, get_additive_identity<T>());
+    }
 }
 
-template<class T, size_t N, size_t M>
-inline matrix<T, N, M>::matrix_storage_dynamic::matrix_storage_dynamic(typename matrix<T, N, M>::matrix_storage_dynamic&& other) noexcept
+template<class T, size_t N, size_t M, class L>
+inline matrix<T, N, M, L>::matrix_storage_dynamic::matrix_storage_dynamic(typename matrix<T, N, M, L>::matrix_storage_dynamic&& other) noexcept :
+    _allocator(other._allocator)
 {
     _mat = other._mat;
     other._mat = nullptr;
 }
 
-template<class T, size_t N, size_t M>
-inline typename matrix<T, N, M>::matrix_storage_dynamic& matrix<T, N, M>::matrix_storage_dynamic::operator=(typename matrix<T, N, M>::matrix_storage_dynamic&& other) noexcept
+template<class T, size_t N, size_t M, class L>
+inline typename matrix<T, N, M, L>::matrix_storage_dynamic& matrix<T, N, M, L>::matrix_storage_dynamic::operator=(typename matrix<T, N, M, L>::matrix_storage_dynamic&& other) noexcept
 {
-    _mat = other._mat;
-    other._mat = nullptr;
+    //previous memory is released by destructor of other
+    std::swap(_allocator, other._allocator);
+    std::swap(_mat, other._mat);
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-inline matrix<T, N, M>::matrix_storage_dynamic::~matrix_storage_dynamic()
+template<class T, size_t N, size_t M, class L>
+inline matrix<T, N, M, L>::matrix_storage_dynamic::~matrix_storage_dynamic()
 {
     if (_mat)
     {
-        delete[] _mat;
+        detail::storage_deallocate(_allocator, _mat, storage_size);
     }
 }
 
-template<class T, size_t N, size_t M>
-inline T* matrix<T, N, M>::matrix_storage_dynamic::operator[](size_t row)
+template<class T, size_t N, size_t M, class L>
+inline typename matrix<T, N, M, L>::row_type matrix<T, N, M, L>::matrix_storage_dynamic::operator[](size_t row)
 {
-    return _mat + row * M;
+    return detail::make_layout_row<T, L, N, M>(_mat, row);
 }
 
-template<class T, size_t N, size_t M>
-inline const T* matrix<T, N, M>::matrix_storage_dynamic::operator[](size_t row) const
+template<class T, size_t N, size_t M, class L>
+inline typename matrix<T, N, M, L>::const_row_type matrix<T, N, M, L>::matrix_storage_dynamic::operator[](size_t row) const
 {
-    return _mat + row * M;
+    return detail::make_layout_row<const T, L, N, M>(_mat, row);
 }
 
-template<class T, size_t N, size_t M>
-inline T* matrix<T, N, M>::matrix_storage_dynamic::data()
+template<class T, size_t N, size_t M, class L>
+inline T* matrix<T, N, M, L>::matrix_storage_dynamic::data()
 {
     return _mat;
 }
 
-template<class T, size_t N, size_t M>
-inline const T* matrix<T, N, M>::matrix_storage_dynamic::data() const
+template<class T, size_t N, size_t M, class L>
+inline const T* matrix<T, N, M, L>::matrix_storage_dynamic::data() const
 {
     return _mat;
 }
 
 //matrix
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>::matrix()
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>::matrix()
 {
     //  filling matrix to initialize it with 0-oes
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = get_additive_identity<T>();
         }
-    }
-#endif
+    });
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>::matrix(const matrix<T, N, M>& other)
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>::matrix(const matrix<T, N, M, L>& other)
 {
     /*
         filling matrix NxM with matrix NxM
         matrix NxM elements are copied to
         elements in matrix MxN
     */
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>::matrix(matrix<T, N, M>&& other)
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>::matrix(matrix<T, N, M, L>&& other)
 {
     /*
         filling matrix NxM with matrix NxM
@@ -360,104 +510,40 @@ matrix<T, N, M>::matrix(matrix<T, N, M>&& other)
 
         move optimization for dynamic storage
     */
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-        if (std::is_same_v<storage_type, matrix_storage_dynamic>)
-        {
-            _mat = std::move(other._mat);
-        }
-        else
-        {
-#pragma omp parallel for
-            for (int row = 0; row < static_cast<int>(N); row++)
-            {
-                for (size_t column = 0; column < M; column++)
-                {
-                    _mat[row][column] = static_cast<T>(other._mat[row][column]);
-                }
-            }
-        }
-    }
-    else
-    {
-        if constexpr (std::is_same_v<storage_type, matrix_storage_dynamic>)
-        {
-            _mat = std::move(other._mat);
-        }
-        else
-        {
-            for (size_t row = 0; row < N; row++)
-            {
-                for (size_t column = 0; column < M; column++)
-                {
-                    _mat[row][column] = static_cast<T>(other._mat[row][column]);
-                }
-            }
-        }
-    }
-#else
     if constexpr (std::is_same_v<storage_type, matrix_storage_dynamic>)
     {
         _mat = std::move(other._mat);
     }
     else
     {
-        for (size_t row = 0; row < N; row++)
-        {
+        detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
             for (size_t column = 0; column < M; column++)
             {
                 _mat[row][column] = static_cast<T>(other._mat[row][column]);
             }
-        }
+        });
     }
-#endif
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>& matrix<T, N, M>::operator=(const matrix<T, N, M>& other)
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(const matrix<T, N, M, L>& other)
 {
     /*
         filling matrix NxM with matrix NxM
         matrix NxM elements are copied to
         elements in matrix MxN
     */
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>& matrix<T, N, M>::operator=(matrix<T, N, M>&& other)
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(matrix<T, N, M, L>&& other)
 {
     /*
         filling matrix NxM with matrix NxM
@@ -466,343 +552,96 @@ matrix<T, N, M>& matrix<T, N, M>::operator=(matrix<T, N, M>&& other)
 
         move optimization for dynamic storage
     */
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-        if (std::is_same_v<storage_type, matrix_storage_dynamic>)
-        {
-            _mat = std::move(other._mat);
-        }
-        else
-        {
-#pragma omp parallel for
-            for (int row = 0; row < static_cast<int>(N); row++)
-            {
-                for (size_t column = 0; column < M; column++)
-                {
-                    _mat[row][column] = static_cast<T>(other._mat[row][column]);
-                }
-            }
-        }
-    }
-    else
-    {
-        if constexpr (std::is_same_v<storage_type, matrix_storage_dynamic>)
-        {
-            _mat = std::move(other._mat);
-        }
-        else
-        {
-            for (size_t row = 0; row < N; row++)
-            {
-                for (size_t column = 0; column < M; column++)
-                {
-                    _mat[row][column] = static_cast<T>(other._mat[row][column]);
-                }
-            }
-        }
-    }
-#else
     if constexpr (std::is_same_v<storage_type, matrix_storage_dynamic>)
     {
         _mat = std::move(other._mat);
     }
     else
     {
-        for (size_t row = 0; row < N; row++)
-        {
+        detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
             for (size_t column = 0; column < M; column++)
             {
                 _mat[row][column] = static_cast<T>(other._mat[row][column]);
             }
-        }
+        });
     }
-#endif
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>::matrix(const matrix<TO, N, M>& other)
+matrix<T, N, M, L>::matrix(const matrix<TO, N, M, L>& other)
 {
     /*
         filling matrix NxM with matrix NxM
         matrix NxM elements are copied to
         elements in matrix MxN
     */
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>::matrix(matrix<TO, N, M>&& other)
+matrix<T, N, M, L>::matrix(matrix<TO, N, M, L>&& other)
 {
     /*
         filling matrix NxM with matrix NxM
         matrix NxM elements are copied to
         elements in matrix MxN
     */
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(const matrix<TO, N, M>& other)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(const matrix<TO, N, M, L>& other)
 {
     /*
         filling matrix NxM with matrix NxM
         matrix NxM elements are copied to
         elements in matrix MxN
     */
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(matrix<TO, N, M>&& other)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(matrix<TO, N, M, L>&& other)
 {
     /*
         filling matrix NxM with matrix NxM
         matrix NxM elements are copied to
         elements in matrix MxN
     */
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO, typename>
-matrix<T, N, M>::matrix(const matrix<TO, NO, MO>& other)
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, class LO, typename>
+matrix<T, N, M, L>::matrix(const matrix<TO, NO, MO, LO>& other)
 {
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-        /*
-            filling matrix NxM with matrix NOxMO
-            matrix NOxMO elements are copied to existing
-            elements in matrix MxN (element 0,0 is copied to element 0,0)
-            without getting out of matrix bounds
-        */
-
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-
-        /*
-            case in which other matrix is smaller than this matrix
-            we copy all of the other matrix elements
-            in according places leaveing us with 3 submatrices
-            which are uninitialized
-        */
-
-        //  filling left-bottom submatrix to initialize it with 0-oes
-#pragma omp parallel for
-        for (int row = static_cast<int>(smaller<N, NO>); row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-
-        //  filling right-top submatrix to initialize it with 0-oes
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = smaller<M, MO>; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-
-        //  filling bottom-right submatrix to initialize it with 0-oes
-#pragma omp parallel for
-        for (int row = static_cast<int>(smaller<N, NO>); row < static_cast<int>(N); row++)
-        {
-            for (size_t column = smaller<M, MO>; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-    }
-    else
-    {
-        /*
-        filling matrix NxM with matrix NOxMO
-        matrix NOxMO elements are copied to existing
-        elements in matrix MxN (element 0,0 is copied to element 0,0)
-        without getting out of matrix bounds
-    */
-
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-
-        /*
-            case in which other matrix is smaller than this matrix
-            we copy all of the other matrix elements
-            in according places leaveing us with 3 submatrices
-            which are uninitialized
-        */
-
-        //  filling left-bottom submatrix to initialize it with 0-oes
-        for (size_t row = smaller<N, NO>; row < N; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-
-        //  filling right-top submatrix to initialize it with 0-oes
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = smaller<M, MO>; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-
-        //  filling bottom-right submatrix to initialize it with 0-oes
-        for (size_t row = smaller<N, NO>; row < N; row++)
-        {
-            for (size_t column = smaller<M, MO>; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-    }
-#else
     /*
         filling matrix NxM with matrix NOxMO
         matrix NOxMO elements are copied to existing
@@ -810,13 +649,12 @@ matrix<T, N, M>::matrix(const matrix<TO, NO, MO>& other)
         without getting out of matrix bounds
     */
 
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
+    });
 
     /*
         case in which other matrix is smaller than this matrix
@@ -826,146 +664,34 @@ matrix<T, N, M>::matrix(const matrix<TO, NO, MO>& other)
     */
 
     //  filling left-bottom submatrix to initialize it with 0-oes
-    for (size_t row = smaller<N, NO>; row < N; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             _mat[row][column] = get_additive_identity<T>();
         }
-    }
+    });
 
     //  filling right-top submatrix to initialize it with 0-oes
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = smaller<M, MO>; column < M; column++)
         {
             _mat[row][column] = get_additive_identity<T>();
         }
-    }
+    });
 
     //  filling bottom-right submatrix to initialize it with 0-oes
-    for (size_t row = smaller<N, NO>; row < N; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = smaller<M, MO>; column < M; column++)
         {
             _mat[row][column] = get_additive_identity<T>();
         }
-    }
-#endif
+    });
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO, typename>
-matrix<T, N, M>::matrix(matrix<TO, NO, MO>&& other)
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, class LO, typename>
+matrix<T, N, M, L>::matrix(matrix<TO, NO, MO, LO>&& other)
 {
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-        /*
-            filling matrix NxM with matrix NOxMO
-            matrix NOxMO elements are copied to existing
-            elements in matrix MxN (element 0,0 is copied to element 0,0)
-            without getting out of matrix bounds
-        */
-
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-
-        /*
-            case in which other matrix is smaller than this matrix
-            we copy all of the other matrix elements
-            in according places leaveing us with 3 submatrices
-            which are uninitialized
-        */
-
-        //  filling left-bottom submatrix to initialize it with 0-oes
-#pragma omp parallel for
-        for (int row = static_cast<int>(smaller<N, NO>); row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-
-        //  filling right-top submatrix to initialize it with 0-oes
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = smaller<M, MO>; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-
-        //  filling bottom-right submatrix to initialize it with 0-oes
-#pragma omp parallel for
-        for (int row = static_cast<int>(smaller<N, NO>); row < static_cast<int>(N); row++)
-        {
-            for (size_t column = smaller<M, MO>; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-    }
-    else
-    {
-        /*
-        filling matrix NxM with matrix NOxMO
-        matrix NOxMO elements are copied to existing
-        elements in matrix MxN (element 0,0 is copied to element 0,0)
-        without getting out of matrix bounds
-    */
-
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-
-        /*
-            case in which other matrix is smaller than this matrix
-            we copy all of the other matrix elements
-            in according places leaveing us with 3 submatrices
-            which are uninitialized
-        */
-
-        //  filling left-bottom submatrix to initialize it with 0-oes
-        for (size_t row = smaller<N, NO>; row < N; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-
-        //  filling right-top submatrix to initialize it with 0-oes
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = smaller<M, MO>; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-
-        //  filling bottom-right submatrix to initialize it with 0-oes
-        for (size_t row = smaller<N, NO>; row < N; row++)
-        {
-            for (size_t column = smaller<M, MO>; column < M; column++)
-            {
-                _mat[row][column] = get_additive_identity<T>();
-            }
-        }
-    }
-#else
     /*
         filling matrix NxM with matrix NOxMO
         matrix NOxMO elements are copied to existing
@@ -973,13 +699,12 @@ matrix<T, N, M>::matrix(matrix<TO, NO, MO>&& other)
         without getting out of matrix bounds
     */
 
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
+    });
 
     /*
         case in which other matrix is smaller than this matrix
@@ -989,151 +714,72 @@ matrix<T, N, M>::matrix(matrix<TO, NO, MO>&& other)
     */
 
     //  filling left-bottom submatrix to initialize it with 0-oes
-    for (size_t row = smaller<N, NO>; row < N; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             _mat[row][column] = get_additive_identity<T>();
         }
-    }
+    });
 
     //  filling right-top submatrix to initialize it with 0-oes
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = smaller<M, MO>; column < M; column++)
         {
             _mat[row][column] = get_additive_identity<T>();
         }
-    }
+    });
 
     //  filling bottom-right submatrix to initialize it with 0-oes
-    for (size_t row = smaller<N, NO>; row < N; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = smaller<M, MO>; column < M; column++)
         {
             _mat[row][column] = get_additive_identity<T>();
         }
-    }
-#endif
+    });
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(const matrix<TO, NO, MO>& other)
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, class LO, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(const matrix<TO, NO, MO, LO>& other)
 {
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
+    detail::parallel_for(smaller<N, NO>, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(matrix<TO, NO, MO>&& other)
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, class LO, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(matrix<TO, NO, MO, LO>&& other)
 {
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] = static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
-        for (size_t column = 0; column < smaller<M, MO>; column++)
-        {
-            _mat[row][column] = static_cast<T>(other._mat[row][column]);
-        }
-    }
-#endif
-    return *this;
-}
-
-template<class T, size_t N, size_t M>
-template<class TO, typename>
-matrix<T, N, M>::matrix(const TO& v)
-{
-    //initializes all matrix elements with value v
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(v);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(v);
-            }
+    detail::parallel_for(smaller<N, NO>, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
+        for (size_t column = 0; column < smaller<M, MO>; column++)
+        {
+            _mat[row][column] = static_cast<T>(other._mat[row][column]);
         }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    });
+    return *this;
+}
+
+template<class T, size_t N, size_t M, class L>
+template<class TO, typename>
+matrix<T, N, M, L>::matrix(const TO& v)
+{
+    //initializes all matrix elements with value v
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(v);
         }
-    }
-#endif
+    });
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class... TOS, typename>
-matrix<T, N, M>::matrix(const TOS&... vs)
+matrix<T, N, M, L>::matrix(const TOS&... vs)
 
 {
     std::array<T, sizeof...(TOS)> elements = { static_cast<T>(vs)... };
@@ -1156,47 +802,22 @@ matrix<T, N, M>::matrix(const TOS&... vs)
     }
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>::matrix(TO&& v)
+matrix<T, N, M, L>::matrix(TO&& v)
 {
     //initializes all matrix elements with value v
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(v);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(v);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(v);
         }
-    }
-#endif
+    });
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class... TOS, typename>
-matrix<T, N, M>::matrix(TOS&&... vs)
+matrix<T, N, M, L>::matrix(TOS&&... vs)
 {
     std::array<T, sizeof...(TOS)> elements = { static_cast<T>(vs)... };
 
@@ -1218,8 +839,8 @@ matrix<T, N, M>::matrix(TOS&&... vs)
     }
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>::matrix(std::initializer_list<T> vs)
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>::matrix(std::initializer_list<T> vs)
 {
     //fills matrix with values from initializer_list row by row
 
@@ -1255,9 +876,9 @@ initializer_list_end:
     }
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>::matrix(std::initializer_list<TO> vs)
+matrix<T, N, M, L>::matrix(std::initializer_list<TO> vs)
 {
     //fills matrix with values from initializer_list row by row
 
@@ -1293,8 +914,8 @@ initializer_list_end:
     }
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>::matrix(std::initializer_list<std::initializer_list<T>> vs)
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>::matrix(std::initializer_list<std::initializer_list<T>> vs)
 {
     //every subsequent initializer_list in initializer_list is treated as row of matrix elements values
 
@@ -1348,9 +969,9 @@ matrix<T, N, M>::matrix(std::initializer_list<std::initializer_list<T>> vs)
     }
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>::matrix(std::initializer_list<std::initializer_list<TO>> vs)
+matrix<T, N, M, L>::matrix(std::initializer_list<std::initializer_list<TO>> vs)
 {
     //every subsequent initializer_list in initializer_list is treated as row of matrix elements values
 
@@ -1404,86 +1025,36 @@ matrix<T, N, M>::matrix(std::initializer_list<std::initializer_list<TO>> vs)
     }
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(const TO& v)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(const TO& v)
 {
     //initializes all matrix elements with value v
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(v);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(v);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(v);
         }
-    }
-#endif
+    });
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(TO&& v)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(TO&& v)
 {
     //initializes all matrix elements with value v
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(v);
-            }
-        }
-    }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] = static_cast<T>(v);
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+    detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] = static_cast<T>(v);
         }
-    }
-#endif
+    });
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>& matrix<T, N, M>::operator=(std::initializer_list<T> vs)
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(std::initializer_list<T> vs)
 {
     //fills matrix with values from initializer_list row by row
 
@@ -1507,9 +1078,9 @@ matrix<T, N, M>& matrix<T, N, M>::operator=(std::initializer_list<T> vs)
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(std::initializer_list<TO> vs)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(std::initializer_list<TO> vs)
 {
     //fills matrix with values from initializer_list row by row
 
@@ -1533,8 +1104,8 @@ matrix<T, N, M>& matrix<T, N, M>::operator=(std::initializer_list<TO> vs)
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M>& matrix<T, N, M>::operator=(std::initializer_list<std::initializer_list<T>> vs)
+template<class T, size_t N, size_t M, class L>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(std::initializer_list<std::initializer_list<T>> vs)
 {
     //every subsequent initializer_list in initializer_list is treated as row of matrix elements values
 
@@ -1571,9 +1142,9 @@ matrix<T, N, M>& matrix<T, N, M>::operator=(std::initializer_list<std::initializ
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(std::initializer_list<std::initializer_list<TO>> vs)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(std::initializer_list<std::initializer_list<TO>> vs)
 {
     //every subsequent initializer_list in initializer_list is treated as row of matrix elements values
 
@@ -1610,422 +1181,395 @@ matrix<T, N, M>& matrix<T, N, M>::operator=(std::initializer_list<std::initializ
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class... MOS, typename>
-matrix<T, N, M>::matrix(const matrix_multiplication_proxy<MOS...>& proxy) :
-    matrix<T, N, M>(*proxy)
+matrix<T, N, M, L>::matrix(const matrix_multiplication_proxy<MOS...>& proxy) :
+    matrix<T, N, M, L>(*proxy)
 {
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class... MOS, typename>
-matrix<T, N, M>::matrix(matrix_multiplication_proxy<MOS...>&& proxy) :
-    matrix<T, N, M>(*proxy)
+matrix<T, N, M, L>::matrix(matrix_multiplication_proxy<MOS...>&& proxy) :
+    matrix<T, N, M, L>(*proxy)
 {
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class... MOS, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(const matrix_multiplication_proxy<MOS...>& proxy)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(const matrix_multiplication_proxy<MOS...>& proxy)
 {
     *this = *proxy;
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class... MOS, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator=(matrix_multiplication_proxy<MOS...>&& proxy)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(matrix_multiplication_proxy<MOS...>&& proxy)
 {
     *this = *proxy;
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO, typename>
-matrix<addition_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>> matrix<T, N, M>::operator+(const matrix<TO, NO, MO>& other) const
+template<class T, size_t N, size_t M, class L>
+template<class P, class E, typename>
+matrix<T, N, M, L>::matrix(const matrix_product_expression<P, E>& expression)
 {
-    matrix<addition_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>> result;
+    if constexpr (std::is_same_v<L, row_major>)
+    {
+        expression.evaluate(*this);
+    }
+    else
+    {
+        //expressions are evaluated in row-major layout
+        *this = matrix<T, N, M>(expression);
+    }
+}
 
-#if USE_OPENMP
-    if (is_big_matrix)
+template<class T, size_t N, size_t M, class L>
+template<class P, class E, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(const matrix_product_expression<P, E>& expression)
+{
+    if constexpr (std::is_same_v<L, row_major>)
     {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                result._mat[row][column] = _mat[row][column] + other._mat[row][column];
-            }
-        }
+        expression.evaluate(*this);
     }
     else
     {
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                result._mat[row][column] = _mat[row][column] + other._mat[row][column];
-            }
-        }
+        *this = matrix<T, N, M>(expression);
+    }
+
+    return *this;
+}
+
+template<class T, size_t N, size_t M, class L>
+template<class TO, class E, typename>
+matrix<T, N, M, L>::matrix(const matrix_expression<TO, N, M, E>& expression)
+{
+    if constexpr (std::is_same_v<L, row_major>)
+    {
+        //storage is not filled with 0-oes, every element is written by expression
+        detail::evaluate_matrix_expression(data(), expression, [](T& element, const TO& value) { element = static_cast<T>(value); });
+    }
+    else
+    {
+        //expressions are evaluated in row-major layout
+        *this = matrix<T, N, M>(expression);
     }
-#else
-    for (size_t row = 0; row < smaller<N, NO>; row++)
+}
+
+template<class T, size_t N, size_t M, class L>
+template<class TO, class E, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator=(const matrix_expression<TO, N, M, E>& expression)
+{
+    if constexpr (std::is_same_v<L, row_major>)
+    {
+        detail::evaluate_matrix_expression(data(), expression, [](T& element, const TO& value) { element = static_cast<T>(value); });
+    }
+    else
+    {
+        *this = matrix<T, N, M>(expression);
+    }
+
+    return *this;
+}
+
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, typename>
+matrix<addition_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>, L> matrix<T, N, M, L>::operator+(const matrix<TO, NO, MO, L>& other) const
+{
+    matrix<addition_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>, L> result;
+
+    if constexpr (detail::use_simd_kernels_v<T, TO> && L::common_storage_size(N, M, NO, MO) >= detail::simd_kernels_min_size)
     {
+        //storages of both matrices begin with the same elements of their common block (e.g rows of equal length)
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(L::common_storage_size(N, M, NO, MO), detail::parallel_elementwise(storage_size), [&](size_t offset, size_t count) {
+            kernels.add(count, data() + offset, other.data() + offset, result.data() + offset);
+        });
+        return result;
+    }
+
+    detail::parallel_for(smaller<N, NO>, detail::parallel_elementwise(storage_size), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             result._mat[row][column] = _mat[row][column] + other._mat[row][column];
         }
-    }
-#endif
+    });
 
     return result;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, size_t NO, size_t MO, typename>
-matrix<subtraction_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>> matrix<T, N, M>::operator-(const matrix<TO, NO, MO>& other) const
+matrix<subtraction_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>, L> matrix<T, N, M, L>::operator-(const matrix<TO, NO, MO, L>& other) const
 {
-    matrix<subtraction_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>> result;
+    matrix<subtraction_result_t<T, TO>, smaller<N, NO>, smaller<M, MO>, L> result;
 
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                result._mat[row][column] = _mat[row][column] - other._mat[row][column];
-            }
-        }
-    }
-    else
+    if constexpr (detail::use_simd_kernels_v<T, TO> && L::common_storage_size(N, M, NO, MO) >= detail::simd_kernels_min_size)
     {
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                result._mat[row][column] = _mat[row][column] - other._mat[row][column];
-            }
-        }
+        //storages of both matrices begin with the same elements of their common block (e.g rows of equal length)
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(L::common_storage_size(N, M, NO, MO), detail::parallel_elementwise(storage_size), [&](size_t offset, size_t count) {
+            kernels.subtract(count, data() + offset, other.data() + offset, result.data() + offset);
+        });
+        return result;
     }
-#else
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
+
+    detail::parallel_for(smaller<N, NO>, detail::parallel_elementwise(storage_size), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             result._mat[row][column] = _mat[row][column] - other._mat[row][column];
         }
-    }
-#endif
+    });
 
     return result;
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t P, typename>
-matrix_multiplication_proxy<matrix<T, N, M>, matrix<TO, M, P>> matrix<T, N, M>::operator*(const matrix<TO, M, P>& other) const
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t P, class LO, typename>
+matrix_multiplication_proxy<matrix<T, N, M, L>, matrix<TO, M, P, LO>> matrix<T, N, M, L>::operator*(const matrix<TO, M, P, LO>& other) const
 {
-    return matrix_multiplication_proxy<matrix<T, N, M>, matrix<TO, M, P>>(std::tuple<const matrix<T, N, M>&, const matrix<TO, M, P>&>(*this, other));
+    return matrix_multiplication_proxy<matrix<T, N, M, L>, matrix<TO, M, P, LO>>(std::tuple<const matrix<T, N, M, L>&, const matrix<TO, M, P, LO>&>(*this, other));
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class... MOS, typename>
-matrix_multiplication_proxy<matrix<T, N, M>, MOS...> matrix<T, N, M>::operator*(const matrix_multiplication_proxy<MOS...>& other) const
+matrix_multiplication_proxy<matrix<T, N, M, L>, MOS...> matrix<T, N, M, L>::operator*(const matrix_multiplication_proxy<MOS...>& other) const
 {
-    return matrix_multiplication_proxy<matrix<T, N, M>, MOS...>(std::tuple_cat(std::tuple<const matrix<T, N, M>&>(*this), other._matrices));
+    using proxy_type = matrix_multiplication_proxy<matrix<T, N, M, L>, MOS...>;
+
+    return proxy_type(std::tuple_cat(std::tuple<const matrix<T, N, M, L>&>(*this), other._matrices), static_cast<typename proxy_type::result_mathematical_field_type>(other._scale));
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, size_t NO, size_t MO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator+=(const matrix<TO, NO, MO>& other)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator+=(const matrix<TO, NO, MO, L>& other)
 {
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] += static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
+    if constexpr (detail::use_simd_kernels_v<T, TO> && L::common_storage_size(N, M, NO, MO) >= detail::simd_kernels_min_size)
     {
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] += static_cast<T>(other._mat[row][column]);
-            }
-        }
+        //storages of both matrices begin with the same elements of their common block (e.g rows of equal length)
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(L::common_storage_size(N, M, NO, MO), detail::parallel_elementwise(storage_size), [&](size_t offset, size_t count) {
+            kernels.add(count, data() + offset, other.data() + offset, data() + offset);
+        });
+        return *this;
     }
-#else
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
+
+    detail::parallel_for(smaller<N, NO>, detail::parallel_elementwise(storage_size), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             _mat[row][column] += static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
 
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, size_t NO, size_t MO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator-=(const matrix<TO, NO, MO>& other)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator-=(const matrix<TO, NO, MO, L>& other)
 {
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(smaller<N, NO>); row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] -= static_cast<T>(other._mat[row][column]);
-            }
-        }
-    }
-    else
+    if constexpr (detail::use_simd_kernels_v<T, TO> && L::common_storage_size(N, M, NO, MO) >= detail::simd_kernels_min_size)
     {
-        for (size_t row = 0; row < smaller<N, NO>; row++)
-        {
-            for (size_t column = 0; column < smaller<M, MO>; column++)
-            {
-                _mat[row][column] -= static_cast<T>(other._mat[row][column]);
-            }
-        }
+        //storages of both matrices begin with the same elements of their common block (e.g rows of equal length)
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(L::common_storage_size(N, M, NO, MO), detail::parallel_elementwise(storage_size), [&](size_t offset, size_t count) {
+            kernels.subtract(count, data() + offset, other.data() + offset, data() + offset);
+        });
+        return *this;
     }
-#else
-    for (size_t row = 0; row < smaller<N, NO>; row++)
-    {
+
+    detail::parallel_for(smaller<N, NO>, detail::parallel_elementwise(storage_size), [&](size_t row) {
         for (size_t column = 0; column < smaller<M, MO>; column++)
         {
             _mat[row][column] -= static_cast<T>(other._mat[row][column]);
         }
-    }
-#endif
+    });
 
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t P, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator*=(const matrix<TO, M, P>& other)
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t P, class LO, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator*=(const matrix<TO, M, P, LO>& other)
 {
-    *this = std::move(matrix_multiplication_proxy<matrix<T, N, M>, matrix<TO, M, P>>::multiply_matrices(*this, other));
+    *this = detail::multiply_matrices(*this, other);
     return *this;
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, N, M> matrix<T, N, M>::operator-() const
+template<class T, size_t N, size_t M, class L>
+template<class TO, class E, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator+=(const matrix_expression<TO, N, M, E>& expression)
 {
-    matrix<T, N, M> result;
-
-#if USE_OPENMP
-    if (is_big_matrix)
+    if constexpr (std::is_same_v<L, row_major>)
     {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                result._mat[row][column] = -_mat[row][column];
-            }
-        }
+        detail::evaluate_matrix_expression(data(), expression, [](T& element, const TO& value) { element += static_cast<T>(value); });
     }
     else
     {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                result._mat[row][column] = -_mat[row][column];
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
-        for (size_t column = 0; column < M; column++)
-        {
-            result._mat[row][column] = -_mat[row][column];
-        }
+        *this += matrix<T, N, M, L>(matrix<T, N, M>(expression));
     }
-#endif
-    return result;
+
+    return *this;
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, typename>
-matrix<multiplication_result_t<T, TO>, N, M> matrix<T, N, M>::operator*(const TO& v) const
+template<class T, size_t N, size_t M, class L>
+template<class TO, class E, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator-=(const matrix_expression<TO, N, M, E>& expression)
 {
-    matrix<multiplication_result_t<T, TO>, N, M> result;
-
-#if USE_OPENMP
-    if (is_big_matrix)
+    if constexpr (std::is_same_v<L, row_major>)
     {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                result._mat[row][column] = _mat[row][column] * v;
-            }
-        }
+        detail::evaluate_matrix_expression(data(), expression, [](T& element, const TO& value) { element -= static_cast<T>(value); });
     }
     else
     {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                result._mat[row][column] = _mat[row][column] * v;
-            }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
-        for (size_t column = 0; column < M; column++)
-        {
-            result._mat[row][column] = _mat[row][column] * v;
-        }
+        *this -= matrix<T, N, M, L>(matrix<T, N, M>(expression));
     }
-#endif
-    return result;
+
+    return *this;
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, typename>
-matrix<division_result_t<T, TO>, N, M> matrix<T, N, M>::operator/(const TO& v) const
+template<class T, size_t N, size_t M, class L>
+template<class... MOS, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator+=(const matrix_multiplication_proxy<MOS...>& proxy)
+{
+    proxy.multiply_add(*this, get_multiplicative_identity<typename matrix_multiplication_proxy<MOS...>::result_mathematical_field_type>());
+    return *this;
+}
+
+template<class T, size_t N, size_t M, class L>
+template<class... MOS, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator-=(const matrix_multiplication_proxy<MOS...>& proxy)
 {
-    matrix<division_result_t<T, TO>, N, M> result;
+    (-proxy).multiply_add(*this, get_multiplicative_identity<typename matrix_multiplication_proxy<MOS...>::result_mathematical_field_type>());
+    return *this;
+}
 
-#if USE_OPENMP
-    if (is_big_matrix)
+template<class T, size_t N, size_t M, class L>
+auto matrix<T, N, M, L>::operator-() const
+{
+    if constexpr (detail::use_matrix_expression_v<T, N, M, N, M, L>)
     {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                result._mat[row][column] = _mat[row][column] / v;
-            }
-        }
+        return detail::make_matrix_expression<T, N, M>([elements = data()](size_t index) { return -elements[index]; });
     }
     else
     {
+        matrix<T, N, M, L> result;
+
         for (size_t row = 0; row < N; row++)
         {
             for (size_t column = 0; column < M; column++)
             {
-                result._mat[row][column] = _mat[row][column] / v;
+                result._mat[row][column] = -_mat[row][column];
             }
         }
+
+        return result;
     }
-#else
-    for (size_t row = 0; row < N; row++)
+}
+
+template<class T, size_t N, size_t M, class L>
+template<class TO, typename>
+matrix<multiplication_result_t<T, TO>, N, M, L> matrix<T, N, M, L>::operator*(const TO& v) const
+{
+    matrix<multiplication_result_t<T, TO>, N, M, L> result;
+
+    if constexpr (detail::has_simd_kernels_v<T> && std::is_same_v<multiplication_result_t<T, TO>, T> && storage_size >= detail::simd_kernels_min_size)
     {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(storage_size, detail::parallel_elementwise(storage_size), [&](size_t offset, size_t count) {
+            kernels.scale(count, static_cast<T>(v), data() + offset, result.data() + offset);
+        });
+        return result;
+    }
+
+    detail::parallel_for(N, detail::parallel_elementwise(storage_size), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
-            result._mat[row][column] = _mat[row][column] / v;
+            result._mat[row][column] = _mat[row][column] * v;
         }
-    }
-#endif
+    });
     return result;
 }
 
-template<class T, size_t N, size_t M, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
-matrix<multiplication_result_t<T, TO>, N, M> operator*(const TO& v, const matrix<T, N, M>& matrix)
-{
-    return matrix * v;
-}
-
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator*=(const TO& v)
+matrix<division_result_t<T, TO>, N, M, L> matrix<T, N, M, L>::operator/(const TO& v) const
 {
-#if USE_OPENMP
-    if (is_big_matrix)
+    matrix<division_result_t<T, TO>, N, M, L> result;
+
+    if constexpr (detail::has_simd_kernels_v<T> && std::is_same_v<division_result_t<T, TO>, T> && storage_size >= detail::simd_kernels_min_size)
     {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] *= static_cast<T>(v);
-            }
-        }
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(storage_size, detail::parallel_elementwise(storage_size), [&](size_t offset, size_t count) {
+            kernels.divide(count, static_cast<T>(v), data() + offset, result.data() + offset);
+        });
+        return result;
     }
-    else
-    {
-        for (size_t row = 0; row < N; row++)
+
+    detail::parallel_for(N, detail::parallel_elementwise(storage_size), [&](size_t row) {
+        for (size_t column = 0; column < M; column++)
         {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] *= static_cast<T>(v);
-            }
+            result._mat[row][column] = _mat[row][column] / v;
         }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
+    });
+    return result;
+}
+
+template<class T, size_t N, size_t M, class L, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+auto operator*(const TO& v, const matrix<T, N, M, L>& matrix)
+{
+    return matrix * v;
+}
+
+template<class T, size_t N, size_t M, class L>
+template<class TO, typename>
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator*=(const TO& v)
+{
+    if constexpr (detail::has_simd_kernels_v<T> && storage_size >= detail::simd_kernels_min_size)
     {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(storage_size, detail::parallel_elementwise(storage_size), [&](size_t offset, size_t count) {
+            kernels.scale(count, static_cast<T>(v), data() + offset, data() + offset);
+        });
+        return *this;
+    }
+
+    detail::parallel_for(N, detail::parallel_elementwise(storage_size), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] *= static_cast<T>(v);
         }
-    }
-#endif
+    });
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-matrix<T, N, M>& matrix<T, N, M>::operator/=(const TO & v)
+matrix<T, N, M, L>& matrix<T, N, M, L>::operator/=(const TO & v)
 {
-#if USE_OPENMP
-    if (is_big_matrix)
-    {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] /= static_cast<T>(v);
-            }
-        }
-    }
-    else
+    if constexpr (detail::has_simd_kernels_v<T> && storage_size >= detail::simd_kernels_min_size)
     {
-        for (size_t row = 0; row < N; row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                _mat[row][column] /= static_cast<T>(v);
-            }
-        }
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(storage_size, detail::parallel_elementwise(storage_size), [&](size_t offset, size_t count) {
+            kernels.divide(count, static_cast<T>(v), data() + offset, data() + offset);
+        });
+        return *this;
     }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
+
+    detail::parallel_for(N, detail::parallel_elementwise(storage_size), [&](size_t row) {
         for (size_t column = 0; column < M; column++)
         {
             _mat[row][column] /= static_cast<T>(v);
         }
-    }
-#endif
+    });
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<class TO, typename>
-vector<inner_product_result_t<T, TO>, N> matrix<T, N, M>::operator*(const vector<TO, M>& vec) const
+vector<inner_product_result_t<T, TO>, N> matrix<T, N, M, L>::operator*(const vector<TO, M>& vec) const
 {
     vector<inner_product_result_t<T, TO>, N> result;
 
@@ -2042,104 +1586,135 @@ vector<inner_product_result_t<T, TO>, N> matrix<T, N, M>::operator*(const vector
     return result;
 }
 
-template<class T, size_t N, size_t M>
-T* matrix<T, N, M>::operator[](size_t x)
+template<class T, size_t N, size_t M, class L>
+typename matrix<T, N, M, L>::row_type matrix<T, N, M, L>::operator[](size_t x)
 {
     return _mat[x];
 }
 
-template<class T, size_t N, size_t M>
-const T* matrix<T, N, M>::operator[](size_t x) const
+template<class T, size_t N, size_t M, class L>
+typename matrix<T, N, M, L>::const_row_type matrix<T, N, M, L>::operator[](size_t x) const
 {
     return _mat[x];
 }
 
-template<class T, size_t N, size_t M>
-T* matrix<T, N, M>::data()
+template<class T, size_t N, size_t M, class L>
+T* matrix<T, N, M, L>::data()
 {
     return _mat.data();
 }
 
-template<class T, size_t N, size_t M>
-const T* matrix<T, N, M>::data() const
+template<class T, size_t N, size_t M, class L>
+const T* matrix<T, N, M, L>::data() const
 {
     return _mat.data();
 }
 
-template<class T, size_t N, size_t M>
-T* matrix<T, N, M>::begin()
+template<class T, size_t N, size_t M, class L>
+T* matrix<T, N, M, L>::begin()
 {
     return _mat.data();
 }
 
-template<class T, size_t N, size_t M>
-const T* matrix<T, N, M>::begin() const
+template<class T, size_t N, size_t M, class L>
+const T* matrix<T, N, M, L>::begin() const
 {
     return _mat.data();
 }
 
-template<class T, size_t N, size_t M>
-T* matrix<T, N, M>::end()
+template<class T, size_t N, size_t M, class L>
+T* matrix<T, N, M, L>::end()
 {
-    return _mat.data() + N * M;
+    return _mat.data() + storage_size;
 }
 
-template<class T, size_t N, size_t M>
-const T* matrix<T, N, M>::end() const
+template<class T, size_t N, size_t M, class L>
+const T* matrix<T, N, M, L>::end() const
 {
-    return _mat.data() + N * M;
+    return _mat.data() + storage_size;
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO, typename>
-bool matrix<T, N, M>::operator==(const matrix<TO, NO, MO>& other) const
+template<class T, size_t N, size_t M, class L>
+matrix_view<T> matrix<T, N, M, L>::view()
+{
+    return matrix_view<T>(*this);
+}
+
+template<class T, size_t N, size_t M, class L>
+matrix_view<const T> matrix<T, N, M, L>::view() const
+{
+    return matrix_view<const T>(*this);
+}
+
+template<class T, size_t N, size_t M, class L>
+template<size_t R, size_t C, typename>
+matrix_view<T> matrix<T, N, M, L>::block(size_t row, size_t column)
+{
+    return view().template block<R, C>(row, column);
+}
+
+template<class T, size_t N, size_t M, class L>
+template<size_t R, size_t C, typename>
+matrix_view<const T> matrix<T, N, M, L>::block(size_t row, size_t column) const
+{
+    return view().template block<R, C>(row, column);
+}
+
+template<class T, size_t N, size_t M, class L>
+vector_view<T> matrix<T, N, M, L>::row(size_t row)
+{
+    return view().row(row);
+}
+
+template<class T, size_t N, size_t M, class L>
+vector_view<const T> matrix<T, N, M, L>::row(size_t row) const
+{
+    return view().row(row);
+}
+
+template<class T, size_t N, size_t M, class L>
+vector_view<T> matrix<T, N, M, L>::column(size_t column)
+{
+    return view().column(column);
+}
+
+template<class T, size_t N, size_t M, class L>
+vector_view<const T> matrix<T, N, M, L>::column(size_t column) const
+{
+    return view().column(column);
+}
+
+template<class T, size_t N, size_t M, class L>
+vector_view<T> matrix<T, N, M, L>::diagonal()
+{
+    return view().diagonal();
+}
+
+template<class T, size_t N, size_t M, class L>
+vector_view<const T> matrix<T, N, M, L>::diagonal() const
+{
+    return view().diagonal();
+}
+
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, class LO, typename>
+bool matrix<T, N, M, L>::operator==(const matrix<TO, NO, MO, LO>& other) const
 {
     if (NO == N && MO == M)
     {
-#if USE_OPENMP
-        if (is_big_matrix)
-        {
-            bool equals = true;
+        bool equals = true;
 
-#pragma omp parallel for
-            for (int row = 0; row < static_cast<int>(N); row++)
-            {
-                for (size_t column = 0; column < M; column++)
-                {
-                    if (!equal(_mat[row][column], other._mat[row][column]))
-                    {
-                        equals = false;
-                    }
-                }
-            }
-
-            return equals;
-        }
-        else
-        {
-            for (size_t row = 0; row < N; row++)
-            {
-                for (size_t column = 0; column < M; column++)
-                {
-                    if (!equal(_mat[row][column], other._mat[row][column]))
-                    {
-                        return false;
-                    }
-                }
-            }
-        }
-#else
-        for (size_t row = 0; row < N; row++)
-        {
+        detail::parallel_for(N, detail::parallel_elementwise(storage_size), [&](size_t row) {
             for (size_t column = 0; column < M; column++)
             {
                 if (!equal(_mat[row][column], other._mat[row][column]))
                 {
-                    return false;
+                    equals = false;
                 }
             }
-        }
-#endif
+        });
+
+        return equals;
         return true;
     }
     else
@@ -2148,56 +1723,25 @@ bool matrix<T, N, M>::operator==(const matrix<TO, NO, MO>& other) const
     }
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO, typename>
-bool matrix<T, N, M>::operator!=(const matrix<TO, NO, MO>& other) const
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, class LO, typename>
+bool matrix<T, N, M, L>::operator!=(const matrix<TO, NO, MO, LO>& other) const
 {
     if (NO == N && MO == M)
     {
-#if USE_OPENMP
-        if (is_big_matrix)
-        {
-            bool inequals = false;
-
-#pragma omp parallel for
-            for (int row = 0; row < static_cast<int>(N); row++)
-            {
-                for (size_t column = 0; column < M; column++)
-                {
-                    if (inequal(_mat[row][column], other._mat[row][column]))
-                    {
-                        inequals = true;
-                    }
-                }
-            }
+        bool inequals = false;
 
-            return inequals;
-        }
-        else
-        {
-            for (size_t row = 0; row < N; row++)
-            {
-                for (size_t column = 0; column < M; column++)
-                {
-                    if (inequal(_mat[row][column], other._mat[row][column]))
-                    {
-                        return true;
-                    }
-                }
-            }
-        }
-#else
-        for (size_t row = 0; row < N; row++)
-        {
+        detail::parallel_for(N, detail::parallel_elementwise(storage_size), [&](size_t row) {
             for (size_t column = 0; column < M; column++)
             {
                 if (inequal(_mat[row][column], other._mat[row][column]))
                 {
-                    return true;
+                    inequals = true;
                 }
             }
-        }
-#endif
+        });
+
+        return inequals;
         return false;
     }
     else
@@ -2206,9 +1750,9 @@ bool matrix<T, N, M>::operator!=(const matrix<TO, NO, MO>& other) const
     }
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO>
-inline void matrix<T, N, M>::swap_rows(matrix<TO, NO, MO>& matrix, size_t r1, size_t r2, size_t start_column, size_t end_column)
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, class LO>
+inline void matrix<T, N, M, L>::swap_rows(matrix<TO, NO, MO, LO>& matrix, size_t r1, size_t r2, size_t start_column, size_t end_column)
 {
     for (size_t column = start_column; column < end_column; column++)
     {
@@ -2216,9 +1760,9 @@ inline void matrix<T, N, M>::swap_rows(matrix<TO, NO, MO>& matrix, size_t r1, si
     }
 }
 
-template<class T, size_t N, size_t M>
-template<class TO, size_t NO, size_t MO>
-inline void matrix<T, N, M>::swap_columns(matrix<TO, NO, MO>& matrix, size_t c1, size_t c2, size_t start_row, size_t end_row)
+template<class T, size_t N, size_t M, class L>
+template<class TO, size_t NO, size_t MO, class LO>
+inline void matrix<T, N, M, L>::swap_columns(matrix<TO, NO, MO, LO>& matrix, size_t c1, size_t c2, size_t start_row, size_t end_row)
 {
     for (size_t row = start_row; row < end_row; row++)
     {
@@ -2226,275 +1770,82 @@ inline void matrix<T, N, M>::swap_columns(matrix<TO, NO, MO>& matrix, size_t c1,
     }
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<typename>
-T matrix<T, N, M>::determinant() const
+T matrix<T, N, M, L>::determinant() const
 {
-    constexpr size_t S = N;
-
-    auto copy = *this;
-
-    //gaussian algorithm is used to turn this matrix into triangular matrix
-    //in order to efficently calculate determinant
-
-    T determinant_sign = get_multiplicative_identity<T>;
-    T determinant_value = get_multiplicative_identity<T>;
-
-    for (size_t diagonal = 0; diagonal < S; diagonal++)
+    if constexpr (!std::is_same_v<L, row_major> && !(L::is_strided && detail::use_closed_form_v<N>))
     {
-        //if current diagonal element is equal to 0 we are trying to find row below diagonal row in which
-        //element on current diagonal column is not equal to 0
-
-        if (equal(copy._mat[diagonal][diagonal], get_additive_identity<T>()))
-        {
-            size_t non_zero_row = diagonal;
-
-            for (size_t row = diagonal + 1; row < S; row++)
-            {
-                if (!equal(copy._mat[row][diagonal], get_additive_identity<T>()))
-                {
-                    non_zero_row = row;
-                    break;
-                }
-            }
-
-            if (non_zero_row != diagonal)
-            {
-                //if non zero row is found we swap current diagonal row with found row
-                //and change the sign of determinant
-                swap_rows(copy, diagonal, non_zero_row, diagonal);
-
-                determinant_sign = -determinant_sign;
-            }
-            else
-            {
-                //if non zero row is not found then it implies that matrix determinant is equal to 0
-                return get_additive_identity<T>();
-            }
-        }
-
-        //subtracting this row from rows below in order to obtain 0 in elements
-        //below current diagonal element
-#if USE_OPENMP
-        if (is_big_matrix)
-        {
-#pragma omp parallel for
-            for (int row = static_cast<int>(diagonal + 1); row < static_cast<int>(S); row++)
-            {
-                //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-                T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
-
-                //subtracting diagonal row multiplied by factor from current row
-                //elements with column < diagonal are already 0 from previous iterations
-                for (size_t column = diagonal; column < S; column++)
-                {
-                    copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-                }
-            }
-        }
-        else
-        {
-            for (size_t row = diagonal + 1; row < S; row++)
-            {
-                //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-                T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
-
-                //subtracting diagonal row multiplied by factor from current row
-                //elements with column < diagonal are already 0 from previous iterations
-                for (size_t column = diagonal; column < S; column++)
-                {
-                    copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-                }
-            }
-        }
-#else
-        for (size_t row = diagonal + 1; row < S; row++)
-        {
-            //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-            T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
-
-            //subtracting diagonal row multiplied by factor from current row
-            //elements with column < diagonal are already 0 from previous iterations
-            for (size_t column = diagonal; column < S; column++)
-            {
-                copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-            }
-        }
-#endif
-        determinant_value *= copy._mat[diagonal][diagonal];
+        //column-major storage is row-major storage of transposition (which has the same determinant)
+        return matrix<T, N, M>(*this).determinant();
+    }
+    else if constexpr (detail::use_closed_form_v<N>)
+    {
+        return detail::closed_form_determinant<T, N>(data());
+    }
+    else
+    {
+        //determinant is product of diagonal of U from LU factorization (with sign of row permutation)
+        detail::scratch_temporaries scratch;
+        return lu_decomposition<T, N>(*this).determinant();
     }
-    return determinant_value * determinant_sign;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<typename>
-std::optional<matrix<T, N, M>> matrix<T, N, M>::inverted() const
+std::optional<matrix<T, N, M, L>> matrix<T, N, M, L>::inverted() const
 {
-    constexpr size_t S = N;
-
-    //trying to convert this matrix to identity matrix
-    //by gaussian algorithm to obtain inverse matrix
-
-    matrix<T, S, S * 2> copy(*this);
-
-    //right part of the larger matrix is identity matrix
-    //so we need to initialize its diagonal elements to 1
-    for (size_t diagonal = 0; diagonal < S; diagonal++)
+    if constexpr (!std::is_same_v<L, row_major> && !(L::is_strided && detail::use_closed_form_v<N>))
     {
-        copy._mat[diagonal][S + diagonal] = get_multiplicative_identity<T>();
-    }
-
-    for (size_t diagonal = 0; diagonal < S; diagonal++)
-    {
-        //if current diagonal element is equal to 0 we are trying to find row below diagonal row in which
-        //element on current diagonal column is not equal to 0
+        //factorization works on row-major matrices
+        auto inverse = matrix<T, N, M>(*this).inverted();
 
-        if (equal(copy._mat[diagonal][diagonal], get_additive_identity<T>()))
+        if (!inverse)
         {
-            size_t non_zero_row = diagonal;
-
-            for (size_t row = diagonal + 1; row < S; row++)
-            {
-                if (!equal(copy._mat[row][diagonal], get_additive_identity<T>()))
-                {
-                    non_zero_row = row;
-                    break;
-                }
-            }
-
-            if (non_zero_row != diagonal)
-            {
-                //if non zero row is found we swap current diagonal row with found row
-                swap_rows(copy, diagonal, non_zero_row, diagonal);
-            }
-            else
-            {
-                //if non zero row is not found then it implies that matrix has no inverse
-                return std::nullopt;
-            }
+            return std::nullopt;
         }
 
-        //dividing diagonal row by diagonal element to obtain 1 on diagonal element
-        T factor = copy._mat[diagonal][diagonal];
-        for (size_t column = diagonal; column < S * 2; column++)
-        {
-            copy._mat[diagonal][column] /= factor;
-        }
+        return matrix<T, N, M, L>(*inverse);
+    }
+    else if constexpr (detail::use_closed_form_v<N>)
+    {
+        //inverse of transposition is transposition of inverse, so column-major storages are inverted as row-major ones
+        matrix<T, N, M, L> inverse;
 
-#if USE_OPENMP
-        if (is_big_matrix)
+        if (!detail::closed_form_inverse<T, N>(data(), inverse.data()))
         {
-            //subtracting this row from rows above in order to obtain 0 in elements
-            //above current diagonal element
-#pragma omp parallel for
-            for (int row = 0; row < static_cast<int>(diagonal); row++)
-            {
-                //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-                T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
-
-                //subtracting diagonal row multiplied by factor from current row
-                //elements with column < diagonal are already 0 from previous iterations
-                for (size_t column = diagonal; column < S * 2; column++)
-                {
-                    copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-                }
-            }
-            //subtracting this row from rows below in order to obtain 0 in elements
-            //below current diagonal element
-#pragma omp parallel for
-            for (int row = static_cast<int>(diagonal + 1); row < static_cast<int>(S); row++)
-            {
-                //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-                T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
-
-                //subtracting diagonal row multiplied by factor from current row
-                //elements with column < diagonal are already 0 from previous iterations
-                for (size_t column = diagonal; column < S * 2; column++)
-                {
-                    copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-                }
-            }
+            return std::nullopt;
         }
-        else
-        {
-            //subtracting this row from rows above in order to obtain 0 in elements
-            //above current diagonal element
-            for (size_t row = 0; row < diagonal; row++)
-            {
-                //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-                T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
 
-                //subtracting diagonal row multiplied by factor from current row
-                //elements with column < diagonal are already 0 from previous iterations
-                for (size_t column = diagonal; column < S * 2; column++)
-                {
-                    copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-                }
-            }
-            //subtracting this row from rows below in order to obtain 0 in elements
-            //below current diagonal element
-            for (size_t row = diagonal + 1; row < S; row++)
-            {
-                //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-                T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
+        return inverse;
+    }
+    else
+    {
+        //inverse is obtained by solving A * X = I using LU factors
+        //identity (result) is allocated before scratch scope, factors are temporaries
+        matrix<T, N, M, L> identity;
 
-                //subtracting diagonal row multiplied by factor from current row
-                //elements with column < diagonal are already 0 from previous iterations
-                for (size_t column = diagonal; column < S * 2; column++)
-                {
-                    copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-                }
-            }
-        }
-#else
-        //subtracting this row from rows above in order to obtain 0 in elements
-        //above current diagonal element
-        for (size_t row = 0; row < diagonal; row++)
+        for (size_t diagonal = 0; diagonal < N; diagonal++)
         {
-            //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-            T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
-
-            //subtracting diagonal row multiplied by factor from current row
-            //elements with column < diagonal are already 0 from previous iterations
-            for (size_t column = diagonal; column < S * 2; column++)
-            {
-                copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-            }
+            identity._mat[diagonal][diagonal] = get_multiplicative_identity<T>();
         }
-        //subtracting this row from rows below in order to obtain 0 in elements
-        //below current diagonal element
-        for (size_t row = diagonal + 1; row < S; row++)
-        {
-            //factor from equation -> 0 = matrix[row][diagonal] - factor*matrix[diagonal][diagonal] (0 is what we want to get on this element)
-            T factor = copy._mat[row][diagonal] / copy._mat[diagonal][diagonal];
 
-            //subtracting diagonal row multiplied by factor from current row
-            //elements with column < diagonal are already 0 from previous iterations
-            for (size_t column = diagonal; column < S * 2; column++)
-            {
-                copy._mat[row][column] -= copy._mat[diagonal][column] * factor;
-            }
-        }
-#endif
+        detail::scratch_temporaries scratch;
+        return lu_decomposition<T, N>(*this).solve(std::move(identity));
     }
+}
 
-    //right part of the larger matrix is now our inverse to this matrix
-    matrix<T, S, S> result;
+template<class T, size_t N, size_t M, class L>
+size_t matrix<T, N, M, L>::rank() const
+{
+    detail::scratch_temporaries scratch;
 
-    for (size_t row = 0; row < S; row++)
+    if constexpr (has_sqrt_implementation_v<T> && has_abs_implementation_v<T> && has_epsilon_implementation_v<T>)
     {
-        for (size_t column = 0; column < S; column++)
-        {
-            result._mat[row][column] = copy._mat[row][column + S];
-        }
+        //elimination below compares with exact zeros, so rounding errors would make dependent rows independent
+        return singular_value_decomposition<T, N, M>(matrix<T, N, M>(*this), false).rank();
     }
 
-    return std::optional<matrix<T, N, M>>(result);
-}
-
-template<class T, size_t N, size_t M>
-size_t matrix<T, N, M>::rank() const
-{
     auto copy = *this;
 
     if constexpr (N <= M)
@@ -2619,58 +1970,89 @@ size_t matrix<T, N, M>::rank() const
     }
 }
 
-template<class T, size_t N, size_t M>
-matrix<T, M, N> matrix<T, N, M>::transposed() const
+template<class T, size_t N, size_t M, class L>
+size_t matrix<T, N, M, L>::rank(const T& tolerance) const
+{
+    detail::scratch_temporaries scratch;
+    return singular_value_decomposition<T, N, M>(matrix<T, N, M>(*this), false).rank(tolerance);
+}
+
+template<class T, size_t N, size_t M, class L>
+matrix<T, M, N, L> matrix<T, N, M, L>::pseudo_inverse() const
+{
+    //result is allocated before scratch scope, factors are temporaries
+    matrix<T, M, N, L> result;
+
+    detail::scratch_temporaries scratch;
+    const matrix<T, M, N> inverse = singular_value_decomposition<T, N, M>(matrix<T, N, M>(*this)).pseudo_inverse();
+    result = inverse;
+
+    return result;
+}
+
+template<class T, size_t N, size_t M, class L>
+T matrix<T, N, M, L>::condition_number() const
+{
+    detail::scratch_temporaries scratch;
+    return singular_value_decomposition<T, N, M>(matrix<T, N, M>(*this), false).condition_number();
+}
+
+template<class T, size_t N, size_t M, class L>
+matrix<T, M, N, L> matrix<T, N, M, L>::transposed() const
 {
-    matrix<T, M, N> result;
+    matrix<T, M, N, L> result;
 
-    //switching columns with rows
-#if USE_OPENMP
-    if (is_big_matrix)
+    if constexpr (std::is_same_v<L, row_major>)
     {
-#pragma omp parallel for
-        for (int row = 0; row < static_cast<int>(N); row++)
-        {
-            for (size_t column = 0; column < M; column++)
-            {
-                result._mat[column][row] = _mat[row][column];
-            }
-        }
+        detail::transpose_matrix(N, M, data(), M, result.data(), N, detail::parallel_copy(storage_size * sizeof(T)));
+    }
+    else if constexpr (std::is_same_v<L, column_major>)
+    {
+        //column-major storage is row-major storage of M x N transposition
+        detail::transpose_matrix(M, N, data(), N, result.data(), M, detail::parallel_copy(storage_size * sizeof(T)));
+    }
+    else if constexpr (detail::is_tiled_layout_v<L>)
+    {
+        detail::transpose_tiles<L::tile_size>(L::tiles(N), L::tiles(M), data(), result.data(), detail::parallel_copy(storage_size * sizeof(T)));
     }
     else
     {
-        for (size_t row = 0; row < N; row++)
-        {
+        //switching columns with rows
+        detail::parallel_for(N, detail::parallel_copy(storage_size * sizeof(T)), [&](size_t row) {
             for (size_t column = 0; column < M; column++)
             {
                 result._mat[column][row] = _mat[row][column];
             }
-        }
-    }
-#else
-    for (size_t row = 0; row < N; row++)
-    {
-        for (size_t column = 0; column < M; column++)
-        {
-            result._mat[column][row] = _mat[row][column];
-        }
+        });
     }
-#endif
 
     return result;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<typename>
-matrix<T, M, N>& matrix<T, N, M>::transpose()
+matrix<T, M, N, L>& matrix<T, N, M, L>::transpose()
 {
-    *this = transposed();
+    //square matrices are transposed in place (transposed storage of square strided matrix is storage of its transposition)
+    if constexpr (L::is_strided)
+    {
+        detail::transpose_in_place(N, data(), N, detail::parallel_copy(storage_size * sizeof(T)));
+    }
+    else if constexpr (detail::is_tiled_layout_v<L>)
+    {
+        detail::transpose_tiles_in_place<L::tile_size>(L::tiles(N), data(), detail::parallel_copy(storage_size * sizeof(T)));
+    }
+    else
+    {
+        *this = transposed();
+    }
+
     return *this;
 }
 
-template<class T, size_t N, size_t M>
+template<class T, size_t N, size_t M, class L>
 template<typename>
-const matrix<T, N, M>& matrix<T, N, M>::MULTIPLICATIVE_IDENTITY()
+const matrix<T, N, M, L>& matrix<T, N, M, L>::MULTIPLICATIVE_IDENTITY()
 {
     constexpr size_t S = N;
 
@@ -2687,20 +2069,20 @@ const matrix<T, N, M>& matrix<T, N, M>::MULTIPLICATIVE_IDENTITY()
     return _identity;
 }
 
-template<class T, size_t N, size_t M>
-const matrix<T, N, M>& matrix<T, N, M>::ADDITIVE_IDENTITY()
+template<class T, size_t N, size_t M, class L>
+const matrix<T, N, M, L>& matrix<T, N, M, L>::ADDITIVE_IDENTITY()
 {
     constexpr size_t S = N;
 
-    static matrix<T, N, M> _identity;
+    static matrix<T, N, M, L> _identity;
 
     return _identity;
 }
 
 NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
 
-template<class TO, size_t NO, size_t MO>
-std::ostream& operator<<(std::ostream& os, const matrix<TO, NO, MO>& m)
+template<class TO, size_t NO, size_t MO, class LO>
+std::ostream& operator<<(std::ostream& os, const matrix<TO, NO, MO, LO>& m)
 {
     for (size_t row = 0; row < NO - 1; row++)
     {
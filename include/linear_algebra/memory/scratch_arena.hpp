@@ -0,0 +1,248 @@
+#pragma once
+
+#include "storage_allocator.hpp"
+
+#include <cstddef>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// bump allocator for temporary matrices and vectors
+/// <para>allocation moves pointer forward, deallocation does nothing, memory is reclaimed by rewinding arena to marker
+/// (scratch_scope does it automatically)</para>
+/// <para>chunks taken from upstream resource are kept after rewind, so once arena has grown to peak usage
+/// it does not allocate anymore</para>
+/// <para>arena is not thread safe, every thread should use its own (see thread_scratch_arena)</para>
+///</summary>
+class scratch_arena : public std::pmr::memory_resource
+{
+public:
+    //position in arena, memory allocated after marker was taken is released by rewind
+    struct marker
+    {
+        size_t chunk;
+        size_t offset;
+    };
+
+    //size of first chunk taken from upstream resource (next chunks are at least twice as big as previous one)
+    static constexpr size_t default_chunk_size = size_t(1) << 20;
+private:
+    struct chunk
+    {
+        std::byte* data;
+        size_t size;
+        bool owned;
+    };
+
+    std::vector<chunk> _chunks;
+    size_t _chunk = 0;
+    size_t _offset = 0;
+    std::pmr::memory_resource* _upstream;
+private:
+    void add_chunk(size_t minimal_size)
+    {
+        size_t size = _chunks.empty() ? default_chunk_size : _chunks.back().size * 2;
+        size = size > minimal_size ? size : minimal_size;
+
+        _chunks.push_back(chunk{ static_cast<std::byte*>(_upstream->allocate(size, storage_alignment)), size, true });
+    }
+public:
+    //arena growing from upstream resource when needed
+    explicit scratch_arena(std::pmr::memory_resource* upstream = aligned_storage_resource()) :
+        _upstream(upstream)
+    {
+    }
+
+    //caller supplied workspace is used first, arena grows from upstream resource only when it is exhausted
+    scratch_arena(void* buffer, size_t size, std::pmr::memory_resource* upstream = aligned_storage_resource()) :
+        _upstream(upstream)
+    {
+        _chunks.push_back(chunk{ static_cast<std::byte*>(buffer), size, false });
+    }
+
+    scratch_arena(const scratch_arena& other) = delete;
+    scratch_arena& operator=(const scratch_arena& other) = delete;
+
+    ~scratch_arena()
+    {
+        release();
+    }
+public:
+    marker mark() const
+    {
+        return marker{ _chunk, _offset };
+    }
+
+    //releases memory allocated after marker was taken (chunks are kept for next allocations)
+    void rewind(const marker& m)
+    {
+        _chunk = m.chunk;
+        _offset = m.offset;
+    }
+
+    //returns owned chunks to upstream resource (all memory allocated from arena is released)
+    void release()
+    {
+        std::vector<chunk> kept;
+
+        for (const chunk& c : _chunks)
+        {
+            if (c.owned)
+            {
+                _upstream->deallocate(c.data, c.size, storage_alignment);
+            }
+            else
+            {
+                kept.push_back(c);
+            }
+        }
+
+        _chunks = std::move(kept);
+        _chunk = 0;
+        _offset = 0;
+    }
+
+    //bytes that can be allocated without taking new chunk from upstream resource (including already allocated ones)
+    size_t capacity() const
+    {
+        size_t capacity = 0;
+
+        for (const chunk& c : _chunks)
+        {
+            capacity += c.size;
+        }
+
+        return capacity;
+    }
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        alignment = alignment > storage_alignment ? alignment : storage_alignment;
+
+        while (true)
+        {
+            if (_chunk < _chunks.size())
+            {
+                const chunk& c = _chunks[_chunk];
+                const size_t address = reinterpret_cast<size_t>(c.data) + _offset;
+                const size_t aligned_offset = _offset + (alignment - address % alignment) % alignment;
+
+                if (aligned_offset + bytes <= c.size)
+                {
+                    _offset = aligned_offset + bytes;
+                    return c.data + aligned_offset;
+                }
+
+                //rest of current chunk is skipped
+                _chunk++;
+                _offset = 0;
+            }
+            else
+            {
+                add_chunk(bytes + alignment);
+            }
+        }
+    }
+
+    void do_deallocate(void*, size_t, size_t) override
+    {
+        //memory is reclaimed by rewind
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+//arena used by scratch_scope of current thread
+inline scratch_arena& thread_scratch_arena()
+{
+    static thread_local scratch_arena arena;
+    return arena;
+}
+
+///<summary>
+/// matrices, vectors and kernel buffers created by current thread while scope is alive are allocated from scratch arena,
+/// destructor rewinds arena, so their memory is reused by next scope (no heap allocations after warm-up)
+/// <para>storage allocated inside scope must not be used after scope ends (results must be created before scope or copied out)</para>
+/// <para>scopes on the same arena must be destroyed in reverse order of creation</para>
+/// <para>storage created by other threads (e.g by parallel kernels) uses their own resources</para>
+///</summary>
+class scratch_scope
+{
+private:
+    scratch_arena& _arena;
+    scratch_arena::marker _marker;
+    std::pmr::memory_resource* _outer_resource;
+    storage_resource_scope _resource_scope;
+public:
+    //uses arena of current thread
+    scratch_scope() :
+        scratch_scope(thread_scratch_arena())
+    {
+    }
+
+    //uses caller supplied arena (workspace)
+    explicit scratch_scope(scratch_arena& arena) :
+        _arena(arena),
+        _marker(arena.mark()),
+        _outer_resource(get_storage_resource()),
+        _resource_scope(&arena)
+    {
+    }
+
+    scratch_scope(const scratch_scope& other) = delete;
+    scratch_scope& operator=(const scratch_scope& other) = delete;
+
+    ~scratch_scope()
+    {
+        _arena.rewind(_marker);
+    }
+public:
+    scratch_arena& arena() const
+    {
+        return _arena;
+    }
+
+    //resource used before scope was created
+    std::pmr::memory_resource* outer_resource() const
+    {
+        return _outer_resource;
+    }
+};
+
+namespace detail
+{
+    ///<summary>
+    /// scope of temporaries of library routines (copies of inputs, factors, kernel buffers)
+    /// <para>opens scratch_scope on arena of current thread, unless caller already allocates from it
+    /// (then temporaries are released together with rest of caller's scope)</para>
+    /// <para>results of routine have to be created with outer_resource() (see storage_resource_scope)</para>
+    ///</summary>
+    class scratch_temporaries
+    {
+    private:
+        std::pmr::memory_resource* _outer_resource;
+        std::optional<scratch_scope> _scope;
+    public:
+        scratch_temporaries() :
+            _outer_resource(get_storage_resource())
+        {
+            if (_outer_resource != &thread_scratch_arena())
+            {
+                _scope.emplace();
+            }
+        }
+
+        scratch_temporaries(const scratch_temporaries& other) = delete;
+        scratch_temporaries& operator=(const scratch_temporaries& other) = delete;
+    public:
+        std::pmr::memory_resource* outer_resource() const
+        {
+            return _outer_resource;
+        }
+    };
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
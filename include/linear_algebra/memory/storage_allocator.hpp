@@ -0,0 +1,220 @@
+#pragma once
+
+#include "../linear_algebra_common.hpp"
+
+#include <memory>
+#include <memory_resource>
+#include <atomic>
+#include <new>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+//alignment of dynamic storage of matrices and vectors (cache line, every simd register width divides it)
+constexpr size_t storage_alignment = 64;
+
+///<summary>
+/// default memory resource of matrix/vector storage, every block is aligned to at least storage_alignment bytes
+/// <para>blocks are allocated with aligned operator new, so it is as thread safe as global heap</para>
+///</summary>
+class aligned_memory_resource : public std::pmr::memory_resource
+{
+private:
+    static constexpr size_t block_alignment(size_t alignment)
+    {
+        return alignment > storage_alignment ? alignment : storage_alignment;
+    }
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        return ::operator new(bytes, std::align_val_t(block_alignment(alignment)));
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        ::operator delete(p, bytes, std::align_val_t(block_alignment(alignment)));
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return dynamic_cast<const aligned_memory_resource*>(&other) != nullptr;
+    }
+};
+
+namespace detail
+{
+    inline std::atomic<std::pmr::memory_resource*>& storage_resource_pointer()
+    {
+        static std::atomic<std::pmr::memory_resource*> resource{ nullptr };
+        return resource;
+    }
+
+    //resource set for current thread only (by storage_resource_scope), it takes precedence over global one
+    inline std::pmr::memory_resource*& thread_storage_resource_pointer()
+    {
+        static thread_local std::pmr::memory_resource* resource = nullptr;
+        return resource;
+    }
+}
+
+//resource used when no other one was set
+inline aligned_memory_resource* aligned_storage_resource()
+{
+    static aligned_memory_resource resource;
+    return &resource;
+}
+
+//resource used by storage of matrices and vectors created from now on by current thread
+inline std::pmr::memory_resource* get_storage_resource()
+{
+    if (std::pmr::memory_resource* resource = detail::thread_storage_resource_pointer())
+    {
+        return resource;
+    }
+
+    std::pmr::memory_resource* resource = detail::storage_resource_pointer().load(std::memory_order_acquire);
+    return resource ? resource : aligned_storage_resource();
+}
+
+///<summary>
+/// replaces resource used by storage of matrices and vectors created from now on (nullptr restores aligned_storage_resource)
+/// <para>every storage remembers resource it was allocated from, so resource must outlive all storage allocated from it</para>
+/// <para>arena, pool or huge page allocators can be used by passing std::pmr resources
+/// (e.g std::pmr::monotonic_buffer_resource, std::pmr::synchronized_pool_resource) or custom std::pmr::memory_resource</para>
+/// <para>resource can be used by many threads at once, so it has to be thread safe if matrices are created in parallel</para>
+///</summary>
+/// <returns> previously set resource </returns>
+inline std::pmr::memory_resource* set_storage_resource(std::pmr::memory_resource* resource)
+{
+    return detail::storage_resource_pointer().exchange(resource, std::memory_order_acq_rel);
+}
+
+///<summary>
+/// storage of matrices and vectors created by current thread while scope is alive uses given resource
+/// <para>scopes can be nested, destructor restores resource used before scope was created</para>
+///</summary>
+class storage_resource_scope
+{
+private:
+    std::pmr::memory_resource* _previous;
+public:
+    explicit storage_resource_scope(std::pmr::memory_resource* resource) :
+        _previous(detail::thread_storage_resource_pointer())
+    {
+        detail::thread_storage_resource_pointer() = resource;
+    }
+
+    storage_resource_scope(const storage_resource_scope& other) = delete;
+    storage_resource_scope& operator=(const storage_resource_scope& other) = delete;
+
+    ~storage_resource_scope()
+    {
+        detail::thread_storage_resource_pointer() = _previous;
+    }
+};
+
+///<summary>
+/// allocator of matrix/vector storage, memory is taken from std::pmr::memory_resource and aligned to storage_alignment bytes
+/// <para>default constructed allocator uses get_storage_resource(),
+/// copies of containers use resource current at the time of copy (not resource of copied container)</para>
+///</summary>
+template<class T>
+class storage_allocator
+{
+    template<class TO>
+    friend class storage_allocator;
+private:
+    std::pmr::memory_resource* _resource;
+public:
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+public:
+    storage_allocator() noexcept :
+        _resource(get_storage_resource())
+    {
+    }
+
+    storage_allocator(std::pmr::memory_resource* resource) noexcept :
+        _resource(resource)
+    {
+    }
+
+    storage_allocator(const storage_allocator<T>& other) noexcept = default;
+
+    template<class TO>
+    storage_allocator(const storage_allocator<TO>& other) noexcept :
+        _resource(other._resource)
+    {
+    }
+public:
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(_resource->allocate(n * sizeof(T), alignof(T) > storage_alignment ? alignof(T) : storage_alignment));
+    }
+
+    void deallocate(T* p, size_t n)
+    {
+        _resource->deallocate(p, n * sizeof(T), alignof(T) > storage_alignment ? alignof(T) : storage_alignment);
+    }
+
+    storage_allocator<T> select_on_container_copy_construction() const
+    {
+        return storage_allocator<T>();
+    }
+
+    std::pmr::memory_resource* resource() const
+    {
+        return _resource;
+    }
+public:
+    template<class TO>
+    bool operator==(const storage_allocator<TO>& other) const
+    {
+        return _resource == other._resource || _resource->is_equal(*other._resource);
+    }
+
+    template<class TO>
+    bool operator!=(const storage_allocator<TO>& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+namespace detail
+{
+    //storage of containers with runtime sizes and of temporary buffers of kernels
+    template<class T>
+    using storage_vector = std::vector<T, storage_allocator<T>>;
+
+    //elements of storage of constant size are default initialized (as by new T[n])
+
+    template<class T>
+    inline T* storage_allocate(storage_allocator<T>& allocator, size_t n)
+    {
+        T* p = allocator.allocate(n);
+
+        try
+        {
+            std::uninitialized_default_construct_n(p, n);
+        }
+        catch (...)
+        {
+            allocator.deallocate(p, n);
+            throw;
+        }
+
+        return p;
+    }
+
+    template<class T>
+    inline void storage_deallocate(storage_allocator<T>& allocator, T* p, size_t n)
+    {
+        std::destroy_n(p, n);
+        allocator.deallocate(p, n);
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../linear_algebra_common.hpp"
+#include "../memory/storage_allocator.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //whether current thread executes range of parallel loop (nested loops are executed inline, so threads are not oversubscribed)
+    inline bool& inside_parallel_task()
+    {
+        static thread_local bool inside = false;
+        return inside;
+    }
+
+    //marks current thread as executing range of parallel loop while alive
+    //resource set for thread (e.g its scratch arena) is cleared, so storage created by range does not depend on thread executing it
+    //(thread may execute ranges of loops started by other threads, whose storage must not live in memory rewound by its own scopes)
+    class parallel_task_scope
+    {
+    private:
+        bool _previous;
+        std::pmr::memory_resource* _previous_resource;
+    public:
+        parallel_task_scope() :
+            _previous(inside_parallel_task()),
+            _previous_resource(thread_storage_resource_pointer())
+        {
+            inside_parallel_task() = true;
+            thread_storage_resource_pointer() = nullptr;
+        }
+
+        parallel_task_scope(const parallel_task_scope& other) = delete;
+        parallel_task_scope& operator=(const parallel_task_scope& other) = delete;
+
+        ~parallel_task_scope()
+        {
+            thread_storage_resource_pointer() = _previous_resource;
+            inside_parallel_task() = _previous;
+        }
+    };
+}
+
+///<summary>
+/// non-owning reference to callable invoked with range [begin, end) of indices (body of parallel loop)
+/// <para>referenced callable must outlive reference (it is passed down to executor only for duration of parallel loop)</para>
+///</summary>
+class range_function
+{
+private:
+    const void* _function;
+    void(*_call)(const void*, size_t, size_t);
+public:
+    template<class F, typename = typename std::enable_if_t<!std::is_same_v<std::decay_t<F>, range_function>>>
+    range_function(const F& function) :
+        _function(&function),
+        _call([](const void* function, size_t begin, size_t end) { (*static_cast<const F*>(function))(begin, end); })
+    {
+    }
+
+    void operator()(size_t begin, size_t end) const
+    {
+        _call(_function, begin, end);
+    }
+};
+
+///<summary>
+/// executes parallel loops of library (element-wise operators of big matrices, gemm, factorizations, ...)
+/// <para>applications with their own thread pools can implement this interface to run loops of library on them
+/// (see set_executor and executor_scope), by default work_stealing_executor is used</para>
+///</summary>
+class executor
+{
+public:
+    virtual ~executor() = default;
+public:
+    ///<summary>
+    /// calls body for disjoint ranges which together cover [0, n) and returns when all calls have finished
+    /// <para>ranges may be executed by many threads at once (including calling one), exception thrown by body is rethrown</para>
+    ///</summary>
+    virtual void parallel_for(size_t n, const range_function& body) = 0;
+
+    //number of threads which may execute ranges at once (including calling thread)
+    virtual size_t concurrency() const = 0;
+};
+
+///<summary>
+/// executes whole loop on calling thread (disables parallelism of library, e.g when it is called from threads of application's pool)
+///</summary>
+class inline_executor : public executor
+{
+public:
+    void parallel_for(size_t n, const range_function& body) override
+    {
+        if (n != 0)
+        {
+            body(0, n);
+        }
+    }
+
+    size_t concurrency() const override
+    {
+        return 1;
+    }
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
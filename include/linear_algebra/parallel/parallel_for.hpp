@@ -0,0 +1,114 @@
+#pragma once
+
+#include "executor.hpp"
+#include "work_stealing_executor.hpp"
+#include "parallel_thresholds.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+//executor used when no other one was set, its threads are created on first parallel loop (one per hardware thread)
+inline work_stealing_executor& default_executor()
+{
+    static work_stealing_executor executor;
+    return executor;
+}
+
+namespace detail
+{
+    inline std::atomic<executor*>& executor_pointer()
+    {
+        static std::atomic<executor*> pointer{ nullptr };
+        return pointer;
+    }
+
+    inline executor*& thread_executor_pointer()
+    {
+        static thread_local executor* pointer = nullptr;
+        return pointer;
+    }
+}
+
+//executor running parallel loops started from now on by current thread
+inline executor* get_executor()
+{
+    if (executor* e = detail::thread_executor_pointer())
+    {
+        return e;
+    }
+
+    executor* e = detail::executor_pointer().load(std::memory_order_acquire);
+    return e ? e : &default_executor();
+}
+
+///<summary>
+/// replaces executor running parallel loops started from now on (nullptr restores default_executor)
+/// <para>executor must outlive all loops started on it, it is used by many threads at once, so it has to be thread safe</para>
+///</summary>
+/// <returns> previously set executor </returns>
+inline executor* set_executor(executor* e)
+{
+    return detail::executor_pointer().exchange(e, std::memory_order_acq_rel);
+}
+
+///<summary>
+/// parallel loops started by current thread while scope is alive are run by given executor
+/// (e.g inline_executor on threads of application's own pool)
+/// <para>scopes can be nested, destructor restores executor used before scope was created</para>
+///</summary>
+class executor_scope
+{
+private:
+    executor* _previous;
+public:
+    explicit executor_scope(executor* e) :
+        _previous(detail::thread_executor_pointer())
+    {
+        detail::thread_executor_pointer() = e;
+    }
+
+    executor_scope(const executor_scope& other) = delete;
+    executor_scope& operator=(const executor_scope& other) = delete;
+
+    ~executor_scope()
+    {
+        detail::thread_executor_pointer() = _previous;
+    }
+};
+
+namespace detail
+{
+    ///<summary>
+    /// calls body(index) for every index in [begin, end), indices are split over threads of current executor if parallel is set
+    /// <para>loops started inside other parallel loops are executed inline</para>
+    ///</summary>
+    template<class F>
+    inline void parallel_for(size_t begin, size_t end, bool parallel, F&& body)
+    {
+#if USE_THREADS
+        if (parallel && end > begin + 1 && !inside_parallel_task())
+        {
+            auto range_body = [&](size_t range_begin, size_t range_end) {
+                for (size_t index = begin + range_begin; index < begin + range_end; index++)
+                {
+                    body(index);
+                }
+            };
+
+            get_executor()->parallel_for(end - begin, range_body);
+            return;
+        }
+#endif
+        for (size_t index = begin; index < end; index++)
+        {
+            body(index);
+        }
+    }
+
+    template<class F>
+    inline void parallel_for(size_t n, bool parallel, F&& body)
+    {
+        parallel_for(0, n, parallel, body);
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
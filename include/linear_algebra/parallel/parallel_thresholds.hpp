@@ -0,0 +1,165 @@
+#pragma once
+
+#include "../linear_algebra_common.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <string>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// amounts of work above which loops of library are split over threads of executor (see parallel_for.hpp)
+/// <para>every kind of operation has its own cost model, so cheap memory bound loops (copies) need much more elements
+/// to go parallel than compute bound ones (matrix products)</para>
+/// <para>defaults are conservative, auto_tune_parallel_thresholds measures crossovers on current host</para>
+///</summary>
+struct parallel_thresholds
+{
+    //value disabling parallelization of given kind of operation
+    static constexpr size_t never = std::numeric_limits<size_t>::max();
+
+    //bytes written by copy (construction, assignment, conversion, transposition)
+    size_t copy = size_t(1) << 20;
+    //elements of element-wise operation (addition, scaling, comparison, ...)
+    size_t elementwise = size_t(1) << 16;
+    //multiply-adds of matrix product (m * n * k)
+    size_t gemm = size_t(1) << 18;
+    //multiply-adds of single elimination step (update of trailing rows x columns submatrix)
+    size_t elimination = size_t(1) << 16;
+};
+
+namespace detail
+{
+    struct atomic_parallel_thresholds
+    {
+        std::atomic<size_t> copy;
+        std::atomic<size_t> elementwise;
+        std::atomic<size_t> gemm;
+        std::atomic<size_t> elimination;
+    };
+
+    inline atomic_parallel_thresholds& current_parallel_thresholds()
+    {
+        static atomic_parallel_thresholds thresholds{
+            parallel_thresholds().copy,
+            parallel_thresholds().elementwise,
+            parallel_thresholds().gemm,
+            parallel_thresholds().elimination
+        };
+        return thresholds;
+    }
+
+    //cost models used to decide whether loop is split over threads
+
+    inline bool parallel_copy(size_t bytes)
+    {
+        return use_threads && bytes >= current_parallel_thresholds().copy.load(std::memory_order_relaxed);
+    }
+
+    inline bool parallel_elementwise(size_t elements)
+    {
+        return use_threads && elements >= current_parallel_thresholds().elementwise.load(std::memory_order_relaxed);
+    }
+
+    inline bool parallel_gemm(size_t m, size_t n, size_t k)
+    {
+        return use_threads && m * n * k >= current_parallel_thresholds().gemm.load(std::memory_order_relaxed);
+    }
+
+    inline bool parallel_elimination(size_t rows, size_t columns)
+    {
+        return use_threads && rows * columns >= current_parallel_thresholds().elimination.load(std::memory_order_relaxed);
+    }
+}
+
+//thresholds currently used by library
+inline parallel_thresholds get_parallel_thresholds()
+{
+    const detail::atomic_parallel_thresholds& current = detail::current_parallel_thresholds();
+
+    parallel_thresholds thresholds;
+    thresholds.copy = current.copy.load(std::memory_order_relaxed);
+    thresholds.elementwise = current.elementwise.load(std::memory_order_relaxed);
+    thresholds.gemm = current.gemm.load(std::memory_order_relaxed);
+    thresholds.elimination = current.elimination.load(std::memory_order_relaxed);
+    return thresholds;
+}
+
+//replaces thresholds used by operations started from now on (by all threads)
+inline void set_parallel_thresholds(const parallel_thresholds& thresholds)
+{
+    detail::atomic_parallel_thresholds& current = detail::current_parallel_thresholds();
+
+    current.copy.store(thresholds.copy, std::memory_order_relaxed);
+    current.elementwise.store(thresholds.elementwise, std::memory_order_relaxed);
+    current.gemm.store(thresholds.gemm, std::memory_order_relaxed);
+    current.elimination.store(thresholds.elimination, std::memory_order_relaxed);
+}
+
+///<summary>
+/// writes thresholds to text file (one "name value" pair per line)
+///</summary>
+/// <returns> whether file was written </returns>
+inline bool save_parallel_thresholds(const parallel_thresholds& thresholds, const std::string& path)
+{
+    std::ofstream file(path);
+
+    file << "copy " << thresholds.copy << '\n';
+    file << "elementwise " << thresholds.elementwise << '\n';
+    file << "gemm " << thresholds.gemm << '\n';
+    file << "elimination " << thresholds.elimination << '\n';
+
+    return static_cast<bool>(file);
+}
+
+///<summary>
+/// reads thresholds written by save_parallel_thresholds (thresholds missing in file keep default values)
+///</summary>
+/// <returns> thresholds or std::nullopt if file could not be read </returns>
+inline std::optional<parallel_thresholds> load_parallel_thresholds(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        return std::nullopt;
+    }
+
+    parallel_thresholds thresholds;
+
+    std::string name;
+    size_t value;
+    while (file >> name >> value)
+    {
+        if (name == "copy")
+        {
+            thresholds.copy = value;
+        }
+        else if (name == "elementwise")
+        {
+            thresholds.elementwise = value;
+        }
+        else if (name == "gemm")
+        {
+            thresholds.gemm = value;
+        }
+        else if (name == "elimination")
+        {
+            thresholds.elimination = value;
+        }
+        else
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (!file.eof())
+    {
+        return std::nullopt;
+    }
+
+    return thresholds;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,157 @@
+#pragma once
+
+#include "parallel_for.hpp"
+#include "../kernels/elementwise.hpp"
+#include "../kernels/gemm.hpp"
+
+#include <chrono>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //parallel run has to be this many times faster than serial one to be chosen (covers noise of measurements)
+    constexpr double parallel_tuning_margin = 1.1;
+
+    //shortest of few runs of function (in seconds)
+    template<class F>
+    inline double measure_seconds(F&& function)
+    {
+        constexpr size_t repetitions = 5;
+
+        //first run warms up caches and wakes up threads of executor
+        function();
+
+        double best = std::numeric_limits<double>::max();
+        for (size_t repetition = 0; repetition < repetitions; repetition++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            function();
+            const auto end = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double>(end - start).count());
+        }
+
+        return best;
+    }
+
+    ///<summary>
+    /// smallest amount of work from which parallel runs are faster than serial ones for all measured sizes
+    /// <para>run(size, parallel) executes operation of given size, work(size) returns amount of work in units of threshold</para>
+    ///</summary>
+    /// <returns> threshold or parallel_thresholds::never if parallel run of biggest size is not faster </returns>
+    template<class R, class W>
+    inline size_t find_parallel_crossover(const std::vector<size_t>& sizes, R&& run, W&& work)
+    {
+        size_t crossover = parallel_thresholds::never;
+
+        for (size_t size : sizes)
+        {
+            const double serial = measure_seconds([&]() { run(size, false); });
+            const double parallel = measure_seconds([&]() { run(size, true); });
+
+            if (parallel * parallel_tuning_margin < serial)
+            {
+                crossover = std::min(crossover, work(size));
+            }
+            else
+            {
+                crossover = parallel_thresholds::never;
+            }
+        }
+
+        return crossover;
+    }
+}
+
+///<summary>
+/// measures for which sizes of operations parallel loops on current executor are faster than serial ones
+/// (copies, element-wise operations, matrix products and elimination steps on double precision numbers)
+/// <para>takes up to few seconds, result should be computed once per host and stored (see auto_tune_parallel_thresholds)</para>
+///</summary>
+inline parallel_thresholds tune_parallel_thresholds()
+{
+    parallel_thresholds thresholds;
+
+    if (!use_threads || get_executor()->concurrency() < 2)
+    {
+        thresholds.copy = parallel_thresholds::never;
+        thresholds.elementwise = parallel_thresholds::never;
+        thresholds.gemm = parallel_thresholds::never;
+        thresholds.elimination = parallel_thresholds::never;
+        return thresholds;
+    }
+
+    //sides of square matrices (number of elements for element-wise operations) measured for every kind of operation
+    const std::vector<size_t> copy_sides = { 32, 64, 128, 256, 512, 1024 };
+    const std::vector<size_t> elementwise_sizes = { size_t(1) << 10, size_t(1) << 12, size_t(1) << 14, size_t(1) << 16, size_t(1) << 18, size_t(1) << 20, size_t(1) << 22 };
+    const std::vector<size_t> gemm_sides = { 16, 32, 64, 128, 256, 512 };
+    const std::vector<size_t> elimination_sides = { 32, 64, 128, 256, 512, 1024 };
+
+    const size_t max_side = 1024;
+    const size_t max_elements = std::max(max_side * max_side, elementwise_sizes.back());
+
+    detail::storage_vector<double> x(max_elements, 1.0);
+    detail::storage_vector<double> y(max_elements, 2.0);
+    detail::storage_vector<double> out(max_elements, 0.0);
+
+    thresholds.copy = detail::find_parallel_crossover(copy_sides,
+        [&](size_t side, bool parallel) {
+            detail::parallel_for(side, parallel, [&](size_t row) {
+                std::copy(x.data() + row * side, x.data() + (row + 1) * side, out.data() + row * side);
+            });
+        },
+        [](size_t side) { return side * side * sizeof(double); }
+    );
+
+    thresholds.elementwise = detail::find_parallel_crossover(elementwise_sizes,
+        [&](size_t size, bool parallel) { detail::elementwise_add(size, x.data(), y.data(), out.data(), parallel); },
+        [](size_t size) { return size; }
+    );
+
+    thresholds.gemm = detail::find_parallel_crossover(gemm_sides,
+        [&](size_t side, bool parallel) {
+            detail::gemm<double>(side, side, side, 1.0, x.data(), side, 1, y.data(), side, 1, 0.0, out.data(), side, 1, parallel);
+        },
+        [](size_t side) { return side * side * side; }
+    );
+
+    //rank 1 update of trailing matrix (single step of gaussian elimination)
+    thresholds.elimination = detail::find_parallel_crossover(elimination_sides,
+        [&](size_t side, bool parallel) {
+            detail::parallel_for(side, parallel, [&](size_t row) {
+                const double factor = y[row] * 0.5;
+                double* updated_row = out.data() + row * side;
+
+                for (size_t column = 0; column < side; column++)
+                {
+                    updated_row[column] -= factor * x[column];
+                }
+            });
+        },
+        [](size_t side) { return side * side; }
+    );
+
+    return thresholds;
+}
+
+///<summary>
+/// sets thresholds stored in file or, if there is no such file (or it cannot be read), measures them
+/// with tune_parallel_thresholds and stores them in file, so host is measured only once
+///</summary>
+/// <returns> thresholds which are used from now on </returns>
+inline parallel_thresholds auto_tune_parallel_thresholds(const std::string& path)
+{
+    std::optional<parallel_thresholds> thresholds = load_parallel_thresholds(path);
+
+    if (!thresholds)
+    {
+        thresholds = tune_parallel_thresholds();
+        save_parallel_thresholds(*thresholds, path);
+    }
+
+    set_parallel_thresholds(*thresholds);
+    return *thresholds;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,233 @@
+#pragma once
+
+#include "executor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// persistent pool of threads executing parallel loops with work stealing
+/// <para>loop is split into ranges which are distributed over queues of workers, worker takes ranges from back of its own queue
+/// and when it is empty it steals from front of queues of other workers, so threads which finish early take over remaining work</para>
+/// <para>calling thread executes ranges too until whole loop is finished, loops started inside ranges (nested parallelism)
+/// are executed inline by thread executing range</para>
+/// <para>threads are created once (in constructor) and sleep while there is no work, so loops do not pay for creating threads</para>
+///</summary>
+class work_stealing_executor : public executor
+{
+public:
+    //ranges per thread of single loop (threads which finish early steal remaining ones)
+    static constexpr size_t ranges_per_thread = 4;
+private:
+    struct loop
+    {
+        const range_function* body;
+        std::atomic<size_t> remaining;
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+
+    struct range
+    {
+        loop* owner;
+        size_t begin;
+        size_t end;
+    };
+
+    struct worker_queue
+    {
+        std::mutex mutex;
+        std::deque<range> ranges;
+    };
+private:
+    size_t _concurrency;
+    std::vector<std::unique_ptr<worker_queue>> _queues;
+    std::vector<std::thread> _workers;
+
+    std::atomic<size_t> _queued_ranges{ 0 };
+    std::atomic<size_t> _next_queue{ 0 };
+
+    std::mutex _sleep_mutex;
+    std::condition_variable _wake;
+    bool _stopping = false;
+private:
+    static void execute(const range& r)
+    {
+        loop& l = *r.owner;
+
+        try
+        {
+            detail::parallel_task_scope task_scope;
+            (*l.body)(r.begin, r.end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(l.mutex);
+            if (!l.exception)
+            {
+                l.exception = std::current_exception();
+            }
+        }
+
+        //loop is owned by thread waiting for it, it must not be touched after it was notified
+        std::lock_guard<std::mutex> lock(l.mutex);
+        if (l.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            l.finished.notify_all();
+        }
+    }
+
+    bool pop(size_t queue, range& r)
+    {
+        worker_queue& q = *_queues[queue];
+        std::lock_guard<std::mutex> lock(q.mutex);
+
+        if (q.ranges.empty())
+        {
+            return false;
+        }
+
+        r = q.ranges.back();
+        q.ranges.pop_back();
+        _queued_ranges.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool steal(size_t thief, range& r)
+    {
+        for (size_t offset = 1; offset <= _queues.size(); offset++)
+        {
+            worker_queue& q = *_queues[(thief + offset) % _queues.size()];
+            std::lock_guard<std::mutex> lock(q.mutex);
+
+            if (!q.ranges.empty())
+            {
+                r = q.ranges.front();
+                q.ranges.pop_front();
+                _queued_ranges.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void work(size_t worker)
+    {
+        while (true)
+        {
+            range r;
+            if (pop(worker, r) || steal(worker, r))
+            {
+                execute(r);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(_sleep_mutex);
+            _wake.wait(lock, [&]() { return _stopping || _queued_ranges.load(std::memory_order_relaxed) != 0; });
+
+            if (_stopping && _queued_ranges.load(std::memory_order_relaxed) == 0)
+            {
+                return;
+            }
+        }
+    }
+public:
+    //pool executing loops with given number of threads (calling thread is one of them, so threads - 1 workers are created)
+    explicit work_stealing_executor(size_t threads = std::thread::hardware_concurrency()) :
+        _concurrency(threads > 0 ? threads : 1)
+    {
+        for (size_t worker = 0; worker + 1 < _concurrency; worker++)
+        {
+            _queues.push_back(std::make_unique<worker_queue>());
+        }
+
+        for (size_t worker = 0; worker + 1 < _concurrency; worker++)
+        {
+            _workers.emplace_back([this, worker]() { work(worker); });
+        }
+    }
+
+    work_stealing_executor(const work_stealing_executor& other) = delete;
+    work_stealing_executor& operator=(const work_stealing_executor& other) = delete;
+
+    ~work_stealing_executor()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sleep_mutex);
+            _stopping = true;
+        }
+        _wake.notify_all();
+
+        for (std::thread& worker : _workers)
+        {
+            worker.join();
+        }
+    }
+public:
+    void parallel_for(size_t n, const range_function& body) override
+    {
+        if (n == 0)
+        {
+            return;
+        }
+
+        if (_workers.empty() || n == 1 || detail::inside_parallel_task())
+        {
+            detail::parallel_task_scope task_scope;
+            body(0, n);
+            return;
+        }
+
+        const size_t ranges = std::min(n, _concurrency * ranges_per_thread);
+
+        loop l;
+        l.body = &body;
+        l.remaining.store(ranges, std::memory_order_relaxed);
+
+        //ranges are dealt to queues starting from different queue for every loop, so concurrent loops are spread over workers
+        const size_t first_queue = _next_queue.fetch_add(1, std::memory_order_relaxed);
+        for (size_t index = 0; index < ranges; index++)
+        {
+            worker_queue& q = *_queues[(first_queue + index) % _queues.size()];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            q.ranges.push_back(range{ &l, n * index / ranges, n * (index + 1) / ranges });
+            _queued_ranges.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_sleep_mutex);
+        }
+        _wake.notify_all();
+
+        //calling thread steals ranges (of this or other loops) until there is nothing left to start
+        range r;
+        while (l.remaining.load(std::memory_order_acquire) != 0 && steal(first_queue, r))
+        {
+            execute(r);
+        }
+
+        std::unique_lock<std::mutex> lock(l.mutex);
+        l.finished.wait(lock, [&]() { return l.remaining.load(std::memory_order_acquire) == 0; });
+
+        if (l.exception)
+        {
+            std::rethrow_exception(l.exception);
+        }
+    }
+
+    size_t concurrency() const override
+    {
+        return _concurrency;
+    }
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,252 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+#include "../parallel/parallel_for.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define LINEAR_ALGEBRA_SIMD_X86 1
+#else
+#define LINEAR_ALGEBRA_SIMD_X86 0
+#endif
+
+//instruction set specific kernels are compiled only when simd is enabled and target is x86
+#if USE_SIMD && LINEAR_ALGEBRA_SIMD_X86
+#define LINEAR_ALGEBRA_SIMD_KERNELS 1
+#else
+#define LINEAR_ALGEBRA_SIMD_KERNELS 0
+#endif
+
+#if LINEAR_ALGEBRA_SIMD_KERNELS
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+//msvc allows usage of every intrinsic in every function
+#define LINEAR_ALGEBRA_TARGET(isa)
+#else
+//gcc and clang require functions using intrinsics to be compiled for given instruction set
+#define LINEAR_ALGEBRA_TARGET(isa) __attribute__((target(isa)))
+#endif
+#endif
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+//instruction set levels for which kernels are compiled (ordered from the weakest to the strongest)
+enum class simd_instruction_set
+{
+    none,
+    sse2,
+    avx2,
+    avx512
+};
+
+namespace detail
+{
+    ///<summary>
+    /// table of kernels for single instruction set level
+    /// <para>all of the kernels operate on contiguous arrays of n elements (arrays can be unaligned)</para>
+    ///</summary>
+    template<class T>
+    struct simd_kernels
+    {
+        //y = alpha * x + y
+        void(*axpy)(size_t n, T alpha, const T* x, T* y);
+        //returns x * y (inner product)
+        T(*dot)(size_t n, const T* x, const T* y);
+        //out = alpha * x (out can be equal to x)
+        void(*scale)(size_t n, T alpha, const T* x, T* out);
+        //out = x / alpha (out can be equal to x)
+        void(*divide)(size_t n, T alpha, const T* x, T* out);
+        //out = x + y (out can be equal to x or y)
+        void(*add)(size_t n, const T* x, const T* y, T* out);
+        //out = x - y (out can be equal to x or y)
+        void(*subtract)(size_t n, const T* x, const T* y, T* out);
+        //out = transpose of rows x columns block of row-major a (out is columns x rows, it must not overlap with a)
+        void(*transpose)(size_t rows, size_t columns, const T* a, size_t lda, T* out, size_t ldo);
+
+        //register tile of gemm micro-kernel, packed panels of A and B have to be of mr and nr size
+        size_t gemm_mr;
+        size_t gemm_nr;
+        //computes gemm_mr x gemm_nr tile C = alpha * A_panel * B_panel + beta * C (only rows x columns part is written back)
+        void(*gemm_micro_kernel)(size_t kc, T alpha, const T* a, const T* b, T beta, T* c, size_t rsc, size_t csc, size_t rows, size_t columns);
+    };
+
+    //kernels are used only for single and double precision floating point numbers
+    template<class T>
+    constexpr bool has_simd_kernels_v = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+    template<class T, class TO>
+    constexpr bool use_simd_kernels_v = has_simd_kernels_v<T> && std::is_same_v<T, TO>;
+
+    //arrays shorter than this are processed by regular loops (call through kernel table is not worth it)
+    constexpr size_t simd_kernels_min_size = 32;
+
+    //elements processed by single task when element-wise kernel is executed in parallel
+    constexpr size_t simd_kernels_chunk_size = 16384;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
+
+#include "simd_generic.inl"
+#include "simd_sse2.inl"
+#include "simd_avx2.inl"
+#include "simd_avx512.inl"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //queries cpu (and operating system support for extended registers) for the strongest supported instruction set
+    inline simd_instruction_set detect_simd_instruction_set()
+    {
+#if LINEAR_ALGEBRA_SIMD_KERNELS
+#if defined(_MSC_VER) && !defined(__clang__)
+        int registers[4];
+
+        __cpuid(registers, 0);
+        const int max_leaf = registers[0];
+
+        __cpuid(registers, 1);
+        const bool sse2 = (registers[3] & (1 << 26)) != 0;
+        const bool fma = (registers[2] & (1 << 12)) != 0;
+        const bool osxsave = (registers[2] & (1 << 27)) != 0;
+        const bool avx = (registers[2] & (1 << 28)) != 0;
+
+        bool avx2 = false;
+        bool avx512 = false;
+
+        if (max_leaf >= 7 && osxsave && avx)
+        {
+            const unsigned long long xcr0 = _xgetbv(0);
+            //xmm, ymm state and opmask, zmm state have to be enabled by operating system
+            const bool os_avx = (xcr0 & 0x6) == 0x6;
+            const bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+
+            __cpuidex(registers, 7, 0);
+            avx2 = os_avx && fma && (registers[1] & (1 << 5)) != 0;
+            avx512 = os_avx512 && avx2 && (registers[1] & (1 << 16)) != 0;
+        }
+
+        if (avx512)
+        {
+            return simd_instruction_set::avx512;
+        }
+        if (avx2)
+        {
+            return simd_instruction_set::avx2;
+        }
+        if (sse2)
+        {
+            return simd_instruction_set::sse2;
+        }
+#else
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        {
+            return simd_instruction_set::avx512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        {
+            return simd_instruction_set::avx2;
+        }
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return simd_instruction_set::sse2;
+        }
+#endif
+#endif
+        return simd_instruction_set::none;
+    }
+
+    template<class T>
+    simd_kernels<T> make_simd_kernels(simd_instruction_set instruction_set)
+    {
+        switch (instruction_set)
+        {
+#if LINEAR_ALGEBRA_SIMD_KERNELS
+        case simd_instruction_set::avx512:
+            return simd_avx512::make_kernels<T>();
+        case simd_instruction_set::avx2:
+            return simd_avx2::make_kernels<T>();
+        case simd_instruction_set::sse2:
+            return simd_sse2::make_kernels<T>();
+#endif
+        default:
+            return simd_generic::make_kernels<T>();
+        }
+    }
+
+    inline simd_instruction_set& current_simd_instruction_set()
+    {
+        //detection is performed once, on first use of any kernel
+        static simd_instruction_set instruction_set = detect_simd_instruction_set();
+        return instruction_set;
+    }
+
+    template<class T>
+    simd_kernels<T>& simd_kernels_table()
+    {
+        static simd_kernels<T> kernels = make_simd_kernels<T>(current_simd_instruction_set());
+        return kernels;
+    }
+
+    template<class T>
+    inline const simd_kernels<T>& get_simd_kernels()
+    {
+        return simd_kernels_table<T>();
+    }
+
+    ///<summary>
+    /// applies element-wise kernel on array of n elements
+    /// <para>big arrays are split into chunks which are processed in parallel</para>
+    ///</summary>
+    /// <param name="kernel"> callable taking (offset, count) </param>
+    template<class F>
+    inline void simd_for_each_chunk(size_t n, bool parallel, F&& kernel)
+    {
+        if (parallel && n > simd_kernels_chunk_size)
+        {
+            const size_t chunks = (n + simd_kernels_chunk_size - 1) / simd_kernels_chunk_size;
+
+            parallel_for(chunks, true, [&](size_t chunk) {
+                const size_t offset = chunk * simd_kernels_chunk_size;
+                kernel(offset, std::min(simd_kernels_chunk_size, n - offset));
+            });
+        }
+        else
+        {
+            kernel(static_cast<size_t>(0), n);
+        }
+    }
+}
+
+///<summary>
+/// returns instruction set used by simd kernels
+/// <para>by default the strongest instruction set supported by host cpu is used</para>
+///</summary>
+inline simd_instruction_set get_simd_instruction_set()
+{
+    return detail::current_simd_instruction_set();
+}
+
+///<summary>
+/// changes instruction set used by simd kernels (e.g to compare performance or results of different levels)
+/// <para>requested instruction set is clamped to the strongest one supported by host cpu</para>
+/// <para>must not be called while other threads are using the library</para>
+///</summary>
+inline simd_instruction_set set_simd_instruction_set(simd_instruction_set instruction_set)
+{
+    const auto supported = detail::detect_simd_instruction_set();
+    if (static_cast<int>(instruction_set) > static_cast<int>(supported))
+    {
+        instruction_set = supported;
+    }
+
+    detail::current_simd_instruction_set() = instruction_set;
+    detail::simd_kernels_table<float>() = detail::make_simd_kernels<float>(instruction_set);
+    detail::simd_kernels_table<double>() = detail::make_simd_kernels<double>(instruction_set);
+
+    return instruction_set;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
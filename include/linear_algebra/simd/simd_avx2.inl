@@ -0,0 +1,150 @@
+#pragma once
+
+#include "simd.hpp"
+
+#if LINEAR_ALGEBRA_SIMD_KERNELS
+
+#define LINEAR_ALGEBRA_TARGET_AVX2 LINEAR_ALGEBRA_TARGET("avx2,fma")
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    namespace simd_avx2
+    {
+        template<class T>
+        struct register_type;
+
+        template<>
+        struct register_type<float>
+        {
+            using type = __m256;
+            static constexpr size_t width = 8;
+
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type zero() { return _mm256_setzero_ps(); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type broadcast(float v) { return _mm256_set1_ps(v); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type load(const float* p) { return _mm256_loadu_ps(p); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline void store(float* p, type v) { _mm256_storeu_ps(p, v); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type add(type a, type b) { return _mm256_add_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type subtract(type a, type b) { return _mm256_sub_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type multiply(type a, type b) { return _mm256_mul_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type divide(type a, type b) { return _mm256_div_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type multiply_add(type a, type b, type c) { return _mm256_fmadd_ps(a, b, c); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline float sum(type v)
+            {
+                __m128 v128 = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+                __m128 shuffled = _mm_shuffle_ps(v128, v128, _MM_SHUFFLE(2, 3, 0, 1));
+                __m128 sums = _mm_add_ps(v128, shuffled);
+                shuffled = _mm_movehl_ps(shuffled, sums);
+                sums = _mm_add_ss(sums, shuffled);
+                return _mm_cvtss_f32(sums);
+            }
+
+            static constexpr size_t transpose_width = 8;
+
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline void transpose_tile(const float* a, size_t lda, float* out, size_t ldo)
+            {
+                //pairs of rows are interleaved, then pairs of pairs, then 128-bit halves are exchanged
+                const __m256 t0 = _mm256_unpacklo_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(a + lda));
+                const __m256 t1 = _mm256_unpackhi_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(a + lda));
+                const __m256 t2 = _mm256_unpacklo_ps(_mm256_loadu_ps(a + 2 * lda), _mm256_loadu_ps(a + 3 * lda));
+                const __m256 t3 = _mm256_unpackhi_ps(_mm256_loadu_ps(a + 2 * lda), _mm256_loadu_ps(a + 3 * lda));
+                const __m256 t4 = _mm256_unpacklo_ps(_mm256_loadu_ps(a + 4 * lda), _mm256_loadu_ps(a + 5 * lda));
+                const __m256 t5 = _mm256_unpackhi_ps(_mm256_loadu_ps(a + 4 * lda), _mm256_loadu_ps(a + 5 * lda));
+                const __m256 t6 = _mm256_unpacklo_ps(_mm256_loadu_ps(a + 6 * lda), _mm256_loadu_ps(a + 7 * lda));
+                const __m256 t7 = _mm256_unpackhi_ps(_mm256_loadu_ps(a + 6 * lda), _mm256_loadu_ps(a + 7 * lda));
+
+                const __m256 s0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 s1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 s2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 s3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 s4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 s5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 s6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 s7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+                _mm256_storeu_ps(out, _mm256_permute2f128_ps(s0, s4, 0x20));
+                _mm256_storeu_ps(out + ldo, _mm256_permute2f128_ps(s1, s5, 0x20));
+                _mm256_storeu_ps(out + 2 * ldo, _mm256_permute2f128_ps(s2, s6, 0x20));
+                _mm256_storeu_ps(out + 3 * ldo, _mm256_permute2f128_ps(s3, s7, 0x20));
+                _mm256_storeu_ps(out + 4 * ldo, _mm256_permute2f128_ps(s0, s4, 0x31));
+                _mm256_storeu_ps(out + 5 * ldo, _mm256_permute2f128_ps(s1, s5, 0x31));
+                _mm256_storeu_ps(out + 6 * ldo, _mm256_permute2f128_ps(s2, s6, 0x31));
+                _mm256_storeu_ps(out + 7 * ldo, _mm256_permute2f128_ps(s3, s7, 0x31));
+            }
+        };
+
+        template<>
+        struct register_type<double>
+        {
+            using type = __m256d;
+            static constexpr size_t width = 4;
+
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type zero() { return _mm256_setzero_pd(); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type broadcast(double v) { return _mm256_set1_pd(v); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type load(const double* p) { return _mm256_loadu_pd(p); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline void store(double* p, type v) { _mm256_storeu_pd(p, v); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type add(type a, type b) { return _mm256_add_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type subtract(type a, type b) { return _mm256_sub_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type multiply(type a, type b) { return _mm256_mul_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type divide(type a, type b) { return _mm256_div_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline type multiply_add(type a, type b, type c) { return _mm256_fmadd_pd(a, b, c); }
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline double sum(type v)
+            {
+                __m128d v128 = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+                return _mm_cvtsd_f64(_mm_add_sd(v128, _mm_unpackhi_pd(v128, v128)));
+            }
+
+            static constexpr size_t transpose_width = 4;
+
+            LINEAR_ALGEBRA_TARGET_AVX2 static inline void transpose_tile(const double* a, size_t lda, double* out, size_t ldo)
+            {
+                const __m256d r0 = _mm256_loadu_pd(a);
+                const __m256d r1 = _mm256_loadu_pd(a + lda);
+                const __m256d r2 = _mm256_loadu_pd(a + 2 * lda);
+                const __m256d r3 = _mm256_loadu_pd(a + 3 * lda);
+
+                const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+                const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+                const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+                const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+
+                _mm256_storeu_pd(out, _mm256_permute2f128_pd(t0, t2, 0x20));
+                _mm256_storeu_pd(out + ldo, _mm256_permute2f128_pd(t1, t3, 0x20));
+                _mm256_storeu_pd(out + 2 * ldo, _mm256_permute2f128_pd(t0, t2, 0x31));
+                _mm256_storeu_pd(out + 3 * ldo, _mm256_permute2f128_pd(t1, t3, 0x31));
+            }
+        };
+
+#define LINEAR_ALGEBRA_SIMD_TARGET LINEAR_ALGEBRA_TARGET_AVX2
+#include "simd_kernels.inl"
+#undef LINEAR_ALGEBRA_SIMD_TARGET
+
+        template<class T>
+        simd_kernels<T> make_kernels()
+        {
+            //16 ymm registers: 6 rows x 2 registers of accumulators, 2 registers of B and 1 broadcasted element of A
+            constexpr size_t mr = 6;
+            constexpr size_t nr = 2 * register_type<T>::width;
+
+            return simd_kernels<T>{
+                &axpy<T>,
+                &dot<T>,
+                &scale<T>,
+                &divide<T>,
+                &add<T>,
+                &subtract<T>,
+                &transpose<T>,
+                mr,
+                nr,
+                &gemm_micro_kernel<T, mr>
+            };
+        }
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
+
+#undef LINEAR_ALGEBRA_TARGET_AVX2
+
+#endif
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "simd.hpp"
+
+#if LINEAR_ALGEBRA_SIMD_KERNELS
+
+#define LINEAR_ALGEBRA_TARGET_AVX512 LINEAR_ALGEBRA_TARGET("avx512f,avx2,fma")
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    namespace simd_avx512
+    {
+        template<class T>
+        struct register_type;
+
+        template<>
+        struct register_type<float>
+        {
+            using type = __m512;
+            static constexpr size_t width = 16;
+
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type zero() { return _mm512_setzero_ps(); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type broadcast(float v) { return _mm512_set1_ps(v); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type load(const float* p) { return _mm512_loadu_ps(p); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline void store(float* p, type v) { _mm512_storeu_ps(p, v); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type add(type a, type b) { return _mm512_add_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type subtract(type a, type b) { return _mm512_sub_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type multiply(type a, type b) { return _mm512_mul_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type divide(type a, type b) { return _mm512_div_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type multiply_add(type a, type b, type c) { return _mm512_fmadd_ps(a, b, c); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline float sum(type v) { return _mm512_reduce_add_ps(v); }
+
+            //256-bit tiles are used (16x16 tile does not fit in registers together with its intermediate results)
+            static constexpr size_t transpose_width = simd_avx2::register_type<float>::transpose_width;
+
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline void transpose_tile(const float* a, size_t lda, float* out, size_t ldo)
+            {
+                simd_avx2::register_type<float>::transpose_tile(a, lda, out, ldo);
+            }
+        };
+
+        template<>
+        struct register_type<double>
+        {
+            using type = __m512d;
+            static constexpr size_t width = 8;
+
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type zero() { return _mm512_setzero_pd(); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type broadcast(double v) { return _mm512_set1_pd(v); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type load(const double* p) { return _mm512_loadu_pd(p); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline void store(double* p, type v) { _mm512_storeu_pd(p, v); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type add(type a, type b) { return _mm512_add_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type subtract(type a, type b) { return _mm512_sub_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type multiply(type a, type b) { return _mm512_mul_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type divide(type a, type b) { return _mm512_div_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline type multiply_add(type a, type b, type c) { return _mm512_fmadd_pd(a, b, c); }
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline double sum(type v) { return _mm512_reduce_add_pd(v); }
+
+            static constexpr size_t transpose_width = 8;
+
+            LINEAR_ALGEBRA_TARGET_AVX512 static inline void transpose_tile(const double* a, size_t lda, double* out, size_t ldo)
+            {
+                //pairs of rows are interleaved, then pairs of 128-bit lanes and finally 256-bit halves are exchanged
+                __m512d t[8];
+                for (size_t i = 0; i < 8; i += 2)
+                {
+                    const __m512d r0 = _mm512_loadu_pd(a + i * lda);
+                    const __m512d r1 = _mm512_loadu_pd(a + (i + 1) * lda);
+                    t[i] = _mm512_unpacklo_pd(r0, r1);
+                    t[i + 1] = _mm512_unpackhi_pd(r0, r1);
+                }
+
+                const __m512i even_lanes = _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0);
+                const __m512i odd_lanes = _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+
+                __m512d u[8];
+                for (size_t i = 0; i < 8; i += 4)
+                {
+                    u[i] = _mm512_permutex2var_pd(t[i], even_lanes, t[i + 2]);
+                    u[i + 1] = _mm512_permutex2var_pd(t[i + 1], even_lanes, t[i + 3]);
+                    u[i + 2] = _mm512_permutex2var_pd(t[i], odd_lanes, t[i + 2]);
+                    u[i + 3] = _mm512_permutex2var_pd(t[i + 1], odd_lanes, t[i + 3]);
+                }
+
+                for (size_t j = 0; j < 4; j++)
+                {
+                    _mm512_storeu_pd(out + j * ldo, _mm512_shuffle_f64x2(u[j], u[j + 4], _MM_SHUFFLE(1, 0, 1, 0)));
+                    _mm512_storeu_pd(out + (j + 4) * ldo, _mm512_shuffle_f64x2(u[j], u[j + 4], _MM_SHUFFLE(3, 2, 3, 2)));
+                }
+            }
+        };
+
+#define LINEAR_ALGEBRA_SIMD_TARGET LINEAR_ALGEBRA_TARGET_AVX512
+#include "simd_kernels.inl"
+#undef LINEAR_ALGEBRA_SIMD_TARGET
+
+        template<class T>
+        simd_kernels<T> make_kernels()
+        {
+            //32 zmm registers: 8 rows x 2 registers of accumulators, 2 registers of B and 1 broadcasted element of A
+            constexpr size_t mr = 8;
+            constexpr size_t nr = 2 * register_type<T>::width;
+
+            return simd_kernels<T>{
+                &axpy<T>,
+                &dot<T>,
+                &scale<T>,
+                &divide<T>,
+                &add<T>,
+                &subtract<T>,
+                &transpose<T>,
+                mr,
+                nr,
+                &gemm_micro_kernel<T, mr>
+            };
+        }
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
+
+#undef LINEAR_ALGEBRA_TARGET_AVX512
+
+#endif
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "simd.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //portable kernels (plain loops left for compiler to vectorize), used when no instruction set is available
+    namespace simd_generic
+    {
+        template<class T>
+        void axpy(size_t n, T alpha, const T* x, T* y)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                y[i] += alpha * x[i];
+            }
+        }
+
+        template<class T>
+        T dot(size_t n, const T* x, const T* y)
+        {
+            T result = static_cast<T>(0);
+            for (size_t i = 0; i < n; i++)
+            {
+                result += x[i] * y[i];
+            }
+            return result;
+        }
+
+        template<class T>
+        void scale(size_t n, T alpha, const T* x, T* out)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                out[i] = alpha * x[i];
+            }
+        }
+
+        template<class T>
+        void divide(size_t n, T alpha, const T* x, T* out)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                out[i] = x[i] / alpha;
+            }
+        }
+
+        template<class T>
+        void add(size_t n, const T* x, const T* y, T* out)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                out[i] = x[i] + y[i];
+            }
+        }
+
+        template<class T>
+        void subtract(size_t n, const T* x, const T* y, T* out)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                out[i] = x[i] - y[i];
+            }
+        }
+
+        template<class T>
+        void transpose(size_t rows, size_t columns, const T* a, size_t lda, T* out, size_t ldo)
+        {
+            for (size_t i = 0; i < rows; i++)
+            {
+                for (size_t j = 0; j < columns; j++)
+                {
+                    out[j * ldo + i] = a[i * lda + j];
+                }
+            }
+        }
+
+        //writes alpha * tile + beta * C back to C (only rows x columns part of tile)
+        template<class T, size_t NR>
+        inline void gemm_store_tile(const T* tile, T alpha, T beta, T* c, size_t rsc, size_t csc, size_t rows, size_t columns)
+        {
+            //beta equal to 0 means that C is not read at all (it may be uninitialized)
+            if (beta == static_cast<T>(0))
+            {
+                for (size_t i = 0; i < rows; i++)
+                {
+                    for (size_t j = 0; j < columns; j++)
+                    {
+                        c[i * rsc + j * csc] = alpha * tile[i * NR + j];
+                    }
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < rows; i++)
+                {
+                    for (size_t j = 0; j < columns; j++)
+                    {
+                        c[i * rsc + j * csc] = alpha * tile[i * NR + j] + beta * c[i * rsc + j * csc];
+                    }
+                }
+            }
+        }
+
+        template<class T, size_t MR, size_t NR>
+        void gemm_micro_kernel(size_t kc, T alpha, const T* a, const T* b, T beta, T* c, size_t rsc, size_t csc, size_t rows, size_t columns)
+        {
+            T accumulators[MR][NR] = {};
+
+            for (size_t p = 0; p < kc; p++)
+            {
+                for (size_t i = 0; i < MR; i++)
+                {
+                    const T a_element = a[i];
+                    for (size_t j = 0; j < NR; j++)
+                    {
+                        accumulators[i][j] += a_element * b[j];
+                    }
+                }
+                a += MR;
+                b += NR;
+            }
+
+            gemm_store_tile<T, NR>(accumulators[0], alpha, beta, c, rsc, csc, rows, columns);
+        }
+
+        template<class T>
+        simd_kernels<T> make_kernels()
+        {
+            constexpr size_t mr = 6;
+            constexpr size_t nr = 32 / sizeof(T);
+
+            return simd_kernels<T>{
+                &axpy<T>,
+                &dot<T>,
+                &scale<T>,
+                &divide<T>,
+                &add<T>,
+                &subtract<T>,
+                &transpose<T>,
+                mr,
+                nr,
+                &gemm_micro_kernel<T, mr, nr>
+            };
+        }
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
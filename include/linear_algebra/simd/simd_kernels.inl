@@ -0,0 +1,237 @@
+//kernels shared by all instruction sets
+//this file is included inside of instruction set namespace (without include guard) which has to provide:
+//  register_type<T> - wrapper of vector register operations for float and double
+//  LINEAR_ALGEBRA_SIMD_TARGET - attribute enabling instruction set for compiled functions
+
+template<class T>
+LINEAR_ALGEBRA_SIMD_TARGET void axpy(size_t n, T alpha, const T* x, T* y)
+{
+    using R = register_type<T>;
+    constexpr size_t w = R::width;
+
+    const auto alpha_v = R::broadcast(alpha);
+
+    size_t i = 0;
+    for (; i + 2 * w <= n; i += 2 * w)
+    {
+        R::store(y + i, R::multiply_add(alpha_v, R::load(x + i), R::load(y + i)));
+        R::store(y + i + w, R::multiply_add(alpha_v, R::load(x + i + w), R::load(y + i + w)));
+    }
+    for (; i + w <= n; i += w)
+    {
+        R::store(y + i, R::multiply_add(alpha_v, R::load(x + i), R::load(y + i)));
+    }
+    for (; i < n; i++)
+    {
+        y[i] += alpha * x[i];
+    }
+}
+
+template<class T>
+LINEAR_ALGEBRA_SIMD_TARGET T dot(size_t n, const T* x, const T* y)
+{
+    using R = register_type<T>;
+    constexpr size_t w = R::width;
+
+    //independent accumulators hide latency of multiply-add instructions
+    auto sum0 = R::zero();
+    auto sum1 = R::zero();
+    auto sum2 = R::zero();
+    auto sum3 = R::zero();
+
+    size_t i = 0;
+    for (; i + 4 * w <= n; i += 4 * w)
+    {
+        sum0 = R::multiply_add(R::load(x + i), R::load(y + i), sum0);
+        sum1 = R::multiply_add(R::load(x + i + w), R::load(y + i + w), sum1);
+        sum2 = R::multiply_add(R::load(x + i + 2 * w), R::load(y + i + 2 * w), sum2);
+        sum3 = R::multiply_add(R::load(x + i + 3 * w), R::load(y + i + 3 * w), sum3);
+    }
+    for (; i + w <= n; i += w)
+    {
+        sum0 = R::multiply_add(R::load(x + i), R::load(y + i), sum0);
+    }
+
+    T result = R::sum(R::add(R::add(sum0, sum1), R::add(sum2, sum3)));
+
+    for (; i < n; i++)
+    {
+        result += x[i] * y[i];
+    }
+
+    return result;
+}
+
+template<class T>
+LINEAR_ALGEBRA_SIMD_TARGET void scale(size_t n, T alpha, const T* x, T* out)
+{
+    using R = register_type<T>;
+    constexpr size_t w = R::width;
+
+    const auto alpha_v = R::broadcast(alpha);
+
+    size_t i = 0;
+    for (; i + w <= n; i += w)
+    {
+        R::store(out + i, R::multiply(alpha_v, R::load(x + i)));
+    }
+    for (; i < n; i++)
+    {
+        out[i] = alpha * x[i];
+    }
+}
+
+template<class T>
+LINEAR_ALGEBRA_SIMD_TARGET void divide(size_t n, T alpha, const T* x, T* out)
+{
+    using R = register_type<T>;
+    constexpr size_t w = R::width;
+
+    const auto alpha_v = R::broadcast(alpha);
+
+    size_t i = 0;
+    for (; i + w <= n; i += w)
+    {
+        R::store(out + i, R::divide(R::load(x + i), alpha_v));
+    }
+    for (; i < n; i++)
+    {
+        out[i] = x[i] / alpha;
+    }
+}
+
+template<class T>
+LINEAR_ALGEBRA_SIMD_TARGET void add(size_t n, const T* x, const T* y, T* out)
+{
+    using R = register_type<T>;
+    constexpr size_t w = R::width;
+
+    size_t i = 0;
+    for (; i + w <= n; i += w)
+    {
+        R::store(out + i, R::add(R::load(x + i), R::load(y + i)));
+    }
+    for (; i < n; i++)
+    {
+        out[i] = x[i] + y[i];
+    }
+}
+
+template<class T>
+LINEAR_ALGEBRA_SIMD_TARGET void subtract(size_t n, const T* x, const T* y, T* out)
+{
+    using R = register_type<T>;
+    constexpr size_t w = R::width;
+
+    size_t i = 0;
+    for (; i + w <= n; i += w)
+    {
+        R::store(out + i, R::subtract(R::load(x + i), R::load(y + i)));
+    }
+    for (; i < n; i++)
+    {
+        out[i] = x[i] - y[i];
+    }
+}
+
+//square tiles of R::transpose_width elements are transposed in registers, edges are copied element by element
+template<class T>
+LINEAR_ALGEBRA_SIMD_TARGET void transpose(size_t rows, size_t columns, const T* a, size_t lda, T* out, size_t ldo)
+{
+    using R = register_type<T>;
+    constexpr size_t w = R::transpose_width;
+
+    size_t i = 0;
+    for (; i + w <= rows; i += w)
+    {
+        size_t j = 0;
+        for (; j + w <= columns; j += w)
+        {
+            R::transpose_tile(a + i * lda + j, lda, out + j * ldo + i, ldo);
+        }
+        for (; j < columns; j++)
+        {
+            for (size_t k = i; k < i + w; k++)
+            {
+                out[j * ldo + k] = a[k * lda + j];
+            }
+        }
+    }
+    for (; i < rows; i++)
+    {
+        for (size_t j = 0; j < columns; j++)
+        {
+            out[j * ldo + i] = a[i * lda + j];
+        }
+    }
+}
+
+//register tile is MR rows x 2 vector registers
+template<class T, size_t MR>
+LINEAR_ALGEBRA_SIMD_TARGET void gemm_micro_kernel(size_t kc, T alpha, const T* a, const T* b, T beta, T* c, size_t rsc, size_t csc, size_t rows, size_t columns)
+{
+    using R = register_type<T>;
+    constexpr size_t w = R::width;
+    constexpr size_t NR = 2 * w;
+
+    typename R::type accumulators0[MR];
+    typename R::type accumulators1[MR];
+
+    for (size_t i = 0; i < MR; i++)
+    {
+        accumulators0[i] = R::zero();
+        accumulators1[i] = R::zero();
+    }
+
+    for (size_t p = 0; p < kc; p++)
+    {
+        const auto b0 = R::load(b);
+        const auto b1 = R::load(b + w);
+
+        for (size_t i = 0; i < MR; i++)
+        {
+            const auto a_element = R::broadcast(a[i]);
+            accumulators0[i] = R::multiply_add(a_element, b0, accumulators0[i]);
+            accumulators1[i] = R::multiply_add(a_element, b1, accumulators1[i]);
+        }
+
+        a += MR;
+        b += NR;
+    }
+
+    const auto alpha_v = R::broadcast(alpha);
+
+    if (rows == MR && columns == NR && csc == 1)
+    {
+        //full tile of contiguous rows can be written back directly from registers
+        if (beta == static_cast<T>(0))
+        {
+            for (size_t i = 0; i < MR; i++)
+            {
+                R::store(c + i * rsc, R::multiply(alpha_v, accumulators0[i]));
+                R::store(c + i * rsc + w, R::multiply(alpha_v, accumulators1[i]));
+            }
+        }
+        else
+        {
+            const auto beta_v = R::broadcast(beta);
+            for (size_t i = 0; i < MR; i++)
+            {
+                R::store(c + i * rsc, R::multiply_add(alpha_v, accumulators0[i], R::multiply(beta_v, R::load(c + i * rsc))));
+                R::store(c + i * rsc + w, R::multiply_add(alpha_v, accumulators1[i], R::multiply(beta_v, R::load(c + i * rsc + w))));
+            }
+        }
+    }
+    else
+    {
+        //edge tiles and strided C go through temporary tile
+        T tile[MR * NR];
+        for (size_t i = 0; i < MR; i++)
+        {
+            R::store(tile + i * NR, accumulators0[i]);
+            R::store(tile + i * NR + w, accumulators1[i]);
+        }
+
+        simd_generic::gemm_store_tile<T, NR>(tile, alpha, beta, c, rsc, csc, rows, columns);
+    }
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "simd.hpp"
+
+#if LINEAR_ALGEBRA_SIMD_KERNELS
+
+#define LINEAR_ALGEBRA_TARGET_SSE2 LINEAR_ALGEBRA_TARGET("sse2")
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    namespace simd_sse2
+    {
+        template<class T>
+        struct register_type;
+
+        template<>
+        struct register_type<float>
+        {
+            using type = __m128;
+            static constexpr size_t width = 4;
+
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type zero() { return _mm_setzero_ps(); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type broadcast(float v) { return _mm_set1_ps(v); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type load(const float* p) { return _mm_loadu_ps(p); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline void store(float* p, type v) { _mm_storeu_ps(p, v); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type add(type a, type b) { return _mm_add_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type subtract(type a, type b) { return _mm_sub_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type multiply(type a, type b) { return _mm_mul_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type divide(type a, type b) { return _mm_div_ps(a, b); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type multiply_add(type a, type b, type c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline float sum(type v)
+            {
+                __m128 shuffled = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+                __m128 sums = _mm_add_ps(v, shuffled);
+                shuffled = _mm_movehl_ps(shuffled, sums);
+                sums = _mm_add_ss(sums, shuffled);
+                return _mm_cvtss_f32(sums);
+            }
+
+            static constexpr size_t transpose_width = 4;
+
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline void transpose_tile(const float* a, size_t lda, float* out, size_t ldo)
+            {
+                __m128 r0 = _mm_loadu_ps(a);
+                __m128 r1 = _mm_loadu_ps(a + lda);
+                __m128 r2 = _mm_loadu_ps(a + 2 * lda);
+                __m128 r3 = _mm_loadu_ps(a + 3 * lda);
+
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                _mm_storeu_ps(out, r0);
+                _mm_storeu_ps(out + ldo, r1);
+                _mm_storeu_ps(out + 2 * ldo, r2);
+                _mm_storeu_ps(out + 3 * ldo, r3);
+            }
+        };
+
+        template<>
+        struct register_type<double>
+        {
+            using type = __m128d;
+            static constexpr size_t width = 2;
+
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type zero() { return _mm_setzero_pd(); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type broadcast(double v) { return _mm_set1_pd(v); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type load(const double* p) { return _mm_loadu_pd(p); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline void store(double* p, type v) { _mm_storeu_pd(p, v); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type add(type a, type b) { return _mm_add_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type subtract(type a, type b) { return _mm_sub_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type multiply(type a, type b) { return _mm_mul_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type divide(type a, type b) { return _mm_div_pd(a, b); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline type multiply_add(type a, type b, type c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline double sum(type v)
+            {
+                return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+            }
+
+            static constexpr size_t transpose_width = 2;
+
+            LINEAR_ALGEBRA_TARGET_SSE2 static inline void transpose_tile(const double* a, size_t lda, double* out, size_t ldo)
+            {
+                const __m128d r0 = _mm_loadu_pd(a);
+                const __m128d r1 = _mm_loadu_pd(a + lda);
+
+                _mm_storeu_pd(out, _mm_unpacklo_pd(r0, r1));
+                _mm_storeu_pd(out + ldo, _mm_unpackhi_pd(r0, r1));
+            }
+        };
+
+#define LINEAR_ALGEBRA_SIMD_TARGET LINEAR_ALGEBRA_TARGET_SSE2
+#include "simd_kernels.inl"
+#undef LINEAR_ALGEBRA_SIMD_TARGET
+
+        template<class T>
+        simd_kernels<T> make_kernels()
+        {
+            //16 xmm registers: 6 rows x 2 registers of accumulators, 2 registers of B and 1 broadcasted element of A
+            constexpr size_t mr = 6;
+            constexpr size_t nr = 2 * register_type<T>::width;
+
+            return simd_kernels<T>{
+                &axpy<T>,
+                &dot<T>,
+                &scale<T>,
+                &divide<T>,
+                &add<T>,
+                &subtract<T>,
+                &transpose<T>,
+                mr,
+                nr,
+                &gemm_micro_kernel<T, mr>
+            };
+        }
+    }
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
+
+#undef LINEAR_ALGEBRA_TARGET_SSE2
+
+#endif
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+#include "../layout/matrix_layout.hpp"
+#include "../matrix/matrix.hpp"
+#include "../dynamic_vector/dynamic_vector.hpp"
+#include "../dynamic_matrix/dynamic_matrix.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// matrix with dimensions given at runtime which stores only its nonzero elements in compressed lines
+/// (row_major layout is CSR - compressed rows, column_major layout is CSC - compressed columns)
+/// <para>for every line offsets() delimit its nonzeros, indices() hold their positions along line (sorted, without duplicates)
+/// and values() hold their elements, so memory and products are proportional to number of nonzeros instead of rows * columns</para>
+/// <para>matrices are assembled from entries in coordinate format (see sparse_matrix_builder) or converted from dense matrices,
+/// products with vectors and dense matrices are split between threads by numbers of nonzeros</para>
+///</summary>
+template<class T, class L>
+class sparse_matrix
+{
+    static_assert(is_valid_mathematical_field_v<T>, "Matrix element type must satisfy valid_mathematical_field concept!");
+    static_assert(std::is_same_v<L, row_major> || std::is_same_v<L, column_major>, "Sparse matrix is stored by rows (row_major, CSR) or by columns (column_major, CSC)!");
+
+    template<class TO, class LO>
+    friend class sparse_matrix;
+    template<class TO>
+    friend class sparse_matrix_builder;
+public:
+    using mathematical_field_type = T;
+    using layout_type = L;
+
+    //layout of transposition (CSR storage of matrix is CSC storage of its transposition)
+    using transposed_layout_type = std::conditional_t<std::is_same_v<L, row_major>, column_major, row_major>;
+private:
+    static constexpr bool is_compressed_by_rows = std::is_same_v<L, row_major>;
+
+    size_t _rows = 0;
+    size_t _columns = 0;
+    detail::storage_vector<size_t> _offsets = detail::storage_vector<size_t>(1);
+    detail::storage_vector<size_t> _indices;
+    detail::storage_vector<T> _values;
+private:
+    //number of compressed lines (rows of CSR, columns of CSC)
+    size_t lines() const;
+
+    //compresses elements of dense rows x columns matrix which are not 0, element(row, column) returns element of dense matrix
+    template<class F>
+    void compress_dense(F&& element);
+
+    //Y = alpha * A * X + beta * Y for X with columns columns (row strides ldx and ldy)
+    void multiply_add(size_t columns, const T& alpha, const T* x, size_t ldx, const T& beta, T* y, size_t ldy) const;
+public:
+    //default constructor (matrix of size 0x0)
+
+    sparse_matrix() = default;
+
+    //copy, move constructors and operators
+
+    sparse_matrix(const sparse_matrix<T, L>& other) = default;
+
+    sparse_matrix(sparse_matrix<T, L>&& other) = default;
+
+    sparse_matrix<T, L>& operator=(const sparse_matrix<T, L>& other) = default;
+
+    sparse_matrix<T, L>& operator=(sparse_matrix<T, L>&& other) = default;
+
+    //other layout (CSR to CSC and the other way around)
+
+    template<class LO, typename = typename std::enable_if_t<!std::is_same_v<L, LO>>>
+    explicit sparse_matrix(const sparse_matrix<T, LO>& other);
+
+    //from dense matrices (elements which are not 0 are stored)
+
+    explicit sparse_matrix(const dynamic_matrix<T>& other);
+
+    template<size_t N, size_t M, class LO>
+    explicit sparse_matrix(const matrix<T, N, M, LO>& other);
+
+    //regular constructors
+
+    //all elements are 0 (no element is stored)
+    sparse_matrix(size_t rows, size_t columns);
+public:
+    //matrix-scalar operators
+
+    sparse_matrix<T, L> operator-() const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+    sparse_matrix<T, L> operator*(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    sparse_matrix<T, L>& operator*=(const TO& v);
+
+    //matrix-vector operators (vector must have columns() coordinates)
+
+    dynamic_vector<T> operator*(const dynamic_vector<T>& vec) const;
+
+    template<size_t D>
+    dynamic_vector<T> operator*(const vector<T, D>& vec) const;
+
+    //matrix-matrix operators (dense matrix must have columns() rows)
+
+    dynamic_matrix<T> operator*(const dynamic_matrix<T>& other) const;
+
+    template<size_t N, size_t M>
+    dynamic_matrix<T> operator*(const matrix<T, N, M>& other) const;
+
+    //y = alpha * A * x + beta * y (single pass over nonzeros, y must have rows() coordinates and must not be x)
+    void multiply_add(const T& alpha, const dynamic_vector<T>& x, const T& beta, dynamic_vector<T>& y) const;
+public:
+    //matrix info and accessors
+
+    size_t rows() const;
+    size_t columns() const;
+
+    //number of stored elements
+    size_t non_zeros() const;
+
+    //element (row, column) found by binary search in its line (0 if it is not stored)
+    T at(size_t row, size_t column) const;
+
+    //compressed storage: offsets has lines + 1 elements (rows for CSR, columns for CSC), nonzeros of line i are [offsets[i], offsets[i + 1])
+    //values can be modified (e.g matrix with the same sparsity pattern is assembled again), positions of nonzeros cannot
+
+    const size_t* offsets() const;
+    const size_t* indices() const;
+
+    T* values();
+    const T* values() const;
+
+    //main diagonal (elements which are not stored are 0)
+    dynamic_vector<T> diagonal() const;
+public:
+    //matrix operations
+
+    //transposition has the same compressed arrays in other layout (CSR of A^T is CSC of A), so only arrays are copied
+    sparse_matrix<T, transposed_layout_type> transposed() const;
+
+    dynamic_matrix<T> to_dynamic_matrix() const;
+
+    //copies top left min(N, rows()) x min(M, columns()) part to matrix with dimensions known at compile time
+    template<size_t N, size_t M>
+    matrix<T, N, M> to_matrix() const;
+};
+
+//compressed sparse rows
+template<class T>
+using csr_matrix = sparse_matrix<T, row_major>;
+
+//compressed sparse columns
+template<class T>
+using csc_matrix = sparse_matrix<T, column_major>;
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,340 @@
+#pragma once
+
+#include "sparse_matrix.hpp"
+#include "../matrix/matrix.inl"
+#include "../dynamic_vector/dynamic_vector.inl"
+#include "../dynamic_matrix/dynamic_matrix.inl"
+#include "../kernels/sparse.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T, class L>
+size_t sparse_matrix<T, L>::lines() const
+{
+    return is_compressed_by_rows ? _rows : _columns;
+}
+
+template<class T, class L>
+template<class F>
+void sparse_matrix<T, L>::compress_dense(F&& element)
+{
+    const size_t line_count = lines();
+    const size_t line_length = is_compressed_by_rows ? _columns : _rows;
+    const bool parallel = detail::parallel_elementwise(_rows * _columns);
+
+    auto line_element = [&](size_t line, size_t index) {
+        return is_compressed_by_rows ? element(line, index) : element(index, line);
+    };
+
+    //nonzeros of every line are counted first, so lines can be filled in parallel
+    _offsets.assign(line_count + 1, 0);
+
+    detail::parallel_for(line_count, parallel, [&](size_t line) {
+        size_t count = 0;
+        for (size_t index = 0; index < line_length; index++)
+        {
+            if (!equal(line_element(line, index), get_additive_identity<T>()))
+            {
+                count++;
+            }
+        }
+        _offsets[line + 1] = count;
+    });
+
+    std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+
+    _indices.resize(_offsets[line_count]);
+    _values.resize(_offsets[line_count]);
+
+    detail::parallel_for(line_count, parallel, [&](size_t line) {
+        size_t position = _offsets[line];
+        for (size_t index = 0; index < line_length; index++)
+        {
+            const T value = line_element(line, index);
+            if (!equal(value, get_additive_identity<T>()))
+            {
+                _indices[position] = index;
+                _values[position] = value;
+                position++;
+            }
+        }
+    });
+}
+
+template<class T, class L>
+void sparse_matrix<T, L>::multiply_add(size_t columns, const T& alpha, const T* x, size_t ldx, const T& beta, T* y, size_t ldy) const
+{
+    const bool parallel = detail::parallel_elementwise(non_zeros() * columns);
+
+    if constexpr (is_compressed_by_rows)
+    {
+        //every row of product is inner product of row of A with columns of X
+        detail::sparse_gather_multiply(_rows, columns, alpha, _offsets.data(), _indices.data(), _values.data(), x, ldx, beta, y, ldy, parallel);
+    }
+    else
+    {
+        //every column of A is scattered to rows of product
+        detail::sparse_scatter_multiply(_columns, _rows, columns, alpha, _offsets.data(), _indices.data(), _values.data(), x, ldx, beta, y, ldy, parallel);
+    }
+}
+
+template<class T, class L>
+template<class LO, typename>
+sparse_matrix<T, L>::sparse_matrix(const sparse_matrix<T, LO>& other) :
+    _rows(other._rows),
+    _columns(other._columns)
+{
+    detail::sparse_transpose(other.lines(), lines(), other._offsets.data(), other._indices.data(), other._values.data(), _offsets, _indices, _values);
+}
+
+template<class T, class L>
+sparse_matrix<T, L>::sparse_matrix(const dynamic_matrix<T>& other) :
+    _rows(other.rows()),
+    _columns(other.columns())
+{
+    compress_dense([&](size_t row, size_t column) { return other[row][column]; });
+}
+
+template<class T, class L>
+template<size_t N, size_t M, class LO>
+sparse_matrix<T, L>::sparse_matrix(const matrix<T, N, M, LO>& other) :
+    _rows(N),
+    _columns(M)
+{
+    compress_dense([&](size_t row, size_t column) { return other[row][column]; });
+}
+
+template<class T, class L>
+sparse_matrix<T, L>::sparse_matrix(size_t rows, size_t columns) :
+    _rows(rows),
+    _columns(columns),
+    _offsets(lines() + 1)
+{
+}
+
+template<class T, class L>
+sparse_matrix<T, L> sparse_matrix<T, L>::operator-() const
+{
+    sparse_matrix<T, L> result(*this);
+
+    for (T& value : result._values)
+    {
+        value = -value;
+    }
+
+    return result;
+}
+
+template<class T, class L>
+template<class TO, typename>
+sparse_matrix<T, L> sparse_matrix<T, L>::operator*(const TO& v) const
+{
+    sparse_matrix<T, L> result(*this);
+    result *= v;
+    return result;
+}
+
+template<class T, class L>
+template<class TO, typename>
+sparse_matrix<T, L>& sparse_matrix<T, L>::operator*=(const TO& v)
+{
+    const T factor = static_cast<T>(v);
+
+    detail::parallel_for(_values.size(), detail::parallel_elementwise(_values.size()), [&](size_t element) {
+        _values[element] *= factor;
+    });
+
+    return *this;
+}
+
+template<class T, class L>
+dynamic_vector<T> sparse_matrix<T, L>::operator*(const dynamic_vector<T>& vec) const
+{
+    assert(vec.size() == _columns);
+
+    dynamic_vector<T> result(_rows);
+    multiply_add(1, get_multiplicative_identity<T>(), vec.data(), 1, get_additive_identity<T>(), result.data(), 1);
+
+    return result;
+}
+
+template<class T, class L>
+template<size_t D>
+dynamic_vector<T> sparse_matrix<T, L>::operator*(const vector<T, D>& vec) const
+{
+    assert(D == _columns);
+
+    dynamic_vector<T> result(_rows);
+    multiply_add(1, get_multiplicative_identity<T>(), vec.data(), 1, get_additive_identity<T>(), result.data(), 1);
+
+    return result;
+}
+
+template<class T, class L>
+dynamic_matrix<T> sparse_matrix<T, L>::operator*(const dynamic_matrix<T>& other) const
+{
+    assert(other.rows() == _columns);
+
+    dynamic_matrix<T> result(_rows, other.columns());
+    multiply_add(other.columns(), get_multiplicative_identity<T>(), other.data(), other.columns(), get_additive_identity<T>(), result.data(), other.columns());
+
+    return result;
+}
+
+template<class T, class L>
+template<size_t N, size_t M>
+dynamic_matrix<T> sparse_matrix<T, L>::operator*(const matrix<T, N, M>& other) const
+{
+    assert(N == _columns);
+
+    dynamic_matrix<T> result(_rows, M);
+    multiply_add(M, get_multiplicative_identity<T>(), other.data(), M, get_additive_identity<T>(), result.data(), M);
+
+    return result;
+}
+
+template<class T, class L>
+void sparse_matrix<T, L>::multiply_add(const T& alpha, const dynamic_vector<T>& x, const T& beta, dynamic_vector<T>& y) const
+{
+    assert(x.size() == _columns);
+    assert(y.size() == _rows);
+    assert(x.data() != y.data());
+
+    multiply_add(1, alpha, x.data(), 1, beta, y.data(), 1);
+}
+
+template<class T, class L>
+size_t sparse_matrix<T, L>::rows() const
+{
+    return _rows;
+}
+
+template<class T, class L>
+size_t sparse_matrix<T, L>::columns() const
+{
+    return _columns;
+}
+
+template<class T, class L>
+size_t sparse_matrix<T, L>::non_zeros() const
+{
+    return _values.size();
+}
+
+template<class T, class L>
+T sparse_matrix<T, L>::at(size_t row, size_t column) const
+{
+    assert(row < _rows && column < _columns);
+
+    const size_t line = is_compressed_by_rows ? row : column;
+    const size_t index = is_compressed_by_rows ? column : row;
+
+    const size_t* first = _indices.data() + _offsets[line];
+    const size_t* last = _indices.data() + _offsets[line + 1];
+    const size_t* found = std::lower_bound(first, last, index);
+
+    if (found == last || *found != index)
+    {
+        return get_additive_identity<T>();
+    }
+
+    return _values[found - _indices.data()];
+}
+
+template<class T, class L>
+const size_t* sparse_matrix<T, L>::offsets() const
+{
+    return _offsets.data();
+}
+
+template<class T, class L>
+const size_t* sparse_matrix<T, L>::indices() const
+{
+    return _indices.data();
+}
+
+template<class T, class L>
+T* sparse_matrix<T, L>::values()
+{
+    return _values.data();
+}
+
+template<class T, class L>
+const T* sparse_matrix<T, L>::values() const
+{
+    return _values.data();
+}
+
+template<class T, class L>
+dynamic_vector<T> sparse_matrix<T, L>::diagonal() const
+{
+    dynamic_vector<T> result(std::min(_rows, _columns));
+
+    detail::parallel_for(result.size(), detail::parallel_elementwise(non_zeros()), [&](size_t diagonal) {
+        result[diagonal] = at(diagonal, diagonal);
+    });
+
+    return result;
+}
+
+template<class T, class L>
+sparse_matrix<T, typename sparse_matrix<T, L>::transposed_layout_type> sparse_matrix<T, L>::transposed() const
+{
+    sparse_matrix<T, transposed_layout_type> result;
+
+    result._rows = _columns;
+    result._columns = _rows;
+    result._offsets = _offsets;
+    result._indices = _indices;
+    result._values = _values;
+
+    return result;
+}
+
+template<class T, class L>
+dynamic_matrix<T> sparse_matrix<T, L>::to_dynamic_matrix() const
+{
+    dynamic_matrix<T> result(_rows, _columns);
+
+    //CSR lines are scattered to different rows, so they are copied in parallel (CSC columns write to shared rows)
+    detail::parallel_for(lines(), is_compressed_by_rows && detail::parallel_copy(_rows * _columns * sizeof(T)), [&](size_t line) {
+        for (size_t element = _offsets[line]; element < _offsets[line + 1]; element++)
+        {
+            if constexpr (is_compressed_by_rows)
+            {
+                result[line][_indices[element]] = _values[element];
+            }
+            else
+            {
+                result[_indices[element]][line] = _values[element];
+            }
+        }
+    });
+
+    return result;
+}
+
+template<class T, class L>
+template<size_t N, size_t M>
+matrix<T, N, M> sparse_matrix<T, L>::to_matrix() const
+{
+    matrix<T, N, M> result;
+
+    for (size_t line = 0; line < lines(); line++)
+    {
+        for (size_t element = _offsets[line]; element < _offsets[line + 1]; element++)
+        {
+            const size_t row = is_compressed_by_rows ? line : _indices[element];
+            const size_t column = is_compressed_by_rows ? _indices[element] : line;
+
+            if (row < N && column < M)
+            {
+                result[row][column] = _values[element];
+            }
+        }
+    }
+
+    return result;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "sparse_matrix.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// assembles sparse matrix from entries in coordinate format (COO - row, column and value of every entry)
+/// <para>entries may be added in any order and the same element may be added many times (its entries are summed,
+/// e.g contributions of finite elements to global stiffness matrix), build() sorts them into compressed lines</para>
+///</summary>
+template<class T>
+class sparse_matrix_builder
+{
+    static_assert(is_valid_mathematical_field_v<T>, "Matrix element type must satisfy valid_mathematical_field concept!");
+private:
+    size_t _rows = 0;
+    size_t _columns = 0;
+    detail::storage_vector<size_t> _row_indices;
+    detail::storage_vector<size_t> _column_indices;
+    detail::storage_vector<T> _values;
+public:
+    //constructors
+
+    sparse_matrix_builder() = default;
+
+    sparse_matrix_builder(const sparse_matrix_builder<T>& other) = default;
+
+    sparse_matrix_builder(sparse_matrix_builder<T>&& other) = default;
+
+    sparse_matrix_builder<T>& operator=(const sparse_matrix_builder<T>& other) = default;
+
+    sparse_matrix_builder<T>& operator=(sparse_matrix_builder<T>&& other) = default;
+
+    //builder of rows x columns matrix without entries
+    sparse_matrix_builder(size_t rows, size_t columns);
+public:
+    //assembling
+
+    //reserves memory for given number of entries
+    void reserve(size_t entries);
+
+    //adds value to element (row, column)
+    void add(size_t row, size_t column, const T& value);
+
+    //removes all entries (dimensions are kept)
+    void clear();
+
+    ///<summary>
+    /// sparse matrix with sum of entries of every element (elements without entries are 0)
+    /// <para>row_major layout gives CSR matrix, column_major layout gives CSC matrix</para>
+    ///</summary>
+    template<class L = row_major>
+    sparse_matrix<T, L> build() const;
+public:
+    //builder info
+
+    size_t rows() const;
+    size_t columns() const;
+
+    size_t entries() const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "sparse_matrix_builder.hpp"
+#include "sparse_matrix.inl"
+#include "../kernels/sparse.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T>
+sparse_matrix_builder<T>::sparse_matrix_builder(size_t rows, size_t columns) :
+    _rows(rows),
+    _columns(columns)
+{
+}
+
+template<class T>
+void sparse_matrix_builder<T>::reserve(size_t entries)
+{
+    _row_indices.reserve(entries);
+    _column_indices.reserve(entries);
+    _values.reserve(entries);
+}
+
+template<class T>
+void sparse_matrix_builder<T>::add(size_t row, size_t column, const T& value)
+{
+    assert(row < _rows && column < _columns);
+
+    _row_indices.push_back(row);
+    _column_indices.push_back(column);
+    _values.push_back(value);
+}
+
+template<class T>
+void sparse_matrix_builder<T>::clear()
+{
+    _row_indices.clear();
+    _column_indices.clear();
+    _values.clear();
+}
+
+template<class T>
+template<class L>
+sparse_matrix<T, L> sparse_matrix_builder<T>::build() const
+{
+    sparse_matrix<T, L> result(_rows, _columns);
+
+    //CSR lines are rows (entries are sorted by rows), CSC lines are columns
+    const bool by_rows = std::is_same_v<L, row_major>;
+
+    detail::sparse_compress(
+        by_rows ? _rows : _columns, _values.size(),
+        by_rows ? _row_indices.data() : _column_indices.data(),
+        by_rows ? _column_indices.data() : _row_indices.data(),
+        _values.data(),
+        result._offsets, result._indices, result._values,
+        detail::parallel_elementwise(_values.size())
+    );
+
+    return result;
+}
+
+template<class T>
+size_t sparse_matrix_builder<T>::rows() const
+{
+    return _rows;
+}
+
+template<class T>
+size_t sparse_matrix_builder<T>::columns() const
+{
+    return _columns;
+}
+
+template<class T>
+size_t sparse_matrix_builder<T>::entries() const
+{
+    return _values.size();
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
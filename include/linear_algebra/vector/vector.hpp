@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../linear_algebra_common_functions.hpp"
+#include "../memory/storage_allocator.hpp"
 
 NAMESPACE_LINEAR_ALGEBRA_BEGIN
 
@@ -19,7 +20,7 @@ class vector
     
     template<class TO, size_t DO>
     friend class vector;
-    template<class TO, size_t N, size_t M>
+    template<class TO, size_t N, size_t M, class L>
     friend class matrix;
 public:
 	static constexpr bool is_big_vector = D * sizeof(T) >= static_storage_max_size;
@@ -42,9 +43,11 @@ private:
         inline const T* end() const;
     };
 
+    //memory is taken from storage_allocator (aligned to storage_alignment bytes, resource can be replaced by set_storage_resource)
     class vector_storage_dynamic
     {
     private:
+        storage_allocator<T> _allocator;
         T* _coords = nullptr;
     public:
         inline vector_storage_dynamic();
@@ -149,13 +152,23 @@ public:
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
     vector<T, D>& operator=(std::initializer_list<TO> init_list);
+
+    //from element-wise expression (expression is evaluated in single pass)
+
+    template<class TO, class E, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    vector(const vector_expression<TO, D, E>& expression);
+
+    template<class TO, class E, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    vector<T, D>& operator=(const vector_expression<TO, D, E>& expression);
 public:
     //vector-vector operators
 
-    template<class TO, size_t DO, typename = typename std::enable_if_t<can_be_added_v<T, TO>>>
+    //element-wise operators of big vectors with equal dimensions return vector_expression (see expressions/vector_expression.inl)
+
+    template<class TO, size_t DO, typename = typename std::enable_if_t<can_be_added_v<T, TO> && !detail::use_vector_expression_v<T, D, DO>>>
     vector<addition_result_t<T, TO>, smaller<D, DO>> operator+(const vector<TO, DO>& other) const;
     
-    template<class TO, size_t DO, typename = typename std::enable_if_t<can_be_subtracted_v<T, TO>>>
+    template<class TO, size_t DO, typename = typename std::enable_if_t<can_be_subtracted_v<T, TO> && !detail::use_vector_expression_v<T, D, DO>>>
     vector<subtraction_result_t<T, TO>, smaller<D, DO>> operator-(const vector<TO, DO>& other) const;
     
     //shortcut for inner product
@@ -168,14 +181,21 @@ public:
     template<class TO, size_t DO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
     vector<T, D>& operator-=(const vector<TO, DO>& other);
 
+    template<class TO, class E, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    vector<T, D>& operator+=(const vector_expression<TO, D, E>& expression);
+
+    template<class TO, class E, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
+    vector<T, D>& operator-=(const vector_expression<TO, D, E>& expression);
+
     //vector-scalar operators
 
-    vector<T, D> operator-() const;
+    //returns vector_expression for big vectors
+    auto operator-() const;
 
-    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
+    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T> && !detail::use_vector_expression_v<T, D, D>>>
     vector<multiplication_result_t<T, TO>, D> operator*(const TO& v) const;
     
-    template<class TO, typename = typename std::enable_if_t<can_be_divided_v<T, TO> && std::is_convertible_v<TO, T>>>
+    template<class TO, typename = typename std::enable_if_t<can_be_divided_v<T, TO> && std::is_convertible_v<TO, T> && !detail::use_vector_expression_v<T, D, D>>>
     vector<division_result_t<T, TO>, D> operator/(const TO& v) const;
 
     template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, T>>>
@@ -197,6 +217,11 @@ public:
 
     T* end();
     const T* end() const;
+
+    //view of vector memory (no coordinates are copied, view must not outlive vector)
+
+    vector_view<T> view();
+    vector_view<const T> view() const;
 public:
     //comparison operators
 
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "vector.hpp"
+#include "../simd/simd.hpp"
+#include "../expressions/vector_expression.hpp"
+#include "../expressions/vector_expression.inl"
+#include "../views/vector_view.hpp"
 
 NAMESPACE_LINEAR_ALGEBRA_BEGIN
 
@@ -21,7 +25,7 @@ inline const T& vector<T, D>::vector_storage_static::operator[](size_t d) const
 template<class T, size_t D>
 inline T* vector<T, D>::vector_storage_static::data()
 {
-    return NULL;
+    return _coords;
 }
 
 template<class T, size_t D>
@@ -59,11 +63,12 @@ inline const T* vector<T, D>::vector_storage_static::end() const
 template<class T, size_t D>
 inline vector<T, D>::vector_storage_dynamic::vector_storage_dynamic()
 {
-    _coords = new T[D];
+    _coords = detail::storage_allocate(_allocator, D);
 }
 
 template<class T, size_t D>
-inline vector<T, D>::vector_storage_dynamic::vector_storage_dynamic(typename vector<T, D>::vector_storage_dynamic&& other)
+inline vector<T, D>::vector_storage_dynamic::vector_storage_dynamic(typename vector<T, D>::vector_storage_dynamic&& other) :
+    _allocator(other._allocator)
 {
     _coords = other._coords;
     other._coords = nullptr;
@@ -72,8 +77,9 @@ inline vector<T, D>::vector_storage_dynamic::vector_storage_dynamic(typename vec
 template<class T, size_t D>
 inline typename vector<T, D>::vector_storage_dynamic& vector<T, D>::vector_storage_dynamic::operator=(typename vector<T, D>::vector_storage_dynamic&& other)
 {
-    _coords = other._coords;
-    other._coords = nullptr;
+    //previous memory is released by destructor of other
+    std::swap(_allocator, other._allocator);
+    std::swap(_coords, other._coords);
     return *this;
 }
 
@@ -82,7 +88,7 @@ inline vector<T, D>::vector_storage_dynamic::~vector_storage_dynamic()
 {
     if (_coords)
     {
-        delete[] _coords;
+        detail::storage_deallocate(_allocator, _coords, D);
     }
 }
 
@@ -401,12 +407,37 @@ vector<T, D>& vector<T, D>::operator=(std::initializer_list<TO> init_list)
     return *this;
 }
 
+template<class T, size_t D>
+template<class TO, class E, typename>
+vector<T, D>::vector(const vector_expression<TO, D, E>& expression)
+{
+    //storage is not filled with 0-oes, every coordinate is written by expression
+    detail::evaluate_vector_expression(data(), expression, [](T& coordinate, const TO& value) { coordinate = static_cast<T>(value); });
+}
+
+template<class T, size_t D>
+template<class TO, class E, typename>
+vector<T, D>& vector<T, D>::operator=(const vector_expression<TO, D, E>& expression)
+{
+    detail::evaluate_vector_expression(data(), expression, [](T& coordinate, const TO& value) { coordinate = static_cast<T>(value); });
+    return *this;
+}
+
 template<class T, size_t D>
 template<class TO, size_t DO, typename>
 vector<addition_result_t<T, TO>, smaller<D, DO>> vector<T, D>::operator+(const vector<TO, DO>& other) const
 {
     vector<addition_result_t<T, TO>, smaller<D, DO>> result;
 
+    if constexpr (detail::use_simd_kernels_v<T, TO> && smaller<D, DO> >= detail::simd_kernels_min_size)
+    {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(smaller<D, DO>, detail::parallel_elementwise(smaller<D, DO>), [&](size_t offset, size_t count) {
+            kernels.add(count, data() + offset, other.data() + offset, result.data() + offset);
+        });
+        return result;
+    }
+
     for (size_t d = 0; d < smaller<D, DO>; d++)
     {
         result._coords[d] = _coords[d] + other._coords[d];
@@ -420,6 +451,16 @@ template<class TO, size_t DO, typename>
 vector<subtraction_result_t<T, TO>, smaller<D, DO>> vector<T, D>::operator-(const vector<TO, DO>& other) const
 {
     vector<addition_result_t<T, TO>, smaller<D, DO>> result;
+
+    if constexpr (detail::use_simd_kernels_v<T, TO> && smaller<D, DO> >= detail::simd_kernels_min_size)
+    {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(smaller<D, DO>, detail::parallel_elementwise(smaller<D, DO>), [&](size_t offset, size_t count) {
+            kernels.subtract(count, data() + offset, other.data() + offset, result.data() + offset);
+        });
+        return result;
+    }
+
     for (size_t d = 0; d < smaller<D, DO>; d++)
     {
         result._coords[d] = _coords[d] - other._coords[d];
@@ -439,6 +480,15 @@ template<class T, size_t D>
 template<class TO, size_t DO, typename>
 vector<T, D>& vector<T, D>::operator+=(const vector<TO, DO>& other)
 {
+    if constexpr (detail::use_simd_kernels_v<T, TO> && smaller<D, DO> >= detail::simd_kernels_min_size)
+    {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(smaller<D, DO>, detail::parallel_elementwise(smaller<D, DO>), [&](size_t offset, size_t count) {
+            kernels.add(count, data() + offset, other.data() + offset, data() + offset);
+        });
+        return *this;
+    }
+
     for (size_t d = 0; d < smaller<D, DO>; d++)
     {
         _coords[d] += static_cast<T>(other._coords[d]);
@@ -451,6 +501,15 @@ template<class T, size_t D>
 template<class TO, size_t DO, typename>
 vector<T, D>& vector<T, D>::operator-=(const vector<TO, DO>& other)
 {
+    if constexpr (detail::use_simd_kernels_v<T, TO> && smaller<D, DO> >= detail::simd_kernels_min_size)
+    {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(smaller<D, DO>, detail::parallel_elementwise(smaller<D, DO>), [&](size_t offset, size_t count) {
+            kernels.subtract(count, data() + offset, other.data() + offset, data() + offset);
+        });
+        return *this;
+    }
+
     for (size_t d = 0; d < smaller<D, DO>; d++)
     {
         _coords[d] -= static_cast<T>(other._coords[d]);
@@ -460,16 +519,39 @@ vector<T, D>& vector<T, D>::operator-=(const vector<TO, DO>& other)
 }
 
 template<class T, size_t D>
-vector<T, D> vector<T, D>::operator-() const
+template<class TO, class E, typename>
+vector<T, D>& vector<T, D>::operator+=(const vector_expression<TO, D, E>& expression)
+{
+    detail::evaluate_vector_expression(data(), expression, [](T& coordinate, const TO& value) { coordinate += static_cast<T>(value); });
+    return *this;
+}
+
+template<class T, size_t D>
+template<class TO, class E, typename>
+vector<T, D>& vector<T, D>::operator-=(const vector_expression<TO, D, E>& expression)
 {
-    vector<T, D> result;
+    detail::evaluate_vector_expression(data(), expression, [](T& coordinate, const TO& value) { coordinate -= static_cast<T>(value); });
+    return *this;
+}
 
-    for (size_t d = 0; d < D; d++)
+template<class T, size_t D>
+auto vector<T, D>::operator-() const
+{
+    if constexpr (detail::use_vector_expression_v<T, D, D>)
     {
-        result._coords[d] = -_coords[d];
+        return detail::make_vector_expression<T, D>([coordinates = data()](size_t index) { return -coordinates[index]; });
     }
+    else
+    {
+        vector<T, D> result;
 
-    return result;
+        for (size_t d = 0; d < D; d++)
+        {
+            result._coords[d] = -_coords[d];
+        }
+
+        return result;
+    }
 }
 
 template<class T, size_t D>
@@ -478,6 +560,15 @@ vector<multiplication_result_t<T, TO>, D> vector<T, D>::operator*(const TO& v) c
 {
     vector<multiplication_result_t<T, TO>, D> result;
 
+    if constexpr (detail::has_simd_kernels_v<T> && std::is_same_v<multiplication_result_t<T, TO>, T> && D >= detail::simd_kernels_min_size)
+    {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(D, detail::parallel_elementwise(D), [&](size_t offset, size_t count) {
+            kernels.scale(count, static_cast<T>(v), data() + offset, result.data() + offset);
+        });
+        return result;
+    }
+
     for (size_t d = 0; d < D; d++)
     {
         result._coords[d] = _coords[d] * v;
@@ -492,6 +583,15 @@ vector<division_result_t<T, TO>, D> vector<T, D>::operator/(const TO& v) const
 {
     vector<division_result_t<T, TO>, D> result;
 
+    if constexpr (detail::has_simd_kernels_v<T> && std::is_same_v<division_result_t<T, TO>, T> && D >= detail::simd_kernels_min_size)
+    {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(D, detail::parallel_elementwise(D), [&](size_t offset, size_t count) {
+            kernels.divide(count, static_cast<T>(v), data() + offset, result.data() + offset);
+        });
+        return result;
+    }
+
     for (size_t d = 0; d < D; d++)
     {
         result._coords[d] = _coords[d] / v;
@@ -501,7 +601,7 @@ vector<division_result_t<T, TO>, D> vector<T, D>::operator/(const TO& v) const
 }
 
 template<class T, size_t D, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<T, TO> && std::is_convertible_v<TO, T>>>
-vector<multiplication_result_t<T, TO>, D> operator*(const TO& v, const vector<T, D>& vector)
+auto operator*(const TO& v, const vector<T, D>& vector)
 {
     return vector * v;
 }
@@ -510,6 +610,15 @@ template<class T, size_t D>
 template<class TO, typename>
 vector<T, D>& vector<T, D>::operator*=(const TO& v)
 {
+    if constexpr (detail::has_simd_kernels_v<T> && D >= detail::simd_kernels_min_size)
+    {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(D, detail::parallel_elementwise(D), [&](size_t offset, size_t count) {
+            kernels.scale(count, static_cast<T>(v), data() + offset, data() + offset);
+        });
+        return *this;
+    }
+
     for (size_t d = 0; d < D; d++)
     {
         _coords[d] = _coords[d] * static_cast<T>(v);
@@ -522,6 +631,15 @@ template<class T, size_t D>
 template<class TO, typename>
 vector<T, D>& vector<T, D>::operator/=(const TO& v)
 {
+    if constexpr (detail::has_simd_kernels_v<T> && D >= detail::simd_kernels_min_size)
+    {
+        const auto& kernels = detail::get_simd_kernels<T>();
+        detail::simd_for_each_chunk(D, detail::parallel_elementwise(D), [&](size_t offset, size_t count) {
+            kernels.divide(count, static_cast<T>(v), data() + offset, data() + offset);
+        });
+        return *this;
+    }
+
     for (size_t d = 0; d < D; d++)
     {
         _coords[d] = _coords[d] / static_cast<T>(v);
@@ -545,13 +663,13 @@ const T& vector<T, D>::operator[](size_t d) const
 template<class T, size_t D>
 T* vector<T, D>::data()
 {
-    return _coords;
+    return _coords.data();
 }
 
 template<class T, size_t D>
 const T* vector<T, D>::data() const
 {
-    return _coords;
+    return _coords.data();
 }
 
 template<class T, size_t D>
@@ -578,6 +696,18 @@ const T* vector<T, D>::end() const
     return _coords.end();
 }
 
+template<class T, size_t D>
+vector_view<T> vector<T, D>::view()
+{
+    return vector_view<T>(*this);
+}
+
+template<class T, size_t D>
+vector_view<const T> vector<T, D>::view() const
+{
+    return vector_view<const T>(*this);
+}
+
 template<class T, size_t D>
 template<class TO, size_t DO, typename>
 bool vector<T, D>::operator==(const vector<TO, DO>& other) const
@@ -757,6 +887,11 @@ T vector<T, D>::length() const
 template<class T, size_t D>
 T vector<T, D>::magnitude_sqr() const
 {
+    if constexpr (detail::has_simd_kernels_v<T> && D >= detail::simd_kernels_min_size)
+    {
+        return detail::get_simd_kernels<T>().dot(D, data(), data());
+    }
+
     return std::inner_product(_coords.begin(), _coords.end(), _coords.begin(), get_additive_identity<T>());
 }
 
@@ -785,6 +920,11 @@ template<class T, size_t D>
 template<class TO, typename>
 inner_product_result_t<T, TO> vector<T, D>::inner_product(const vector<TO, D>& other) const
 {
+    if constexpr (detail::use_simd_kernels_v<T, TO> && D >= detail::simd_kernels_min_size)
+    {
+        return detail::get_simd_kernels<T>().dot(D, data(), other.data());
+    }
+
     return std::inner_product(_coords.begin(), _coords.end(), other._coords.begin(), get_additive_identity<inner_product_result_t<T, TO>>());
 }
 
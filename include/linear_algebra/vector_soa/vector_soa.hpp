@@ -0,0 +1,178 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+#include "../vector/vector.hpp"
+#include "../matrix/matrix.hpp"
+#include "../dynamic_vector/dynamic_vector.hpp"
+#include "../batch/batch_span.hpp"
+
+#include <array>
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+///<summary>
+/// reference to vector stored in vector_soa (coordinates of vector are in separate arrays)
+/// <para>converts to vector and can be assigned from it, coordinates are accessed as in vector</para>
+/// <para>reference must not outlive collection, it becomes invalid when collection is resized</para>
+///</summary>
+template<class T, size_t D>
+class vector_soa_reference
+{
+    template<class TO, size_t DO>
+    friend class vector_soa;
+private:
+    vector_soa<T, D>* _collection;
+    size_t _index;
+private:
+    vector_soa_reference(vector_soa<T, D>* collection, size_t index);
+public:
+    vector_soa_reference(const vector_soa_reference<T, D>& other) = default;
+
+    //assigns coordinates (not reference)
+    vector_soa_reference<T, D>& operator=(const vector_soa_reference<T, D>& other);
+
+    vector_soa_reference<T, D>& operator=(const vector<T, D>& other);
+
+    operator vector<T, D>() const;
+public:
+    vector_soa_reference<T, D>& operator+=(const vector<T, D>& other);
+    vector_soa_reference<T, D>& operator-=(const vector<T, D>& other);
+    vector_soa_reference<T, D>& operator*=(const T& v);
+    vector_soa_reference<T, D>& operator/=(const T& v);
+public:
+    T& operator[](size_t d) const;
+
+    constexpr size_t size() const;
+    constexpr size_t dimension() const;
+};
+
+///<summary>
+/// collection of vectors of dimension D stored as structure of arrays (every coordinate in separate contiguous array)
+/// <para>bulk operations (transformation, addition, inner products, normalization) process coordinates of many vectors
+/// at once with full simd width, big collections (e.g point clouds) are processed in parallel</para>
+/// <para>element access returns vector_soa_reference, which behaves as reference to vector</para>
+///</summary>
+template<class T, size_t D>
+class vector_soa
+{
+    static_assert(is_valid_mathematical_field_v<T>, "Vector element type must satisfy valid_mathematical_field concept!");
+    static_assert(D > 0, "Vector dimension must be greater than 0!");
+
+    template<class TO, size_t DO>
+    friend class vector_soa_reference;
+private:
+    std::array<detail::storage_vector<T>, D> _components;
+public:
+    using mathematical_field_type = T;
+    using reference = vector_soa_reference<T, D>;
+public:
+    //default constructor (empty collection)
+
+    vector_soa() = default;
+
+    //copy, move constructors and operators
+
+    vector_soa(const vector_soa<T, D>& other) = default;
+
+    vector_soa(vector_soa<T, D>&& other) = default;
+
+    vector_soa<T, D>& operator=(const vector_soa<T, D>& other) = default;
+
+    vector_soa<T, D>& operator=(vector_soa<T, D>&& other) = default;
+
+    //regular constructors
+
+    //all vectors are 0
+    explicit vector_soa(size_t size);
+
+    vector_soa(size_t size, const vector<T, D>& v);
+
+    vector_soa(std::initializer_list<vector<T, D>> init_list);
+
+    //copies vectors stored as array of structures (e.g std::vector of vectors)
+    explicit vector_soa(batch_span<const vector<T, D>> vectors);
+public:
+    //collection-collection operators (applied to every pair of vectors, collections must have the same size)
+
+    vector_soa<T, D> operator+(const vector_soa<T, D>& other) const;
+    vector_soa<T, D> operator-(const vector_soa<T, D>& other) const;
+
+    vector_soa<T, D>& operator+=(const vector_soa<T, D>& other);
+    vector_soa<T, D>& operator-=(const vector_soa<T, D>& other);
+
+    //collection-vector operators (applied to every vector, e.g translation of point cloud)
+
+    vector_soa<T, D> operator+(const vector<T, D>& v) const;
+    vector_soa<T, D> operator-(const vector<T, D>& v) const;
+
+    vector_soa<T, D>& operator+=(const vector<T, D>& v);
+    vector_soa<T, D>& operator-=(const vector<T, D>& v);
+
+    //collection-scalar operators
+
+    vector_soa<T, D> operator*(const T& v) const;
+    vector_soa<T, D> operator/(const T& v) const;
+
+    vector_soa<T, D>& operator*=(const T& v);
+    vector_soa<T, D>& operator/=(const T& v);
+public:
+    //collection info and accessors
+
+    size_t size() const;
+    bool empty() const;
+    constexpr size_t dimension() const;
+
+    //new vectors are 0
+    void resize(size_t size);
+    void reserve(size_t size);
+    void clear();
+
+    void push_back(const vector<T, D>& v);
+    void pop_back();
+
+    //collections with as many elements as parallel element-wise operation are processed in parallel (see parallel_thresholds)
+    bool is_big_collection() const;
+
+    reference operator[](size_t index);
+    vector<T, D> operator[](size_t index) const;
+
+    //contiguous array of d-th coordinates of all vectors
+
+    T* data(size_t d);
+    const T* data(size_t d) const;
+
+    vector_view<T> component(size_t d);
+    vector_view<const T> component(size_t d) const;
+
+    //copies vectors to array of structures (span must have the same size as collection)
+    void copy_to(batch_span<vector<T, D>> vectors) const;
+public:
+    //bulk operations
+
+    //every vector v is replaced with m * v
+    vector_soa<T, D>& transform(const matrix<T, D, D>& m);
+    vector_soa<T, D> transformed(const matrix<T, D, D>& m) const;
+
+    //result[i] = inner product of i-th vectors of both collections
+    dynamic_vector<T> inner_product(const vector_soa<T, D>& other) const;
+    //result[i] = inner product of i-th vector and v
+    dynamic_vector<T> inner_product(const vector<T, D>& v) const;
+
+    template<typename = typename std::enable_if_t<has_sqrt_implementation_v<T>>>
+    dynamic_vector<T> magnitudes() const;
+    template<typename = typename std::enable_if_t<has_sqrt_implementation_v<T>>>
+    dynamic_vector<T> lengths() const;
+
+    dynamic_vector<T> magnitudes_sqr() const;
+    dynamic_vector<T> lengths_sqr() const;
+
+    template<typename = typename std::enable_if_t<has_sqrt_implementation_v<T>>>
+    vector_soa<T, D> normalized() const;
+    template<typename = typename std::enable_if_t<has_sqrt_implementation_v<T>>>
+    vector_soa<T, D>& normalize();
+private:
+    std::array<T*, D> components();
+    std::array<const T*, D> components() const;
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,517 @@
+#pragma once
+
+#include "vector_soa.hpp"
+#include "../vector/vector.inl"
+#include "../matrix/matrix.inl"
+#include "../dynamic_vector/dynamic_vector.inl"
+#include "../views/vector_view.hpp"
+#include "../kernels/elementwise.hpp"
+#include "../kernels/soa.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+//vector_soa_reference
+
+template<class T, size_t D>
+vector_soa_reference<T, D>::vector_soa_reference(vector_soa<T, D>* collection, size_t index) :
+    _collection(collection),
+    _index(index)
+{
+}
+
+template<class T, size_t D>
+vector_soa_reference<T, D>& vector_soa_reference<T, D>::operator=(const vector_soa_reference<T, D>& other)
+{
+    return *this = static_cast<vector<T, D>>(other);
+}
+
+template<class T, size_t D>
+vector_soa_reference<T, D>& vector_soa_reference<T, D>::operator=(const vector<T, D>& other)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        (*this)[d] = other[d];
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa_reference<T, D>::operator vector<T, D>() const
+{
+    vector<T, D> result;
+
+    for (size_t d = 0; d < D; d++)
+    {
+        result[d] = (*this)[d];
+    }
+
+    return result;
+}
+
+template<class T, size_t D>
+vector_soa_reference<T, D>& vector_soa_reference<T, D>::operator+=(const vector<T, D>& other)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        (*this)[d] += other[d];
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa_reference<T, D>& vector_soa_reference<T, D>::operator-=(const vector<T, D>& other)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        (*this)[d] -= other[d];
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa_reference<T, D>& vector_soa_reference<T, D>::operator*=(const T& v)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        (*this)[d] *= v;
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa_reference<T, D>& vector_soa_reference<T, D>::operator/=(const T& v)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        (*this)[d] /= v;
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+T& vector_soa_reference<T, D>::operator[](size_t d) const
+{
+    assert(d < D);
+    return _collection->_components[d][_index];
+}
+
+template<class T, size_t D>
+constexpr size_t vector_soa_reference<T, D>::size() const
+{
+    return D;
+}
+
+template<class T, size_t D>
+constexpr size_t vector_soa_reference<T, D>::dimension() const
+{
+    return D;
+}
+
+//vector_soa
+
+template<class T, size_t D>
+vector_soa<T, D>::vector_soa(size_t size)
+{
+    resize(size);
+}
+
+template<class T, size_t D>
+vector_soa<T, D>::vector_soa(size_t size, const vector<T, D>& v)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        _components[d].assign(size, v[d]);
+    }
+}
+
+template<class T, size_t D>
+vector_soa<T, D>::vector_soa(std::initializer_list<vector<T, D>> init_list) :
+    vector_soa(batch_span<const vector<T, D>>(init_list.begin(), init_list.size()))
+{
+}
+
+template<class T, size_t D>
+vector_soa<T, D>::vector_soa(batch_span<const vector<T, D>> vectors)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        _components[d].resize(vectors.size());
+
+        T* component = _components[d].data();
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+            component[i] = vectors[i][d];
+        }
+    }
+}
+
+template<class T, size_t D>
+vector_soa<T, D> vector_soa<T, D>::operator+(const vector_soa<T, D>& other) const
+{
+    vector_soa<T, D> result(*this);
+    result += other;
+    return result;
+}
+
+template<class T, size_t D>
+vector_soa<T, D> vector_soa<T, D>::operator-(const vector_soa<T, D>& other) const
+{
+    vector_soa<T, D> result(*this);
+    result -= other;
+    return result;
+}
+
+template<class T, size_t D>
+vector_soa<T, D>& vector_soa<T, D>::operator+=(const vector_soa<T, D>& other)
+{
+    assert(size() == other.size());
+
+    for (size_t d = 0; d < D; d++)
+    {
+        detail::elementwise_add(size(), data(d), other.data(d), data(d), is_big_collection());
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa<T, D>& vector_soa<T, D>::operator-=(const vector_soa<T, D>& other)
+{
+    assert(size() == other.size());
+
+    for (size_t d = 0; d < D; d++)
+    {
+        detail::elementwise_subtract(size(), data(d), other.data(d), data(d), is_big_collection());
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa<T, D> vector_soa<T, D>::operator+(const vector<T, D>& v) const
+{
+    vector_soa<T, D> result(*this);
+    result += v;
+    return result;
+}
+
+template<class T, size_t D>
+vector_soa<T, D> vector_soa<T, D>::operator-(const vector<T, D>& v) const
+{
+    vector_soa<T, D> result(*this);
+    result -= v;
+    return result;
+}
+
+template<class T, size_t D>
+vector_soa<T, D>& vector_soa<T, D>::operator+=(const vector<T, D>& v)
+{
+    auto x = components();
+    detail::soa_translate<T, D>(size(), v.data(), x.data(), x.data(), is_big_collection());
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa<T, D>& vector_soa<T, D>::operator-=(const vector<T, D>& v)
+{
+    return *this += -v;
+}
+
+template<class T, size_t D>
+vector_soa<T, D> vector_soa<T, D>::operator*(const T& v) const
+{
+    vector_soa<T, D> result(*this);
+    result *= v;
+    return result;
+}
+
+template<class T, size_t D>
+vector_soa<T, D> vector_soa<T, D>::operator/(const T& v) const
+{
+    vector_soa<T, D> result(*this);
+    result /= v;
+    return result;
+}
+
+template<class T, size_t D>
+vector_soa<T, D>& vector_soa<T, D>::operator*=(const T& v)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        detail::elementwise_scale(size(), data(d), v, data(d), is_big_collection());
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa<T, D>& vector_soa<T, D>::operator/=(const T& v)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        detail::elementwise_divide(size(), data(d), v, data(d), is_big_collection());
+    }
+
+    return *this;
+}
+
+template<class T, size_t D>
+size_t vector_soa<T, D>::size() const
+{
+    return _components[0].size();
+}
+
+template<class T, size_t D>
+bool vector_soa<T, D>::empty() const
+{
+    return _components[0].empty();
+}
+
+template<class T, size_t D>
+constexpr size_t vector_soa<T, D>::dimension() const
+{
+    return D;
+}
+
+template<class T, size_t D>
+void vector_soa<T, D>::resize(size_t size)
+{
+    for (auto& component : _components)
+    {
+        component.resize(size, get_additive_identity<T>());
+    }
+}
+
+template<class T, size_t D>
+void vector_soa<T, D>::reserve(size_t size)
+{
+    for (auto& component : _components)
+    {
+        component.reserve(size);
+    }
+}
+
+template<class T, size_t D>
+void vector_soa<T, D>::clear()
+{
+    for (auto& component : _components)
+    {
+        component.clear();
+    }
+}
+
+template<class T, size_t D>
+void vector_soa<T, D>::push_back(const vector<T, D>& v)
+{
+    for (size_t d = 0; d < D; d++)
+    {
+        _components[d].push_back(v[d]);
+    }
+}
+
+template<class T, size_t D>
+void vector_soa<T, D>::pop_back()
+{
+    assert(!empty());
+
+    for (auto& component : _components)
+    {
+        component.pop_back();
+    }
+}
+
+template<class T, size_t D>
+bool vector_soa<T, D>::is_big_collection() const
+{
+    return detail::parallel_elementwise(size() * D);
+}
+
+template<class T, size_t D>
+typename vector_soa<T, D>::reference vector_soa<T, D>::operator[](size_t index)
+{
+    assert(index < size());
+    return reference(this, index);
+}
+
+template<class T, size_t D>
+vector<T, D> vector_soa<T, D>::operator[](size_t index) const
+{
+    assert(index < size());
+
+    vector<T, D> result;
+
+    for (size_t d = 0; d < D; d++)
+    {
+        result[d] = _components[d][index];
+    }
+
+    return result;
+}
+
+template<class T, size_t D>
+T* vector_soa<T, D>::data(size_t d)
+{
+    assert(d < D);
+    return _components[d].data();
+}
+
+template<class T, size_t D>
+const T* vector_soa<T, D>::data(size_t d) const
+{
+    assert(d < D);
+    return _components[d].data();
+}
+
+template<class T, size_t D>
+vector_view<T> vector_soa<T, D>::component(size_t d)
+{
+    return vector_view<T>(data(d), size());
+}
+
+template<class T, size_t D>
+vector_view<const T> vector_soa<T, D>::component(size_t d) const
+{
+    return vector_view<const T>(data(d), size());
+}
+
+template<class T, size_t D>
+void vector_soa<T, D>::copy_to(batch_span<vector<T, D>> vectors) const
+{
+    assert(vectors.size() == size());
+
+    for (size_t d = 0; d < D; d++)
+    {
+        const T* component = _components[d].data();
+        for (size_t i = 0; i < vectors.size(); i++)
+        {
+            vectors[i][d] = component[i];
+        }
+    }
+}
+
+template<class T, size_t D>
+vector_soa<T, D>& vector_soa<T, D>::transform(const matrix<T, D, D>& m)
+{
+    auto x = components();
+    detail::soa_transform<T, D>(size(), m.data(), x.data(), x.data(), is_big_collection());
+    return *this;
+}
+
+template<class T, size_t D>
+vector_soa<T, D> vector_soa<T, D>::transformed(const matrix<T, D, D>& m) const
+{
+    vector_soa<T, D> result(size());
+
+    auto x = components();
+    auto out = result.components();
+    detail::soa_transform<T, D>(size(), m.data(), x.data(), out.data(), is_big_collection());
+
+    return result;
+}
+
+template<class T, size_t D>
+dynamic_vector<T> vector_soa<T, D>::inner_product(const vector_soa<T, D>& other) const
+{
+    assert(size() == other.size());
+
+    dynamic_vector<T> result(size());
+
+    auto x = components();
+    auto y = other.components();
+    detail::soa_dot<T, D>(size(), x.data(), y.data(), result.data(), is_big_collection());
+
+    return result;
+}
+
+template<class T, size_t D>
+dynamic_vector<T> vector_soa<T, D>::inner_product(const vector<T, D>& v) const
+{
+    dynamic_vector<T> result(size());
+
+    auto x = components();
+    detail::soa_dot<T, D>(size(), x.data(), v.data(), result.data(), is_big_collection());
+
+    return result;
+}
+
+template<class T, size_t D>
+template<typename>
+dynamic_vector<T> vector_soa<T, D>::magnitudes() const
+{
+    dynamic_vector<T> result(size());
+
+    auto x = components();
+    detail::soa_length<T, D>(size(), x.data(), result.data(), is_big_collection());
+
+    return result;
+}
+
+template<class T, size_t D>
+template<typename>
+dynamic_vector<T> vector_soa<T, D>::lengths() const
+{
+    return magnitudes();
+}
+
+template<class T, size_t D>
+dynamic_vector<T> vector_soa<T, D>::magnitudes_sqr() const
+{
+    return inner_product(*this);
+}
+
+template<class T, size_t D>
+dynamic_vector<T> vector_soa<T, D>::lengths_sqr() const
+{
+    return magnitudes_sqr();
+}
+
+template<class T, size_t D>
+template<typename>
+vector_soa<T, D> vector_soa<T, D>::normalized() const
+{
+    vector_soa<T, D> result(*this);
+    result.normalize();
+    return result;
+}
+
+template<class T, size_t D>
+template<typename>
+vector_soa<T, D>& vector_soa<T, D>::normalize()
+{
+    auto x = components();
+    detail::soa_normalize<T, D>(size(), x.data(), is_big_collection());
+    return *this;
+}
+
+template<class T, size_t D>
+std::array<T*, D> vector_soa<T, D>::components()
+{
+    std::array<T*, D> result;
+
+    for (size_t d = 0; d < D; d++)
+    {
+        result[d] = _components[d].data();
+    }
+
+    return result;
+}
+
+template<class T, size_t D>
+std::array<const T*, D> vector_soa<T, D>::components() const
+{
+    std::array<const T*, D> result;
+
+    for (size_t d = 0; d < D; d++)
+    {
+        result[d] = _components[d].data();
+    }
+
+    return result;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_END
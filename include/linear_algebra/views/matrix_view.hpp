@@ -0,0 +1,163 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+#include "../matrix/matrix.hpp"
+#include "../dynamic_matrix/dynamic_matrix.hpp"
+#include "vector_view.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
+
+template<class TO>
+std::ostream& operator<<(std::ostream& os, const matrix_view<TO>& m);
+
+NAMESPACE_LINEAR_ALGEBRA_IO_END
+
+///<summary>
+/// non-owning view of rows x columns elements, element (row, column) is placed at data[row * row_stride + column * column_stride]
+/// <para>blocks, rows, columns, diagonal and transposition of view are views of the same memory (no elements are copied)</para>
+/// <para>copying view does not copy elements, but assigning to view copies elements to viewed memory</para>
+/// <para>matrix_view of const T is read-only, views of matrices are implicitly converted to it</para>
+/// <para>view must not outlive memory it refers to</para>
+///</summary>
+template<class T>
+class matrix_view
+{
+public:
+    using mathematical_field_type = std::remove_const_t<T>;
+private:
+    static_assert(is_valid_mathematical_field_v<mathematical_field_type>, "Matrix element type must satisfy valid_mathematical_field concept!");
+
+    template<class TO>
+    friend class matrix_view;
+
+    T* _data = nullptr;
+    size_t _rows = 0;
+    size_t _columns = 0;
+    size_t _row_stride = 0;
+    size_t _column_stride = 1;
+private:
+    //big views are multiplied by packed kernels (same rule as for matrix storage)
+    bool is_big_view() const;
+public:
+    //constructors
+
+    matrix_view() = default;
+
+    matrix_view(T* data, size_t rows, size_t columns, size_t row_stride, size_t column_stride = 1);
+
+    matrix_view(const matrix_view<T>& other) = default;
+
+    //read-write view to read-only view
+    template<class TO, typename = typename std::enable_if_t<!std::is_same_v<TO, T> && std::is_convertible_v<TO*, T*>>>
+    matrix_view(const matrix_view<TO>& other);
+
+    //views of whole matrices (with strided layouts, e.g row-major and column-major)
+
+    template<class TO, size_t N, size_t M, class LO, typename = typename std::enable_if_t<std::is_convertible_v<TO*, T*> && LO::is_strided>>
+    matrix_view(matrix<TO, N, M, LO>& m);
+
+    template<class TO, size_t N, size_t M, class LO, typename = typename std::enable_if_t<std::is_convertible_v<const TO*, T*> && LO::is_strided>>
+    matrix_view(const matrix<TO, N, M, LO>& m);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO*, T*>>>
+    matrix_view(dynamic_matrix<TO>& m);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<const TO*, T*>>>
+    matrix_view(const dynamic_matrix<TO>& m);
+
+    //assignment copies elements (dimensions must be equal)
+
+    matrix_view<T>& operator=(const matrix_view<T>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<std::remove_const_t<TO>, mathematical_field_type>>>
+    matrix_view<T>& operator=(const matrix_view<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, mathematical_field_type>>>
+    matrix_view<T>& operator=(const dynamic_matrix<TO>& other);
+public:
+    //view-view operators (results are stored in dynamic_matrix)
+
+    template<class TO, typename = typename std::enable_if_t<can_be_added_v<mathematical_field_type, std::remove_const_t<TO>>>>
+    dynamic_matrix<addition_result_t<mathematical_field_type, std::remove_const_t<TO>>> operator+(const matrix_view<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_subtracted_v<mathematical_field_type, std::remove_const_t<TO>>>>
+    dynamic_matrix<subtraction_result_t<mathematical_field_type, std::remove_const_t<TO>>> operator-(const matrix_view<TO>& other) const;
+
+    //number of columns of this view must be equal to number of rows of other one
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<mathematical_field_type, std::remove_const_t<TO>>>>
+    dynamic_matrix<inner_product_result_t<mathematical_field_type, std::remove_const_t<TO>>> operator*(const matrix_view<TO>& other) const;
+
+    //in place operators write to viewed memory
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<std::remove_const_t<TO>, mathematical_field_type>>>
+    matrix_view<T>& operator+=(const matrix_view<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<std::remove_const_t<TO>, mathematical_field_type>>>
+    matrix_view<T>& operator-=(const matrix_view<TO>& other);
+
+    //viewed memory = alpha * a * b + beta * viewed memory (single GEMM call, view must have a.rows() x b.columns() size and must not overlap a or b)
+    template<class TA, class TB, class TS>
+    matrix_view<T>& multiply_add(const TS& alpha, const matrix_view<TA>& a, const matrix_view<TB>& b, const TS& beta);
+
+    //view-scalar operators
+
+    dynamic_matrix<mathematical_field_type> operator-() const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<mathematical_field_type, TO> && std::is_convertible_v<TO, mathematical_field_type>>>
+    dynamic_matrix<multiplication_result_t<mathematical_field_type, TO>> operator*(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_divided_v<mathematical_field_type, TO> && std::is_convertible_v<TO, mathematical_field_type>>>
+    dynamic_matrix<division_result_t<mathematical_field_type, TO>> operator/(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, mathematical_field_type>>>
+    matrix_view<T>& operator*=(const TO& v);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, mathematical_field_type>>>
+    matrix_view<T>& operator/=(const TO& v);
+
+    //view-vector operators
+
+    //vector must have columns() coordinates
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<mathematical_field_type, std::remove_const_t<TO>>>>
+    dynamic_vector<inner_product_result_t<mathematical_field_type, std::remove_const_t<TO>>> operator*(const vector_view<TO>& vec) const;
+public:
+    //view info and accessors
+
+    size_t rows() const;
+    size_t columns() const;
+    size_t row_stride() const;
+    size_t column_stride() const;
+
+    //elements are placed row by row without gaps (as in matrix)
+    bool is_contiguous() const;
+
+    T& operator()(size_t row, size_t column) const;
+
+    //view of given row
+    vector_view<T> operator[](size_t row) const;
+
+    T* data() const;
+public:
+    //views of parts of viewed memory
+
+    matrix_view<T> block(size_t row, size_t column, size_t rows, size_t columns) const;
+
+    template<size_t R, size_t C>
+    matrix_view<T> block(size_t row, size_t column) const;
+
+    vector_view<T> row(size_t row) const;
+    vector_view<T> column(size_t column) const;
+
+    //main diagonal (min(rows(), columns()) elements)
+    vector_view<T> diagonal() const;
+
+    //view with swapped rows and columns
+    matrix_view<T> transposed() const;
+public:
+    template<class TO>
+    friend std::ostream& LINEAR_ALGEBRA_IO::operator<<(std::ostream& os, const matrix_view<TO>& m);
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
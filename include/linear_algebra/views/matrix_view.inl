@@ -0,0 +1,506 @@
+#pragma once
+
+#include "matrix_view.hpp"
+#include "vector_view.inl"
+#include "../dynamic_matrix/dynamic_matrix.inl"
+#include "../kernels/elementwise.hpp"
+#include "../kernels/gemm.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+namespace detail
+{
+    //calls operation(row, column) for every element of rows x columns part of view (rows are processed in parallel if requested)
+    template<class F>
+    inline void matrix_view_for_each(size_t rows, size_t columns, bool parallel, F&& operation)
+    {
+        parallel_for(rows, parallel, [&](size_t row) {
+            for (size_t column = 0; column < columns; column++)
+            {
+                operation(row, column);
+            }
+        });
+    }
+
+    //applies element-wise kernel (n, x, out, parallel) on every row of views with unit column stride
+    //if rows of both views are contiguous, kernel is applied once on whole data
+    template<class T, class TR, class F>
+    inline void matrix_view_rows(size_t rows, size_t columns, const T* x, size_t ldx, TR* out, size_t ldout, bool parallel, F&& kernel)
+    {
+        if (ldx == columns && ldout == columns)
+        {
+            kernel(rows * columns, x, out, parallel);
+            return;
+        }
+
+        for (size_t row = 0; row < rows; row++)
+        {
+            kernel(columns, x + row * ldx, out + row * ldout, false);
+        }
+    }
+}
+
+template<class T>
+bool matrix_view<T>::is_big_view() const
+{
+    return _rows * _columns * sizeof(T) >= static_storage_max_size;
+}
+
+template<class T>
+matrix_view<T>::matrix_view(T* data, size_t rows, size_t columns, size_t row_stride, size_t column_stride) :
+    _data(data),
+    _rows(rows),
+    _columns(columns),
+    _row_stride(row_stride),
+    _column_stride(column_stride)
+{
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>::matrix_view(const matrix_view<TO>& other) :
+    _data(other._data),
+    _rows(other._rows),
+    _columns(other._columns),
+    _row_stride(other._row_stride),
+    _column_stride(other._column_stride)
+{
+}
+
+template<class T>
+template<class TO, size_t N, size_t M, class LO, typename>
+matrix_view<T>::matrix_view(matrix<TO, N, M, LO>& m) :
+    _data(m.data()),
+    _rows(N),
+    _columns(M),
+    _row_stride(LO::row_stride(N, M)),
+    _column_stride(LO::column_stride(N, M))
+{
+}
+
+template<class T>
+template<class TO, size_t N, size_t M, class LO, typename>
+matrix_view<T>::matrix_view(const matrix<TO, N, M, LO>& m) :
+    _data(m.data()),
+    _rows(N),
+    _columns(M),
+    _row_stride(LO::row_stride(N, M)),
+    _column_stride(LO::column_stride(N, M))
+{
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>::matrix_view(dynamic_matrix<TO>& m) :
+    _data(m.data()),
+    _rows(m.rows()),
+    _columns(m.columns()),
+    _row_stride(m.columns())
+{
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>::matrix_view(const dynamic_matrix<TO>& m) :
+    _data(m.data()),
+    _rows(m.rows()),
+    _columns(m.columns()),
+    _row_stride(m.columns())
+{
+}
+
+template<class T>
+matrix_view<T>& matrix_view<T>::operator=(const matrix_view<T>& other)
+{
+    return operator=<T>(other);
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>& matrix_view<T>::operator=(const matrix_view<TO>& other)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+    assert(_rows == other._rows && _columns == other._columns);
+
+    detail::matrix_view_for_each(_rows, _columns, detail::parallel_copy(_rows * _columns * sizeof(T)), [&](size_t row, size_t column) {
+        (*this)(row, column) = static_cast<mathematical_field_type>(other(row, column));
+    });
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>& matrix_view<T>::operator=(const dynamic_matrix<TO>& other)
+{
+    return operator=(matrix_view<const TO>(other));
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<addition_result_t<typename matrix_view<T>::mathematical_field_type, std::remove_const_t<TO>>> matrix_view<T>::operator+(const matrix_view<TO>& other) const
+{
+    dynamic_matrix<addition_result_t<mathematical_field_type, std::remove_const_t<TO>>> result(std::min(_rows, other._rows), std::min(_columns, other._columns));
+
+    if (_column_stride == 1 && other._column_stride == 1)
+    {
+        detail::dynamic_matrix_elementwise(result.rows(), result.columns(), _data, _row_stride, other._data, other._row_stride, result.data(), result.columns(), detail::parallel_elementwise(result.rows() * result.columns()),
+            [](size_t n, const auto* x, const auto* y, auto* out, bool parallel) { detail::elementwise_add(n, x, y, out, parallel); });
+
+        return result;
+    }
+
+    detail::matrix_view_for_each(result.rows(), result.columns(), detail::parallel_elementwise(result.rows() * result.columns()), [&](size_t row, size_t column) {
+        result[row][column] = (*this)(row, column) + other(row, column);
+    });
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<subtraction_result_t<typename matrix_view<T>::mathematical_field_type, std::remove_const_t<TO>>> matrix_view<T>::operator-(const matrix_view<TO>& other) const
+{
+    dynamic_matrix<subtraction_result_t<mathematical_field_type, std::remove_const_t<TO>>> result(std::min(_rows, other._rows), std::min(_columns, other._columns));
+
+    if (_column_stride == 1 && other._column_stride == 1)
+    {
+        detail::dynamic_matrix_elementwise(result.rows(), result.columns(), _data, _row_stride, other._data, other._row_stride, result.data(), result.columns(), detail::parallel_elementwise(result.rows() * result.columns()),
+            [](size_t n, const auto* x, const auto* y, auto* out, bool parallel) { detail::elementwise_subtract(n, x, y, out, parallel); });
+
+        return result;
+    }
+
+    detail::matrix_view_for_each(result.rows(), result.columns(), detail::parallel_elementwise(result.rows() * result.columns()), [&](size_t row, size_t column) {
+        result[row][column] = (*this)(row, column) - other(row, column);
+    });
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<inner_product_result_t<typename matrix_view<T>::mathematical_field_type, std::remove_const_t<TO>>> matrix_view<T>::operator*(const matrix_view<TO>& other) const
+{
+    using result_type = inner_product_result_t<mathematical_field_type, std::remove_const_t<TO>>;
+
+    dynamic_matrix<result_type> result(_rows, other._columns);
+
+    matrix_view<result_type>(result).multiply_add(get_multiplicative_identity<result_type>(), *this, other, get_additive_identity<result_type>());
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>& matrix_view<T>::operator+=(const matrix_view<TO>& other)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+
+    const size_t rows = std::min(_rows, other._rows);
+    const size_t columns = std::min(_columns, other._columns);
+
+    if (_column_stride == 1 && other._column_stride == 1)
+    {
+        detail::dynamic_matrix_elementwise(rows, columns, _data, _row_stride, other._data, other._row_stride, _data, _row_stride, detail::parallel_elementwise(rows * columns),
+            [](size_t n, const auto* x, const auto* y, auto* out, bool parallel) { detail::elementwise_add(n, x, y, out, parallel); });
+
+        return *this;
+    }
+
+    detail::matrix_view_for_each(rows, columns, detail::parallel_elementwise(rows * columns), [&](size_t row, size_t column) {
+        (*this)(row, column) += static_cast<mathematical_field_type>(other(row, column));
+    });
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>& matrix_view<T>::operator-=(const matrix_view<TO>& other)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+
+    const size_t rows = std::min(_rows, other._rows);
+    const size_t columns = std::min(_columns, other._columns);
+
+    if (_column_stride == 1 && other._column_stride == 1)
+    {
+        detail::dynamic_matrix_elementwise(rows, columns, _data, _row_stride, other._data, other._row_stride, _data, _row_stride, detail::parallel_elementwise(rows * columns),
+            [](size_t n, const auto* x, const auto* y, auto* out, bool parallel) { detail::elementwise_subtract(n, x, y, out, parallel); });
+
+        return *this;
+    }
+
+    detail::matrix_view_for_each(rows, columns, detail::parallel_elementwise(rows * columns), [&](size_t row, size_t column) {
+        (*this)(row, column) -= static_cast<mathematical_field_type>(other(row, column));
+    });
+
+    return *this;
+}
+
+template<class T>
+template<class TA, class TB, class TS>
+matrix_view<T>& matrix_view<T>::multiply_add(const TS& alpha, const matrix_view<TA>& a, const matrix_view<TB>& b, const TS& beta)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+    assert(a._columns == b._rows && _rows == a._rows && _columns == b._columns);
+
+    detail::multiply_add(
+        a._rows, b._columns, a._columns,
+        alpha,
+        a._data, a._row_stride, a._column_stride,
+        b._data, b._row_stride, b._column_stride,
+        beta,
+        _data, _row_stride, _column_stride,
+        a.is_big_view() || b.is_big_view()
+    );
+
+    return *this;
+}
+
+template<class T>
+dynamic_matrix<typename matrix_view<T>::mathematical_field_type> matrix_view<T>::operator-() const
+{
+    dynamic_matrix<mathematical_field_type> result(_rows, _columns);
+
+    if (_column_stride == 1)
+    {
+        detail::matrix_view_rows(_rows, _columns, _data, _row_stride, result.data(), _columns, detail::parallel_elementwise(_rows * _columns),
+            [](size_t n, const auto* x, auto* out, bool parallel) { detail::elementwise_negate(n, x, out, parallel); });
+
+        return result;
+    }
+
+    detail::matrix_view_for_each(_rows, _columns, detail::parallel_elementwise(_rows * _columns), [&](size_t row, size_t column) {
+        result[row][column] = -(*this)(row, column);
+    });
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<multiplication_result_t<typename matrix_view<T>::mathematical_field_type, TO>> matrix_view<T>::operator*(const TO& v) const
+{
+    dynamic_matrix<multiplication_result_t<mathematical_field_type, TO>> result(_rows, _columns);
+
+    if (_column_stride == 1)
+    {
+        detail::matrix_view_rows(_rows, _columns, _data, _row_stride, result.data(), _columns, detail::parallel_elementwise(_rows * _columns),
+            [&](size_t n, const auto* x, auto* out, bool parallel) { detail::elementwise_scale(n, x, v, out, parallel); });
+
+        return result;
+    }
+
+    detail::matrix_view_for_each(_rows, _columns, detail::parallel_elementwise(_rows * _columns), [&](size_t row, size_t column) {
+        result[row][column] = (*this)(row, column) * v;
+    });
+
+    return result;
+}
+
+template<class T, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<std::remove_const_t<T>, TO> && std::is_convertible_v<TO, std::remove_const_t<T>>>>
+dynamic_matrix<multiplication_result_t<std::remove_const_t<T>, TO>> operator*(const TO& v, const matrix_view<T>& view)
+{
+    return view * v;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_matrix<division_result_t<typename matrix_view<T>::mathematical_field_type, TO>> matrix_view<T>::operator/(const TO& v) const
+{
+    dynamic_matrix<division_result_t<mathematical_field_type, TO>> result(_rows, _columns);
+
+    if (_column_stride == 1)
+    {
+        detail::matrix_view_rows(_rows, _columns, _data, _row_stride, result.data(), _columns, detail::parallel_elementwise(_rows * _columns),
+            [&](size_t n, const auto* x, auto* out, bool parallel) { detail::elementwise_divide(n, x, v, out, parallel); });
+
+        return result;
+    }
+
+    detail::matrix_view_for_each(_rows, _columns, detail::parallel_elementwise(_rows * _columns), [&](size_t row, size_t column) {
+        result[row][column] = (*this)(row, column) / v;
+    });
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>& matrix_view<T>::operator*=(const TO& v)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+
+    if (_column_stride == 1)
+    {
+        detail::matrix_view_rows(_rows, _columns, _data, _row_stride, _data, _row_stride, detail::parallel_elementwise(_rows * _columns),
+            [&](size_t n, const auto* x, auto* out, bool parallel) { detail::elementwise_scale(n, x, v, out, parallel); });
+
+        return *this;
+    }
+
+    detail::matrix_view_for_each(_rows, _columns, detail::parallel_elementwise(_rows * _columns), [&](size_t row, size_t column) {
+        (*this)(row, column) *= static_cast<mathematical_field_type>(v);
+    });
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+matrix_view<T>& matrix_view<T>::operator/=(const TO& v)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+
+    if (_column_stride == 1)
+    {
+        detail::matrix_view_rows(_rows, _columns, _data, _row_stride, _data, _row_stride, detail::parallel_elementwise(_rows * _columns),
+            [&](size_t n, const auto* x, auto* out, bool parallel) { detail::elementwise_divide(n, x, v, out, parallel); });
+
+        return *this;
+    }
+
+    detail::matrix_view_for_each(_rows, _columns, detail::parallel_elementwise(_rows * _columns), [&](size_t row, size_t column) {
+        (*this)(row, column) /= static_cast<mathematical_field_type>(v);
+    });
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<inner_product_result_t<typename matrix_view<T>::mathematical_field_type, std::remove_const_t<TO>>> matrix_view<T>::operator*(const vector_view<TO>& vec) const
+{
+    assert(vec.size() == _columns);
+
+    using result_type = inner_product_result_t<mathematical_field_type, std::remove_const_t<TO>>;
+
+    dynamic_vector<result_type> result(_rows);
+
+    //vector is treated as single column matrix
+    detail::multiply_add(
+        _rows, 1, _columns,
+        get_multiplicative_identity<result_type>(),
+        _data, _row_stride, _column_stride,
+        vec.data(), vec.stride(), 1,
+        get_additive_identity<result_type>(),
+        result.data(), 1, 1,
+        is_big_view()
+    );
+
+    return result;
+}
+
+template<class T>
+size_t matrix_view<T>::rows() const
+{
+    return _rows;
+}
+
+template<class T>
+size_t matrix_view<T>::columns() const
+{
+    return _columns;
+}
+
+template<class T>
+size_t matrix_view<T>::row_stride() const
+{
+    return _row_stride;
+}
+
+template<class T>
+size_t matrix_view<T>::column_stride() const
+{
+    return _column_stride;
+}
+
+template<class T>
+bool matrix_view<T>::is_contiguous() const
+{
+    return _column_stride == 1 && (_row_stride == _columns || _rows <= 1);
+}
+
+template<class T>
+T& matrix_view<T>::operator()(size_t row, size_t column) const
+{
+    return _data[row * _row_stride + column * _column_stride];
+}
+
+template<class T>
+vector_view<T> matrix_view<T>::operator[](size_t row) const
+{
+    return this->row(row);
+}
+
+template<class T>
+T* matrix_view<T>::data() const
+{
+    return _data;
+}
+
+template<class T>
+matrix_view<T> matrix_view<T>::block(size_t row, size_t column, size_t rows, size_t columns) const
+{
+    assert(row + rows <= _rows && column + columns <= _columns);
+
+    return matrix_view<T>(_data + row * _row_stride + column * _column_stride, rows, columns, _row_stride, _column_stride);
+}
+
+template<class T>
+template<size_t R, size_t C>
+matrix_view<T> matrix_view<T>::block(size_t row, size_t column) const
+{
+    return block(row, column, R, C);
+}
+
+template<class T>
+vector_view<T> matrix_view<T>::row(size_t row) const
+{
+    return vector_view<T>(_data + row * _row_stride, _columns, _column_stride);
+}
+
+template<class T>
+vector_view<T> matrix_view<T>::column(size_t column) const
+{
+    return vector_view<T>(_data + column * _column_stride, _rows, _row_stride);
+}
+
+template<class T>
+vector_view<T> matrix_view<T>::diagonal() const
+{
+    return vector_view<T>(_data, std::min(_rows, _columns), _row_stride + _column_stride);
+}
+
+template<class T>
+matrix_view<T> matrix_view<T>::transposed() const
+{
+    return matrix_view<T>(_data, _columns, _rows, _column_stride, _row_stride);
+}
+
+NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
+
+template<class TO>
+std::ostream& operator<<(std::ostream& os, const matrix_view<TO>& m)
+{
+    for (size_t row = 0; row < m.rows(); row++)
+    {
+        for (size_t column = 0; column < m.columns(); column++)
+        {
+            os << m(row, column) << (column + 1 < m.columns() ? ",\t" : "");
+        }
+
+        if (row + 1 < m.rows())
+        {
+            os << std::endl;
+        }
+    }
+
+    return os;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_IO_END
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "../linear_algebra_common_functions.hpp"
+#include "../vector/vector.hpp"
+#include "../dynamic_vector/dynamic_vector.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
+
+template<class TO>
+std::ostream& operator<<(std::ostream& os, const vector_view<TO>& v);
+
+NAMESPACE_LINEAR_ALGEBRA_IO_END
+
+///<summary>
+/// non-owning view of size coordinates placed every stride elements in memory (e.g row, column or diagonal of matrix)
+/// <para>copying view does not copy coordinates, but assigning to view copies coordinates to viewed memory</para>
+/// <para>vector_view of const T is read-only, views of vectors are implicitly converted to it</para>
+/// <para>view must not outlive memory it refers to</para>
+///</summary>
+template<class T>
+class vector_view
+{
+public:
+    using mathematical_field_type = std::remove_const_t<T>;
+private:
+    static_assert(is_valid_mathematical_field_v<mathematical_field_type>, "Vector element type must satisfy valid_mathematical_field concept!");
+
+    template<class TO>
+    friend class vector_view;
+
+    T* _data = nullptr;
+    size_t _size = 0;
+    size_t _stride = 1;
+public:
+    //constructors
+
+    vector_view() = default;
+
+    vector_view(T* data, size_t size, size_t stride = 1);
+
+    vector_view(const vector_view<T>& other) = default;
+
+    //read-write view to read-only view
+    template<class TO, typename = typename std::enable_if_t<!std::is_same_v<TO, T> && std::is_convertible_v<TO*, T*>>>
+    vector_view(const vector_view<TO>& other);
+
+    //views of whole vectors
+
+    template<class TO, size_t D, typename = typename std::enable_if_t<std::is_convertible_v<TO*, T*>>>
+    vector_view(vector<TO, D>& v);
+
+    template<class TO, size_t D, typename = typename std::enable_if_t<std::is_convertible_v<const TO*, T*>>>
+    vector_view(const vector<TO, D>& v);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO*, T*>>>
+    vector_view(dynamic_vector<TO>& v);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<const TO*, T*>>>
+    vector_view(const dynamic_vector<TO>& v);
+
+    //assignment copies coordinates (views must have the same size)
+
+    vector_view<T>& operator=(const vector_view<T>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, mathematical_field_type>>>
+    vector_view<T>& operator=(const vector_view<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, mathematical_field_type>>>
+    vector_view<T>& operator=(const dynamic_vector<TO>& other);
+public:
+    //view-view operators (results are stored in dynamic_vector)
+
+    template<class TO, typename = typename std::enable_if_t<can_be_added_v<mathematical_field_type, std::remove_const_t<TO>>>>
+    dynamic_vector<addition_result_t<mathematical_field_type, std::remove_const_t<TO>>> operator+(const vector_view<TO>& other) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_subtracted_v<mathematical_field_type, std::remove_const_t<TO>>>>
+    dynamic_vector<subtraction_result_t<mathematical_field_type, std::remove_const_t<TO>>> operator-(const vector_view<TO>& other) const;
+
+    //shortcut for inner product
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<mathematical_field_type, std::remove_const_t<TO>>>>
+    inner_product_result_t<mathematical_field_type, std::remove_const_t<TO>> operator*(const vector_view<TO>& other) const;
+
+    //in place operators write to viewed memory
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<std::remove_const_t<TO>, mathematical_field_type>>>
+    vector_view<T>& operator+=(const vector_view<TO>& other);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<std::remove_const_t<TO>, mathematical_field_type>>>
+    vector_view<T>& operator-=(const vector_view<TO>& other);
+
+    //view-scalar operators
+
+    dynamic_vector<mathematical_field_type> operator-() const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_multiplied_v<mathematical_field_type, TO> && std::is_convertible_v<TO, mathematical_field_type>>>
+    dynamic_vector<multiplication_result_t<mathematical_field_type, TO>> operator*(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<can_be_divided_v<mathematical_field_type, TO> && std::is_convertible_v<TO, mathematical_field_type>>>
+    dynamic_vector<division_result_t<mathematical_field_type, TO>> operator/(const TO& v) const;
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, mathematical_field_type>>>
+    vector_view<T>& operator*=(const TO& v);
+
+    template<class TO, typename = typename std::enable_if_t<std::is_convertible_v<TO, mathematical_field_type>>>
+    vector_view<T>& operator/=(const TO& v);
+public:
+    //view info and accessors
+
+    size_t size() const;
+    size_t dimension() const;
+    size_t stride() const;
+
+    //coordinates are placed one after another in memory
+    bool is_contiguous() const;
+
+    T& operator[](size_t d) const;
+
+    T* data() const;
+
+    //view of count coordinates starting from given one
+    vector_view<T> segment(size_t offset, size_t count) const;
+public:
+    template<class TO, typename = typename std::enable_if_t<can_calculate_inner_product_v<mathematical_field_type, std::remove_const_t<TO>>>>
+    inner_product_result_t<mathematical_field_type, std::remove_const_t<TO>> inner_product(const vector_view<TO>& other) const;
+public:
+    template<class TO>
+    friend std::ostream& LINEAR_ALGEBRA_IO::operator<<(std::ostream& os, const vector_view<TO>& v);
+};
+
+NAMESPACE_LINEAR_ALGEBRA_END
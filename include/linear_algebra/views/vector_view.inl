@@ -0,0 +1,355 @@
+#pragma once
+
+#include "vector_view.hpp"
+#include "../dynamic_vector/dynamic_vector.inl"
+#include "../kernels/elementwise.hpp"
+
+NAMESPACE_LINEAR_ALGEBRA_BEGIN
+
+template<class T>
+vector_view<T>::vector_view(T* data, size_t size, size_t stride) :
+    _data(data),
+    _size(size),
+    _stride(stride)
+{
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>::vector_view(const vector_view<TO>& other) :
+    _data(other._data),
+    _size(other._size),
+    _stride(other._stride)
+{
+}
+
+template<class T>
+template<class TO, size_t D, typename>
+vector_view<T>::vector_view(vector<TO, D>& v) :
+    _data(v.data()),
+    _size(D)
+{
+}
+
+template<class T>
+template<class TO, size_t D, typename>
+vector_view<T>::vector_view(const vector<TO, D>& v) :
+    _data(v.data()),
+    _size(D)
+{
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>::vector_view(dynamic_vector<TO>& v) :
+    _data(v.data()),
+    _size(v.size())
+{
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>::vector_view(const dynamic_vector<TO>& v) :
+    _data(v.data()),
+    _size(v.size())
+{
+}
+
+template<class T>
+vector_view<T>& vector_view<T>::operator=(const vector_view<T>& other)
+{
+    return operator=<T>(other);
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>& vector_view<T>::operator=(const vector_view<TO>& other)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+    assert(_size == other._size);
+
+    for (size_t d = 0; d < _size; d++)
+    {
+        (*this)[d] = static_cast<mathematical_field_type>(other[d]);
+    }
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>& vector_view<T>::operator=(const dynamic_vector<TO>& other)
+{
+    return operator=(vector_view<const TO>(other));
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<addition_result_t<typename vector_view<T>::mathematical_field_type, std::remove_const_t<TO>>> vector_view<T>::operator+(const vector_view<TO>& other) const
+{
+    dynamic_vector<addition_result_t<mathematical_field_type, std::remove_const_t<TO>>> result(std::min(_size, other._size));
+
+    if (is_contiguous() && other.is_contiguous())
+    {
+        detail::elementwise_add(result.size(), _data, other._data, result.data(), detail::parallel_elementwise(result.size()));
+        return result;
+    }
+
+    for (size_t d = 0; d < result.size(); d++)
+    {
+        result[d] = (*this)[d] + other[d];
+    }
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<subtraction_result_t<typename vector_view<T>::mathematical_field_type, std::remove_const_t<TO>>> vector_view<T>::operator-(const vector_view<TO>& other) const
+{
+    dynamic_vector<subtraction_result_t<mathematical_field_type, std::remove_const_t<TO>>> result(std::min(_size, other._size));
+
+    if (is_contiguous() && other.is_contiguous())
+    {
+        detail::elementwise_subtract(result.size(), _data, other._data, result.data(), detail::parallel_elementwise(result.size()));
+        return result;
+    }
+
+    for (size_t d = 0; d < result.size(); d++)
+    {
+        result[d] = (*this)[d] - other[d];
+    }
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+inner_product_result_t<typename vector_view<T>::mathematical_field_type, std::remove_const_t<TO>> vector_view<T>::operator*(const vector_view<TO>& other) const
+{
+    return inner_product(other);
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>& vector_view<T>::operator+=(const vector_view<TO>& other)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+
+    const size_t size = std::min(_size, other._size);
+
+    if (is_contiguous() && other.is_contiguous())
+    {
+        detail::elementwise_add(size, _data, other._data, _data, detail::parallel_elementwise(size));
+        return *this;
+    }
+
+    for (size_t d = 0; d < size; d++)
+    {
+        (*this)[d] += static_cast<mathematical_field_type>(other[d]);
+    }
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>& vector_view<T>::operator-=(const vector_view<TO>& other)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+
+    const size_t size = std::min(_size, other._size);
+
+    if (is_contiguous() && other.is_contiguous())
+    {
+        detail::elementwise_subtract(size, _data, other._data, _data, detail::parallel_elementwise(size));
+        return *this;
+    }
+
+    for (size_t d = 0; d < size; d++)
+    {
+        (*this)[d] -= static_cast<mathematical_field_type>(other[d]);
+    }
+
+    return *this;
+}
+
+template<class T>
+dynamic_vector<typename vector_view<T>::mathematical_field_type> vector_view<T>::operator-() const
+{
+    dynamic_vector<mathematical_field_type> result(_size);
+
+    for (size_t d = 0; d < _size; d++)
+    {
+        result[d] = -(*this)[d];
+    }
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<multiplication_result_t<typename vector_view<T>::mathematical_field_type, TO>> vector_view<T>::operator*(const TO& v) const
+{
+    dynamic_vector<multiplication_result_t<mathematical_field_type, TO>> result(_size);
+
+    if (is_contiguous())
+    {
+        detail::elementwise_scale(_size, _data, v, result.data(), detail::parallel_elementwise(result.size()));
+        return result;
+    }
+
+    for (size_t d = 0; d < _size; d++)
+    {
+        result[d] = (*this)[d] * v;
+    }
+
+    return result;
+}
+
+template<class T, class TO, typename = typename std::enable_if_t<can_be_multiplied_v<std::remove_const_t<T>, TO> && std::is_convertible_v<TO, std::remove_const_t<T>>>>
+dynamic_vector<multiplication_result_t<std::remove_const_t<T>, TO>> operator*(const TO& v, const vector_view<T>& view)
+{
+    return view * v;
+}
+
+template<class T>
+template<class TO, typename>
+dynamic_vector<division_result_t<typename vector_view<T>::mathematical_field_type, TO>> vector_view<T>::operator/(const TO& v) const
+{
+    dynamic_vector<division_result_t<mathematical_field_type, TO>> result(_size);
+
+    if (is_contiguous())
+    {
+        detail::elementwise_divide(_size, _data, v, result.data(), detail::parallel_elementwise(result.size()));
+        return result;
+    }
+
+    for (size_t d = 0; d < _size; d++)
+    {
+        result[d] = (*this)[d] / v;
+    }
+
+    return result;
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>& vector_view<T>::operator*=(const TO& v)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+
+    if (is_contiguous())
+    {
+        detail::elementwise_scale(_size, _data, v, _data, detail::parallel_elementwise(_size));
+        return *this;
+    }
+
+    for (size_t d = 0; d < _size; d++)
+    {
+        (*this)[d] *= static_cast<mathematical_field_type>(v);
+    }
+
+    return *this;
+}
+
+template<class T>
+template<class TO, typename>
+vector_view<T>& vector_view<T>::operator/=(const TO& v)
+{
+    static_assert(!std::is_const_v<T>, "Cannot assign to read-only view!");
+
+    if (is_contiguous())
+    {
+        detail::elementwise_divide(_size, _data, v, _data, detail::parallel_elementwise(_size));
+        return *this;
+    }
+
+    for (size_t d = 0; d < _size; d++)
+    {
+        (*this)[d] /= static_cast<mathematical_field_type>(v);
+    }
+
+    return *this;
+}
+
+template<class T>
+size_t vector_view<T>::size() const
+{
+    return _size;
+}
+
+template<class T>
+size_t vector_view<T>::dimension() const
+{
+    return _size;
+}
+
+template<class T>
+size_t vector_view<T>::stride() const
+{
+    return _stride;
+}
+
+template<class T>
+bool vector_view<T>::is_contiguous() const
+{
+    return _stride == 1;
+}
+
+template<class T>
+T& vector_view<T>::operator[](size_t d) const
+{
+    return _data[d * _stride];
+}
+
+template<class T>
+T* vector_view<T>::data() const
+{
+    return _data;
+}
+
+template<class T>
+vector_view<T> vector_view<T>::segment(size_t offset, size_t count) const
+{
+    return vector_view<T>(_data + offset * _stride, count, _stride);
+}
+
+template<class T>
+template<class TO, typename>
+inner_product_result_t<typename vector_view<T>::mathematical_field_type, std::remove_const_t<TO>> vector_view<T>::inner_product(const vector_view<TO>& other) const
+{
+    const size_t size = std::min(_size, other._size);
+
+    if (is_contiguous() && other.is_contiguous())
+    {
+        return detail::elementwise_dot(size, _data, other._data);
+    }
+
+    auto result = get_additive_identity<inner_product_result_t<mathematical_field_type, std::remove_const_t<TO>>>();
+
+    for (size_t d = 0; d < size; d++)
+    {
+        result += (*this)[d] * other[d];
+    }
+
+    return result;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_IO_BEGIN
+
+template<class TO>
+std::ostream& operator<<(std::ostream& os, const vector_view<TO>& v)
+{
+    os << "(";
+    for (size_t d = 0; d < v.size(); d++)
+    {
+        os << v[d] << (d + 1 < v.size() ? ", " : "");
+    }
+    os << ")";
+    return os;
+}
+
+NAMESPACE_LINEAR_ALGEBRA_IO_END
+
+NAMESPACE_LINEAR_ALGEBRA_END
@@ -318,6 +318,122 @@ int main()
         ss << c;
     }
 
+    {
+        //per-call latency of closed-form determinant/inverse of small matrices compared to LU path (used for bigger ones)
+        constexpr size_t calls = 1000000;
+        double sink = 0;
+
+        auto benchmark = [&](const char* name, auto&& f) {
+            auto start = high_resolution_clock::now();
+            for (size_t call = 0; call < calls; call++)
+            {
+                sink += f(call);
+            }
+            auto end = high_resolution_clock::now();
+            cout << name << ": " << static_cast<double>((end - start).count()) / calls << "ns per call" << endl;
+        };
+
+        matrix<double, 3, 3> m3{ { 4, 1, 2 }, { 1, 5, 0 }, { 2, 0, 6 } };
+        matrix<double, 4, 4> m4{ { 4, 1, 2, 0 }, { 1, 5, 0, 1 }, { 2, 0, 6, 1 }, { 0, 1, 1, 7 } };
+
+        benchmark("3x3 determinant (closed-form)", [&](size_t call) { m3[0][0] = 4.0 + call * 1e-9; return m3.determinant(); });
+        benchmark("3x3 determinant (LU)", [&](size_t call) { m3[0][0] = 4.0 + call * 1e-9; return lu_decomposition<double, 3>(m3).determinant(); });
+        benchmark("3x3 inverse (closed-form)", [&](size_t call) { m3[0][0] = 4.0 + call * 1e-9; return (*m3.inverted())[0][0]; });
+        benchmark("3x3 inverse (LU)", [&](size_t call) { m3[0][0] = 4.0 + call * 1e-9; return (*lu_decomposition<double, 3>(m3).inverse())[0][0]; });
+        benchmark("4x4 determinant (closed-form)", [&](size_t call) { m4[0][0] = 4.0 + call * 1e-9; return m4.determinant(); });
+        benchmark("4x4 determinant (LU)", [&](size_t call) { m4[0][0] = 4.0 + call * 1e-9; return lu_decomposition<double, 4>(m4).determinant(); });
+        benchmark("4x4 inverse (closed-form)", [&](size_t call) { m4[0][0] = 4.0 + call * 1e-9; return (*m4.inverted())[0][0]; });
+        benchmark("4x4 inverse (LU)", [&](size_t call) { m4[0][0] = 4.0 + call * 1e-9; return (*lu_decomposition<double, 4>(m4).inverse())[0][0]; });
+
+        cout << sink << endl;
+    }
+
+    {
+        //time and largest deviation from packed gemm of strassen-winograd products for several crossovers
+        //(used to choose default strassen_settings::crossover)
+        constexpr size_t n = 4096;
+
+        dynamic_matrix<double> a(n, n);
+        dynamic_matrix<double> b(n, n);
+        for (size_t index = 0; index < n * n; index++)
+        {
+            a.data()[index] = sin(static_cast<double>(index));
+            b.data()[index] = cos(static_cast<double>(index));
+        }
+
+        dynamic_matrix<double> reference(n, n);
+        {
+            auto start = high_resolution_clock::now();
+            linear_algebra::detail::gemm<double>(n, n, n, 1.0, a.data(), n, 1, b.data(), n, 1, 0.0, reference.data(), n, 1, true);
+            auto end = high_resolution_clock::now();
+            cout << "gemm: " << (end - start).count() / 1e9 << "s" << endl;
+        }
+
+        for (size_t crossover : { 256, 512, 1024, 2048 })
+        {
+            dynamic_matrix<double> c(n, n);
+
+            auto start = high_resolution_clock::now();
+            linear_algebra::detail::strassen_multiply_add<double>(n, n, n, 1.0, a.data(), n, b.data(), n, 0.0, c.data(), n, true, crossover);
+            auto end = high_resolution_clock::now();
+
+            double error = 0;
+            for (size_t index = 0; index < n * n; index++)
+            {
+                error = std::max(error, abs(c.data()[index] - reference.data()[index]));
+            }
+
+            cout << "strassen-winograd (crossover " << crossover << "): " << (end - start).count() / 1e9 << "s, max error " << error << endl;
+        }
+    }
+
+    {
+        //singular square system classified by elimination (LU fails), pivot of third row is in last column,
+        //so fourth row has no column left for pivot
+        matrix<double, 4, 4> a{ { 1, 1, 0, 0 }, { 0, 1, 1, 0 }, { 1, 2, 1, 0 }, { 0, 0, 0, 1 } };
+        linear_algebra::vector<double, 4> consistent{ 1, 2, 3, 4 };
+        linear_algebra::vector<double, 4> contradictory{ 1, 2, 0, 4 };
+
+        auto check_indeterminate = [&](const equation_system_solution<double, 4>& solution) {
+            assert(solution.system_type() == equation_system_type::indeterminate);
+
+            const auto& indeterminate = solution.get_indeterminate_solution();
+            assert(a * indeterminate.constant_solution_vector == consistent);
+            assert(indeterminate.infinite_solution_vectors.size() == 1);
+            assert(a * indeterminate.infinite_solution_vectors[0] == (linear_algebra::vector<double, 4>()));
+        };
+
+        check_indeterminate(solve_equation_system(a, consistent));
+        check_indeterminate(solve_equation_system(matrix<double, 4, 4>(a), linear_algebra::vector<double, 4>(consistent)));
+
+        assert(solve_equation_system(a, contradictory).system_type() == equation_system_type::contradictory);
+        assert(solve_equation_system(matrix<double, 4, 4>(a), linear_algebra::vector<double, 4>(contradictory)).system_type() == equation_system_type::contradictory);
+
+        cout << "singular 4x4 equation system: ok" << endl;
+    }
+
+    {
+        //eigenvalues of 3x3 matrix with repeated eigenvalue do not depend on whether eigenvectors are computed
+        for (double shift : { 0.0, 1e6 })
+        {
+            matrix<double, 3, 3> a{ { 2 + shift, 1, 0 }, { 1, 2 + shift, 0 }, { 0, 0, 3 + shift } };
+
+            const auto values = symmetric_eigen<double, 3>(a, false).eigenvalues();
+            const auto values_with_vectors = symmetric_eigen<double, 3>(a, true).eigenvalues();
+
+            for (size_t index = 0; index < 3; index++)
+            {
+                assert(values[index] == values_with_vectors[index]);
+            }
+
+            assert(abs(values[0] - (1 + shift)) <= 1e-15 * (1 + shift));
+            assert(abs(values[1] - (3 + shift)) <= 1e-15 * (3 + shift));
+            assert(abs(values[2] - (3 + shift)) <= 1e-15 * (3 + shift));
+        }
+
+        cout << "symmetric 3x3 eigenvalues: ok" << endl;
+    }
+
     /*using r = matrix_multiplication_proxy<matrix<double, 3, 4>, matrix<float, 4, 5>>;
     using l = matrix_multiplication_proxy<matrix<double, 1, 2>, matrix<float, 2, 3>>;
     matrix<double,1,5> res = l()*r();